@@ -0,0 +1,283 @@
+/************************************************************************************//*!
+\file           SerializerPlan.cpp
+\project        Editor
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Builds the serialization plan of a component type and defines the codec
+				of each value type. The json written is the same as SerializerProperties.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#include "pch.h"
+#include "SerializerPlan.h"
+#include "SerializerProperties.h"
+#include "UI_RTTRType.h"
+#include "Project.h"
+#include <Quaternion/include/Quaternion.h>
+#include "Ouroboros/Asset/Asset.h"
+#include "Ouroboros/Vulkan/MeshInfo.h"
+#include <Ouroboros/Vulkan/Color.h>
+
+#include <cstring>
+#include <filesystem>
+
+namespace
+{
+	using Allocator = rapidjson::Document::AllocatorType;
+
+	//each codec writes the value held by the variant into out, and reads the value back
+	template<typename T>
+	struct Codec;
+
+	template<>
+	struct Codec<bool>
+	{
+		static void Save(const rttr::variant& var, rapidjson::Value& out, Allocator&) { out.SetBool(var.get_value<bool>()); }
+		static bool Load(rapidjson::Value& val) { return val.GetBool(); }
+	};
+	template<>
+	struct Codec<int>
+	{
+		static void Save(const rttr::variant& var, rapidjson::Value& out, Allocator&) { out.SetInt(var.get_value<int>()); }
+		static int Load(rapidjson::Value& val) { return val.GetInt(); }
+	};
+	template<>
+	struct Codec<unsigned>
+	{
+		static void Save(const rttr::variant& var, rapidjson::Value& out, Allocator&) { out.SetUint(var.get_value<unsigned>()); }
+		static unsigned Load(rapidjson::Value& val) { return val.GetUint(); }
+	};
+	template<>
+	struct Codec<std::size_t>
+	{
+		static void Save(const rttr::variant& var, rapidjson::Value& out, Allocator&) { out.SetUint64(var.get_value<std::size_t>()); }
+		static std::size_t Load(rapidjson::Value& val) { return static_cast<std::size_t>(val.GetUint64()); }
+	};
+	template<>
+	struct Codec<float>
+	{
+		static void Save(const rttr::variant& var, rapidjson::Value& out, Allocator&) { out.SetFloat(var.to_float()); }
+		static float Load(rapidjson::Value& val) { return val.GetFloat(); }
+	};
+	template<>
+	struct Codec<double>
+	{
+		static void Save(const rttr::variant& var, rapidjson::Value& out, Allocator&) { out.SetDouble(var.get_value<double>()); }
+		static double Load(rapidjson::Value& val) { return val.GetDouble(); }
+	};
+	template<>
+	struct Codec<glm::vec2>
+	{
+		static void Save(const rttr::variant& var, rapidjson::Value& out, Allocator& allocator)
+		{
+			const auto& vec = var.get_wrapped_value<glm::vec2>();
+			out.SetArray().Reserve(2, allocator);
+			out.PushBack(vec.x, allocator).PushBack(vec.y, allocator);
+		}
+		static glm::vec2 Load(rapidjson::Value& val)
+		{
+			auto arr = val.GetArray();
+			return glm::vec2(arr[0].GetFloat(), arr[1].GetFloat());
+		}
+	};
+	template<>
+	struct Codec<glm::vec3>
+	{
+		static void Save(const rttr::variant& var, rapidjson::Value& out, Allocator& allocator)
+		{
+			const auto& vec = var.get_wrapped_value<glm::vec3>();
+			out.SetArray().Reserve(3, allocator);
+			out.PushBack(vec.x, allocator).PushBack(vec.y, allocator).PushBack(vec.z, allocator);
+		}
+		static glm::vec3 Load(rapidjson::Value& val)
+		{
+			auto arr = val.GetArray();
+			return glm::vec3(arr[0].GetFloat(), arr[1].GetFloat(), arr[2].GetFloat());
+		}
+	};
+	template<>
+	struct Codec<glm::vec4>
+	{
+		static void Save(const rttr::variant& var, rapidjson::Value& out, Allocator& allocator)
+		{
+			const auto& vec = var.get_wrapped_value<glm::vec4>();
+			out.SetArray().Reserve(4, allocator);
+			out.PushBack(vec.x, allocator).PushBack(vec.y, allocator).PushBack(vec.z, allocator).PushBack(vec.w, allocator);
+		}
+		static glm::vec4 Load(rapidjson::Value& val)
+		{
+			auto arr = val.GetArray();
+			return glm::vec4(arr[0].GetFloat(), arr[1].GetFloat(), arr[2].GetFloat(), arr[3].GetFloat());
+		}
+	};
+	template<>
+	struct Codec<quaternion>
+	{
+		// IMPT NOTE: GLM vec4 Differs from glm Quat because its XYZW and Quats are WXYZ
+		static void Save(const rttr::variant& var, rapidjson::Value& out, Allocator& allocator)
+		{
+			const auto& quat = var.get_value<quaternion>().value;
+			out.SetArray().Reserve(4, allocator);
+			out.PushBack(quat.w, allocator).PushBack(quat.x, allocator).PushBack(quat.y, allocator).PushBack(quat.z, allocator);
+		}
+		static quaternion Load(rapidjson::Value& val)
+		{
+			auto arr = val.GetArray();
+			return quaternion(glm::quat(arr[0].GetFloat(), arr[1].GetFloat(), arr[2].GetFloat(), arr[3].GetFloat()));
+		}
+	};
+	template<>
+	struct Codec<oo::Color>
+	{
+		static void Save(const rttr::variant& var, rapidjson::Value& out, Allocator& allocator)
+		{
+			const auto& color = var.get_wrapped_value<oo::Color>();
+			out.SetArray().Reserve(4, allocator);
+			out.PushBack(color.r, allocator).PushBack(color.g, allocator).PushBack(color.b, allocator).PushBack(color.a, allocator);
+		}
+		static oo::Color Load(rapidjson::Value& val)
+		{
+			auto arr = val.GetArray();
+			oo::Color c;
+			c.r = arr[0].GetFloat();
+			c.g = arr[1].GetFloat();
+			c.b = arr[2].GetFloat();
+			c.a = arr[3].GetFloat();
+			return c;
+		}
+	};
+	template<>
+	struct Codec<std::string>
+	{
+		static void Save(const rttr::variant& var, rapidjson::Value& out, Allocator& allocator)
+		{
+			const auto& str = var.get_value<std::string>();
+			out.SetString(str.c_str(), static_cast<rapidjson::SizeType>(str.size()), allocator);
+		}
+		static std::string Load(rapidjson::Value& val) { return std::string(val.GetString(), val.GetStringLength()); }
+	};
+	template<>
+	struct Codec<std::filesystem::path>
+	{
+		static void Save(const rttr::variant& var, rapidjson::Value& out, Allocator& allocator)
+		{
+			std::string str = var.get_value<std::filesystem::path>().string();
+			out.SetString(str.c_str(), static_cast<rapidjson::SizeType>(str.size()), allocator);
+		}
+		static std::filesystem::path Load(rapidjson::Value& val) { return std::filesystem::path(val.GetString()); }
+	};
+	template<>
+	struct Codec<oo::Asset>
+	{
+		static void Save(const rttr::variant& var, rapidjson::Value& out, Allocator&)
+		{
+			const auto& asset = var.get_value<oo::Asset>();
+			out.SetUint64(asset.GetID());
+			SerializerSaveProperties::s_assetUsedThisScene.emplace(asset.GetID());
+		}
+		static oo::Asset Load(rapidjson::Value& val) { return Project::GetAssetManager()->Get(val.GetUint64()); }
+	};
+	template<>
+	struct Codec<MeshInfo>
+	{
+		static void Save(const rttr::variant& var, rapidjson::Value& out, Allocator&) { out.SetUint64(var.get_value<MeshInfo>().submeshBits.to_ullong()); }
+		static MeshInfo Load(rapidjson::Value& val)
+		{
+			MeshInfo meshInfo;
+			meshInfo.submeshBits = val.GetUint64();
+			return meshInfo;
+		}
+	};
+
+	template<typename T>
+	void SaveValue(const rttr::variant& var, rapidjson::Value& out, Allocator& allocator)
+	{
+		Codec<T>::Save(var, out, allocator);
+	}
+
+	template<typename T>
+	bool LoadValue(const rttr::property& prop, rttr::instance obj, rapidjson::Value& val)
+	{
+		T value = Codec<T>::Load(val);
+		return prop.set_value(obj, value);
+	}
+
+	template<typename T>
+	void SetCodec(SerializerPlan::Field& field)
+	{
+		field.save = &SaveValue<T>;
+		field.load = &LoadValue<T>;
+	}
+
+	//same types as the SerializerSaveProperties and SerializerLoadProperties tables
+	bool SetCodec(UI_RTTRType::UItypes type, SerializerPlan::Field& field)
+	{
+		switch (type)
+		{
+		case UI_RTTRType::UItypes::BOOL_TYPE:		SetCodec<bool>(field); return true;
+		case UI_RTTRType::UItypes::INT_TYPE:		SetCodec<int>(field); return true;
+		case UI_RTTRType::UItypes::UINT_TYPE:		SetCodec<unsigned>(field); return true;
+		case UI_RTTRType::UItypes::SIZE_T_TYPE:		SetCodec<std::size_t>(field); return true;
+		case UI_RTTRType::UItypes::FLOAT_TYPE:		SetCodec<float>(field); return true;
+		case UI_RTTRType::UItypes::DOUBLE_TYPE:		SetCodec<double>(field); return true;
+		case UI_RTTRType::UItypes::VEC2_TYPE:		SetCodec<glm::vec2>(field); return true;
+		case UI_RTTRType::UItypes::VEC3_TYPE:		SetCodec<glm::vec3>(field); return true;
+		case UI_RTTRType::UItypes::VEC4_TYPE:		SetCodec<glm::vec4>(field); return true;
+		case UI_RTTRType::UItypes::QUAT_TYPE:		SetCodec<quaternion>(field); return true;
+		case UI_RTTRType::UItypes::COLOR_TYPE:		SetCodec<oo::Color>(field); return true;
+		case UI_RTTRType::UItypes::STRING_TYPE:		SetCodec<std::string>(field); return true;
+		case UI_RTTRType::UItypes::PATH_TYPE:		SetCodec<std::filesystem::path>(field); return true;
+		case UI_RTTRType::UItypes::ASSET_TYPE:		SetCodec<oo::Asset>(field); return true;
+		case UI_RTTRType::UItypes::MESH_INFO_TYPE:	SetCodec<MeshInfo>(field); return true;
+		default:
+			return false;//don't have this save function
+		}
+	}
+}
+
+SerializerPlan::SerializerPlan(rttr::type type)
+	: name{ type.get_name().data(), type.get_name().size() }
+{
+	for (auto& prop : type.get_properties())
+	{
+		if (prop.is_readonly())
+			continue;
+		rttr::type prop_type = prop.get_type();
+		Field field{ prop, std::string{ prop.get_name().data(), prop.get_name().size() }, Kind::VALUE };
+
+		auto iter = UI_RTTRType::types.find(prop_type.get_id());
+		if (iter != UI_RTTRType::types.end())
+		{
+			if (SetCodec(iter->second, field) == false)
+				continue;
+		}
+		else if (prop_type.is_sequential_container())
+			field.kind = Kind::SEQUENTIAL;
+		else if (prop_type.is_class())
+			field.kind = Kind::NESTED;
+		else if (prop_type.is_enumeration())
+			field.kind = Kind::ENUMERATION;
+		else
+			continue;//not supported
+
+		fields.emplace_back(std::move(field));
+	}
+}
+
+const SerializerPlan::Field* SerializerPlan::Find(const char* fieldName, size_t& hint) const
+{
+	for (size_t i = 0; i < fields.size(); ++i)
+	{
+		size_t index = (hint + i) % fields.size();
+		if (std::strcmp(fields[index].name.c_str(), fieldName) == 0)
+		{
+			hint = index + 1;
+			return &fields[index];
+		}
+	}
+	return nullptr;
+}
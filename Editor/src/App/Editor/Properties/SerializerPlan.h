@@ -0,0 +1,65 @@
+/************************************************************************************//*!
+\file           SerializerPlan.h
+\project        Editor
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Serialization plan of a component type, the fields it saves and loads
+				with their codecs already resolved.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#pragma once
+#include <string>
+#include <vector>
+
+#include <rttr/type.h>
+#include <rttr/property.h>
+#include <rttr/instance.h>
+#include <rttr/variant.h>
+#include "rapidjson/document.h"
+
+/*********************************************************************************//*!
+\brief      Built once per component type when it is registered with the serializer,
+			so saving and loading walk a flat list instead of searching the rttr type,
+			UI_RTTRType::types and the command tables for every field.
+*//**********************************************************************************/
+struct SerializerPlan
+{
+	enum class Kind
+	{
+		VALUE,			//has a codec
+		ENUMERATION,	//saved as int
+		SEQUENTIAL,		//goes through Serializer::SaveSequentialContainer/LoadSequentialContainer
+		NESTED,			//goes through Serializer::SaveNestedComponent/LoadNestedComponent
+	};
+	using SaveCodec = void(*)(const rttr::variant&, rapidjson::Value&, rapidjson::Document::AllocatorType&);
+	//sets the property with the value it decodes, without going through a variant
+	using LoadCodec = bool(*)(const rttr::property&, rttr::instance, rapidjson::Value&);
+
+	struct Field
+	{
+		rttr::property property;
+		std::string name;
+		Kind kind;
+		SaveCodec save = nullptr;
+		LoadCodec load = nullptr;
+	};
+
+	explicit SerializerPlan(rttr::type type);
+	/*********************************************************************************//*!
+	\brief      Finds a field by name, starting after the last field found.
+				Members are saved in field order so this is usually the first check.
+
+	\param      hint ==> start at 0 for each component, updated on every find
+
+	\return     the field or nullptr if the component does not save it
+	*//**********************************************************************************/
+	const Field* Find(const char* fieldName, size_t& hint) const;
+
+	std::string name;
+	std::vector<Field> fields;
+};
@@ -0,0 +1,618 @@
+/************************************************************************************//*!
+\file           SceneBinary.cpp
+\project        Editor
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Converts scene json to the binary form and reads it back
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#include "pch.h"
+#include "SceneBinary.h"
+
+#include <rapidjson/istreamwrapper.h>
+
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace
+{
+	enum class Tag : uint8_t
+	{
+		Null,
+		False,
+		True,
+		Int32,
+		Uint32,
+		Int64,
+		Uint64,
+		Double,
+		String,
+		Array,
+		Object,
+	};
+
+	struct Header
+	{
+		uint32_t magic;
+		uint32_t version;
+		uint64_t sourceSize;
+		int64_t sourceWriteTime;
+		uint64_t sourceHash;
+		uint32_t stringCount;
+		uint32_t archetypeCount;
+		uint32_t objectCount;
+		uint32_t reserved;
+		uint64_t dataSize;
+	};
+
+	//nesting deeper than this is treated as a damaged file
+	constexpr int max_depth = 64;
+
+	// 64 bit FNV-1a
+	uint64_t HashFile(const std::filesystem::path& path, bool& ok)
+	{
+		std::ifstream ifs(path, std::ios::binary);
+		ok = ifs.good();
+		uint64_t hash = 0xcbf29ce484222325ull;
+		char chunk[64 * 1024];
+		while (ifs)
+		{
+			ifs.read(chunk, sizeof(chunk));
+			for (std::streamsize i = 0; i < ifs.gcount(); ++i)
+			{
+				hash ^= static_cast<uint8_t>(chunk[i]);
+				hash *= 0x100000001b3ull;
+			}
+		}
+		return hash;
+	}
+
+	bool GetStamp(const std::filesystem::path& scenePath, uint64_t& size, int64_t& writeTime)
+	{
+		std::error_code ec;
+		size = static_cast<uint64_t>(std::filesystem::file_size(scenePath, ec));
+		if (ec)
+			return false;
+		writeTime = static_cast<int64_t>(std::filesystem::last_write_time(scenePath, ec).time_since_epoch().count());
+		return !ec;
+	}
+
+	//a touched but unchanged scene (fresh checkout, copied build) still matches by its contents
+	bool MatchesScene(const Header& header, const std::filesystem::path& scenePath)
+	{
+		uint64_t size = 0;
+		int64_t writeTime = 0;
+		if (GetStamp(scenePath, size, writeTime) == false || size != header.sourceSize)
+			return false;
+		if (writeTime == header.sourceWriteTime)
+			return true;
+		bool ok = false;
+		uint64_t hash = HashFile(scenePath, ok);
+		return ok && hash == header.sourceHash;
+	}
+
+	template<typename T>
+	void Put(std::vector<char>& out, const T& value)
+	{
+		static_assert(std::is_trivially_copyable_v<T>);
+		const char* bytes = reinterpret_cast<const char*>(&value);
+		out.insert(out.end(), bytes, bytes + sizeof(T));
+	}
+
+	class StringTable
+	{
+	public:
+		uint32_t Add(const char* str, rapidjson::SizeType length)
+		{
+			auto [iter, added] = m_ids.try_emplace(std::string{ str, length }, static_cast<uint32_t>(m_ids.size()));
+			if (added)
+				m_order.emplace_back(&iter->first);
+			return iter->second;
+		}
+		void Write(std::vector<char>& out) const
+		{
+			for (const std::string* str : m_order)
+			{
+				Put(out, static_cast<uint32_t>(str->size()));
+				out.insert(out.end(), str->begin(), str->end());
+				out.push_back('\0');
+			}
+		}
+		uint32_t Count() const { return static_cast<uint32_t>(m_order.size()); }
+	private:
+		std::unordered_map<std::string, uint32_t> m_ids;
+		std::vector<const std::string*> m_order;
+	};
+
+	void WriteValue(const rapidjson::Value& value, std::vector<char>& out, StringTable& strings)
+	{
+		switch (value.GetType())
+		{
+		case rapidjson::kNullType:
+			Put(out, Tag::Null);
+			break;
+		case rapidjson::kFalseType:
+			Put(out, Tag::False);
+			break;
+		case rapidjson::kTrueType:
+			Put(out, Tag::True);
+			break;
+		case rapidjson::kNumberType:
+			//keep the kind of number, loaders call GetInt, GetUint64 or GetFloat on what they saved
+			if (value.IsDouble())
+			{
+				Put(out, Tag::Double);
+				Put(out, value.GetDouble());
+			}
+			else if (value.IsUint())
+			{
+				Put(out, Tag::Uint32);
+				Put(out, value.GetUint());
+			}
+			else if (value.IsInt())
+			{
+				Put(out, Tag::Int32);
+				Put(out, value.GetInt());
+			}
+			else if (value.IsUint64())
+			{
+				Put(out, Tag::Uint64);
+				Put(out, value.GetUint64());
+			}
+			else
+			{
+				Put(out, Tag::Int64);
+				Put(out, value.GetInt64());
+			}
+			break;
+		case rapidjson::kStringType:
+			Put(out, Tag::String);
+			Put(out, strings.Add(value.GetString(), value.GetStringLength()));
+			break;
+		case rapidjson::kArrayType:
+			Put(out, Tag::Array);
+			Put(out, static_cast<uint32_t>(value.Size()));
+			for (auto& element : value.GetArray())
+				WriteValue(element, out, strings);
+			break;
+		case rapidjson::kObjectType:
+			Put(out, Tag::Object);
+			Put(out, static_cast<uint32_t>(value.MemberCount()));
+			for (auto iter = value.MemberBegin(); iter != value.MemberEnd(); ++iter)
+			{
+				Put(out, strings.Add(iter->name.GetString(), iter->name.GetStringLength()));
+				WriteValue(iter->value, out, strings);
+			}
+			break;
+		}
+	}
+}
+
+std::filesystem::path SceneBinary::GetPath(const std::filesystem::path& scenePath)
+{
+	std::filesystem::path path = scenePath;
+	path.replace_extension(file_ext);
+	return path;
+}
+
+bool SceneBinary::Write(const rapidjson::Document& doc, const std::filesystem::path& scenePath)
+{
+	if (doc.IsObject() == false)
+		return false;
+
+	Header header{};
+	header.magic = file_magic;
+	header.version = file_version;
+	bool hashed = false;
+	header.sourceHash = HashFile(scenePath, hashed);
+	if (hashed == false || GetStamp(scenePath, header.sourceSize, header.sourceWriteTime) == false)
+		return false;
+
+	StringTable strings;
+	std::map<std::vector<uint32_t>, uint32_t> archetypeIDs;
+	std::vector<const std::vector<uint32_t>*> archetypes;
+	std::vector<std::vector<char>> archetypeData;
+	std::vector<Object> objects;
+	objects.reserve(doc.MemberCount());
+
+	//each object's components go into the data of its archetype
+	for (auto iter = doc.MemberBegin(); iter != doc.MemberEnd(); ++iter)
+	{
+		const rapidjson::Value& gameobject = iter->value;
+		if (gameobject.IsObject() == false || gameobject.MemberCount() == 0 || gameobject.MemberBegin()->value.IsInt() == false)
+			return false;
+
+		Object object{};
+		try
+		{
+			object.id = std::stoull(iter->name.GetString());
+		}
+		catch (const std::exception&)
+		{
+			return false;
+		}
+		object.order = gameobject.MemberBegin()->value.GetInt();
+
+		//the first member is the order
+		std::vector<uint32_t> componentNames;
+		for (auto member = gameobject.MemberBegin() + 1; member != gameobject.MemberEnd(); ++member)
+			componentNames.emplace_back(strings.Add(member->name.GetString(), member->name.GetStringLength()));
+
+		auto [archetype, added] = archetypeIDs.try_emplace(std::move(componentNames), static_cast<uint32_t>(archetypes.size()));
+		if (added)
+		{
+			archetypes.emplace_back(&archetype->first);
+			archetypeData.emplace_back();
+		}
+		object.archetype = archetype->second;
+
+		std::vector<char>& data = archetypeData[object.archetype];
+		object.offset = data.size();
+		for (auto member = gameobject.MemberBegin() + 1; member != gameobject.MemberEnd(); ++member)
+			WriteValue(member->value, data, strings);
+		objects.emplace_back(object);
+	}
+
+	std::vector<uint64_t> archetypeOffsets;
+	archetypeOffsets.reserve(archetypeData.size());
+	for (const auto& data : archetypeData)
+	{
+		archetypeOffsets.emplace_back(header.dataSize);
+		header.dataSize += data.size();
+	}
+	for (auto& object : objects)
+		object.offset += archetypeOffsets[object.archetype];
+
+	header.stringCount = strings.Count();
+	header.archetypeCount = static_cast<uint32_t>(archetypes.size());
+	header.objectCount = static_cast<uint32_t>(objects.size());
+
+	std::vector<char> out;
+	Put(out, header);
+	strings.Write(out);
+	for (const auto* archetype : archetypes)
+	{
+		Put(out, static_cast<uint32_t>(archetype->size()));
+		for (uint32_t name : *archetype)
+			Put(out, name);
+	}
+	for (const auto& object : objects)
+	{
+		Put(out, object.id);
+		Put(out, object.order);
+		Put(out, object.archetype);
+		Put(out, object.offset);
+	}
+	for (const auto& data : archetypeData)
+		out.insert(out.end(), data.begin(), data.end());
+
+	//written aside and renamed over, a reader never sees half a file
+	const std::filesystem::path path = GetPath(scenePath);
+	std::filesystem::path tempPath = path;
+	tempPath += ".tmp";
+	{
+		std::ofstream ofs(tempPath, std::ios::binary | std::ios::trunc);
+		ofs.write(out.data(), static_cast<std::streamsize>(out.size()));
+		if (ofs.good() == false)
+		{
+			ofs.close();
+			std::error_code ec;
+			std::filesystem::remove(tempPath, ec);
+			return false;
+		}
+	}
+	std::error_code ec;
+	std::filesystem::rename(tempPath, path, ec);
+	if (ec)
+	{
+		std::filesystem::remove(tempPath, ec);
+		return false;
+	}
+	return true;
+}
+
+bool SceneBinary::Convert(const std::filesystem::path& scenePath)
+{
+	std::ifstream ifs(scenePath);
+	if (!ifs || ifs.peek() == std::ifstream::traits_type::eof())
+		return false;
+	rapidjson::IStreamWrapper isw(ifs);
+	rapidjson::Document doc;
+	doc.ParseStream(isw);
+	if (doc.HasParseError())
+		return false;
+	ifs.close();
+	return Write(doc, scenePath);
+}
+
+bool SceneBinary::IsCurrent(const std::filesystem::path& scenePath)
+{
+	std::ifstream ifs(GetPath(scenePath), std::ios::binary);
+	Header header{};
+	if (!ifs.read(reinterpret_cast<char*>(&header), sizeof(Header)))
+		return false;
+	return header.magic == file_magic && header.version == file_version && MatchesScene(header, scenePath);
+}
+
+bool SceneBinary::Open(const std::filesystem::path& scenePath)
+{
+	m_buffer.clear();
+	m_strings.clear();
+	m_archetypes.clear();
+	m_objects.clear();
+
+	{
+		std::ifstream ifs(GetPath(scenePath), std::ios::binary | std::ios::ate);
+		if (!ifs)
+			return false;
+		const std::streamoff size = ifs.tellg();
+		if (size < static_cast<std::streamoff>(sizeof(Header)))
+			return false;
+		m_buffer.resize(static_cast<size_t>(size));
+		ifs.seekg(0);
+		if (!ifs.read(m_buffer.data(), size))
+			return false;
+	}
+
+	Header header{};
+	std::memcpy(&header, m_buffer.data(), sizeof(Header));
+	if (header.magic != file_magic || header.version != file_version)
+		return false;
+	std::error_code ec;
+	if (std::filesystem::exists(scenePath, ec) && MatchesScene(header, scenePath) == false)
+		return false;
+
+	//every count and offset is checked, a damaged file is refused before anything is created from it
+	const uint64_t size = m_buffer.size();
+	uint64_t pos = sizeof(Header);
+	auto read = [&](auto& value)
+	{
+		if (size - pos < sizeof(value))
+			return false;
+		std::memcpy(&value, m_buffer.data() + pos, sizeof(value));
+		pos += sizeof(value);
+		return true;
+	};
+
+	m_strings.reserve(header.stringCount);
+	for (uint32_t i = 0; i < header.stringCount; ++i)
+	{
+		uint32_t length = 0;
+		if (read(length) == false || size - pos <= length || m_buffer[pos + length] != '\0')
+			return false;
+		m_strings.emplace_back(pos);
+		pos += length + 1;
+	}
+
+	m_archetypes.resize(header.archetypeCount);
+	for (auto& archetype : m_archetypes)
+	{
+		uint32_t count = 0;
+		if (read(count) == false || (size - pos) / sizeof(uint32_t) < count)
+			return false;
+		archetype.reserve(count);
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			uint32_t name = 0;
+			read(name);
+			if (name >= m_strings.size())
+				return false;
+			archetype.emplace_back(getString(name));
+		}
+	}
+
+	m_objects.resize(header.objectCount);
+	int32_t previousOrder = 0;
+	for (auto& object : m_objects)
+	{
+		if (read(object.id) == false || read(object.order) == false || read(object.archetype) == false || read(object.offset) == false)
+			return false;
+		//the hierarchy only ever goes one level deeper at a time
+		if (object.archetype >= m_archetypes.size() || object.order < 1 || object.order > previousOrder + 1)
+			return false;
+		previousOrder = object.order;
+	}
+
+	if (size - pos != header.dataSize)
+		return false;
+	m_data = pos;
+	m_dataSize = header.dataSize;
+	for (const auto& object : m_objects)
+	{
+		if (object.offset > m_dataSize)
+			return false;
+		uint64_t valuePos = object.offset;
+		for (size_t i = 0; i < m_archetypes[object.archetype].size(); ++i)
+		{
+			if (skipValue(valuePos, 0) == false)
+				return false;
+		}
+	}
+	return true;
+}
+
+void SceneBinary::ReadComponents(const Object& object, std::vector<rapidjson::Value>& components, rapidjson::Value::AllocatorType& allocator) const
+{
+	const size_t count = m_archetypes[object.archetype].size();
+	components.clear();
+	components.resize(count);
+	uint64_t pos = object.offset;
+	for (size_t i = 0; i < count; ++i)
+		readValue(pos, components[i], allocator);
+}
+
+rapidjson::SizeType SceneBinary::getStringLength(uint32_t id) const
+{
+	uint32_t length = 0;
+	std::memcpy(&length, m_buffer.data() + m_strings[id] - sizeof(uint32_t), sizeof(uint32_t));
+	return length;
+}
+
+bool SceneBinary::skipValue(uint64_t& pos, int depth) const
+{
+	const char* data = m_buffer.data() + m_data;
+	auto skip = [&](uint64_t bytes)
+	{
+		if (m_dataSize - pos < bytes)
+			return false;
+		pos += bytes;
+		return true;
+	};
+	auto readU32 = [&](uint32_t& value)
+	{
+		if (m_dataSize - pos < sizeof(uint32_t))
+			return false;
+		std::memcpy(&value, data + pos, sizeof(uint32_t));
+		pos += sizeof(uint32_t);
+		return true;
+	};
+
+	if (depth > max_depth || m_dataSize - pos < sizeof(Tag))
+		return false;
+	Tag tag = static_cast<Tag>(data[pos++]);
+	uint32_t value = 0;
+	switch (tag)
+	{
+	case Tag::Null:
+	case Tag::False:
+	case Tag::True:
+		return true;
+	case Tag::Int32:
+	case Tag::Uint32:
+		return skip(sizeof(uint32_t));
+	case Tag::Int64:
+	case Tag::Uint64:
+	case Tag::Double:
+		return skip(sizeof(uint64_t));
+	case Tag::String:
+		return readU32(value) && value < m_strings.size();
+	case Tag::Array:
+		if (readU32(value) == false)
+			return false;
+		for (uint32_t i = 0; i < value; ++i)
+		{
+			if (skipValue(pos, depth + 1) == false)
+				return false;
+		}
+		return true;
+	case Tag::Object:
+		if (readU32(value) == false)
+			return false;
+		for (uint32_t i = 0; i < value; ++i)
+		{
+			uint32_t name = 0;
+			if (readU32(name) == false || name >= m_strings.size() || skipValue(pos, depth + 1) == false)
+				return false;
+		}
+		return true;
+	default:
+		return false;
+	}
+}
+
+void SceneBinary::readValue(uint64_t& pos, rapidjson::Value& value, rapidjson::Value::AllocatorType& allocator) const
+{
+	//only called on data Open has walked through already
+	const char* data = m_buffer.data() + m_data;
+	auto get = [&](auto& out)
+	{
+		std::memcpy(&out, data + pos, sizeof(out));
+		pos += sizeof(out);
+	};
+
+	Tag tag = static_cast<Tag>(data[pos++]);
+	switch (tag)
+	{
+	case Tag::Null:
+		value.SetNull();
+		break;
+	case Tag::False:
+		value.SetBool(false);
+		break;
+	case Tag::True:
+		value.SetBool(true);
+		break;
+	case Tag::Int32:
+	{
+		int32_t number;
+		get(number);
+		value.SetInt(number);
+		break;
+	}
+	case Tag::Uint32:
+	{
+		uint32_t number;
+		get(number);
+		value.SetUint(number);
+		break;
+	}
+	case Tag::Int64:
+	{
+		int64_t number;
+		get(number);
+		value.SetInt64(number);
+		break;
+	}
+	case Tag::Uint64:
+	{
+		uint64_t number;
+		get(number);
+		value.SetUint64(number);
+		break;
+	}
+	case Tag::Double:
+	{
+		double number;
+		get(number);
+		value.SetDouble(number);
+		break;
+	}
+	case Tag::String:
+	{
+		uint32_t id;
+		get(id);
+		value.SetString(rapidjson::StringRef(getString(id), getStringLength(id)));
+		break;
+	}
+	case Tag::Array:
+	{
+		uint32_t count;
+		get(count);
+		value.SetArray();
+		value.Reserve(count, allocator);
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			rapidjson::Value element;
+			readValue(pos, element, allocator);
+			value.PushBack(element, allocator);
+		}
+		break;
+	}
+	case Tag::Object:
+	{
+		uint32_t count;
+		get(count);
+		value.SetObject();
+		value.MemberReserve(count, allocator);
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			uint32_t id;
+			get(id);
+			rapidjson::Value name(rapidjson::StringRef(getString(id), getStringLength(id)));
+			rapidjson::Value member;
+			readValue(pos, member, allocator);
+			value.AddMember(name, member, allocator);
+		}
+		break;
+	}
+	}
+}
@@ -0,0 +1,100 @@
+/************************************************************************************//*!
+\file           SceneBinary.h
+\project        Editor
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Binary form of the scene files, written alongside the json the editor
+				saves so runtime builds can load scenes without parsing text.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include <rapidjson/document.h>
+
+/****************************************************************************************
+*
+* Binary Scene Layout
+*
+* 1) Header: stamped with the size, write time and hash of the json it was converted
+*    from, so a stale binary is never used in place of an edited scene.
+* 2) String table: every component name, member name and string value, stored once.
+* 3) Archetypes: the component names of each distinct set of components, objects with
+*    the same components share one, so component types are resolved once per archetype.
+* 4) Objects: in hierarchy order, each with its UUID, depth, archetype and data offset.
+* 5) Component data: tagged binary values grouped per archetype, decoded one object at
+*    a time straight into the rapidjson values the component loaders already take.
+*
+****************************************************************************************/
+class SceneBinary
+{
+public:
+	struct Object
+	{
+		uint64_t id;
+		int32_t order;		//same as the json "Order", the depth of the object
+		uint32_t archetype;
+		uint64_t offset;	//into the component data
+	};
+	using Archetype = std::vector<const char*>;
+
+	inline static constexpr const char* file_ext = "scenebin";
+	inline static constexpr uint32_t file_magic = 0x5342'4F4F; // "OOBS"
+	inline static constexpr uint32_t file_version = 1;
+
+	/*********************************************************************************//*!
+	\brief      Gets the path of the binary form of a scene file
+	*//**********************************************************************************/
+	static std::filesystem::path GetPath(const std::filesystem::path& scenePath);
+	/*********************************************************************************//*!
+	\brief      Writes the binary form of a scene file from its parsed json
+
+	\param      doc ==> the scene json, as saved by the serializer
+	\param      scenePath ==> the json file doc was parsed from, already on disk
+
+	\return     whether the file was written
+	*//**********************************************************************************/
+	static bool Write(const rapidjson::Document& doc, const std::filesystem::path& scenePath);
+	/*********************************************************************************//*!
+	\brief      Parses a scene file and writes its binary form
+	*//**********************************************************************************/
+	static bool Convert(const std::filesystem::path& scenePath);
+	/*********************************************************************************//*!
+	\brief      Checks if the binary form of a scene file exists and matches it
+	*//**********************************************************************************/
+	static bool IsCurrent(const std::filesystem::path& scenePath);
+
+	/*********************************************************************************//*!
+	\brief      Reads the binary form of a scene file, if it is valid and current.
+				Without the json (stripped builds) the binary is trusted as is.
+	*//**********************************************************************************/
+	bool Open(const std::filesystem::path& scenePath);
+
+	const std::vector<Object>& GetObjects() const { return m_objects; }
+	const Archetype& GetArchetype(uint32_t index) const { return m_archetypes[index]; }
+	size_t GetArchetypeCount() const { return m_archetypes.size(); }
+	/*********************************************************************************//*!
+	\brief      Decodes the components of one object, one value per archetype component.
+				Strings reference this reader, which must outlive the values.
+	*//**********************************************************************************/
+	void ReadComponents(const Object& object, std::vector<rapidjson::Value>& components, rapidjson::Value::AllocatorType& allocator) const;
+private:
+	const char* getString(uint32_t id) const { return m_buffer.data() + m_strings[id]; }
+	rapidjson::SizeType getStringLength(uint32_t id) const;
+	bool skipValue(uint64_t& pos, int depth) const;
+	void readValue(uint64_t& pos, rapidjson::Value& value, rapidjson::Value::AllocatorType& allocator) const;
+
+	std::vector<char> m_buffer;
+	std::vector<uint64_t> m_strings;	//offsets into the buffer, each followed by its length
+	std::vector<Archetype> m_archetypes;
+	std::vector<Object> m_objects;
+	uint64_t m_data = 0;				//offset of the component data in the buffer
+	uint64_t m_dataSize = 0;
+};
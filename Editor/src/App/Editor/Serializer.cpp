@@ -105,6 +105,7 @@ void Serializer::Init()
 #endif // OO_EDITOR
 
 
+	load_component_hashes.emplace(rttr::type::get<oo::ScriptComponent>().get_id(), Ecs::ECSWorld::get_component_hash<oo::ScriptComponent>());
 	load_components.emplace(rttr::type::get<oo::ScriptComponent>().get_id(),
 		[](oo::GameObject& go, rapidjson::Value&& v)
 		{
@@ -149,6 +150,9 @@ void Serializer::SaveScene(oo::Scene& scene)
 		doc.Accept(writer);
 		ofs.close();
 	}
+	//converted from what was just written so both forms load the same
+	if (SceneBinary::Convert(scene.GetFilePath()) == false)
+		WarningMessage::DisplayWarning(WarningMessage::DisplayType::DISPLAY_WARNING, "Binary scene not written");
 	WarningMessage::DisplayWarning(WarningMessage::DisplayType::DISPLAY_LOG, "Scene Saved");
 
 	//save assets into another file
@@ -160,6 +164,17 @@ void Serializer::LoadScene(oo::Scene& scene)
 	//preload all assets
 	//LoadAssetsList(scene);
 
+#if OO_EXECUTABLE
+	//runtime builds skip parsing the json whenever its binary form is current
+	{
+		SceneBinary binary;
+		if (binary.Open(scene.GetFilePath()))
+		{
+			LoadingBinary(scene.GetRoot(), scene, binary);
+			return;
+		}
+	}
+#endif
 	std::ifstream ifs(scene.GetFilePath());
 	if (ifs.peek() == std::ifstream::traits_type::eof())
 	{
@@ -169,8 +184,13 @@ void Serializer::LoadScene(oo::Scene& scene)
 	rapidjson::IStreamWrapper isw(ifs);
 	rapidjson::Document doc;
 	doc.ParseStream(isw);
-	Loading(scene.GetRoot(),scene,doc);
 	ifs.close();
+#if OO_EDITOR
+	//scenes edited outside the editor or never saved since are converted here, before loading moves the values out
+	if (SceneBinary::IsCurrent(scene.GetFilePath()) == false)
+		SceneBinary::Write(doc, scene.GetFilePath());
+#endif
+	Loading(scene.GetRoot(),scene,doc);
 }
 
 oo::AssetManager::LoadProgressPtr Serializer::PreloadScene(const oo::Scene& scene)
@@ -279,10 +299,12 @@ std::vector<oo::UUID> Serializer::LoadObjectsFromString(std::string& data, oo::U
 	oo::UUID firstobj;
 	std::stack<std::shared_ptr<oo::GameObject>> parents;
 	std::vector<std::shared_ptr<oo::GameObject>> second_iter;
+	auto spawned = scene.CreateGameObjectsImmediate(doc.MemberCount());
+	size_t next_spawned = 0;
 	parents.push(starting);
 	for (auto iter = doc.MemberBegin(); iter != doc.MemberEnd(); ++iter)
 	{
-		auto go = scene.CreateGameObjectImmediate();
+		auto go = spawned[next_spawned++];
 
 		auto members = iter->value.MemberBegin();//get the order of hierarchy
 		auto membersEnd = iter->value.MemberEnd();
@@ -676,6 +698,39 @@ void Serializer::SavePrefabObject_SubValues(rapidjson::Value& current,const rapi
 	}
 }
 
+void Serializer::SaveFields(const SerializerPlan& plan, rttr::instance obj, rapidjson::Value& val, rapidjson::Document& doc)
+{
+	for (const auto& field : plan.fields)
+	{
+		switch (field.kind)
+		{
+		case SerializerPlan::Kind::VALUE:
+		{
+			rapidjson::Value data;
+			field.save(field.property.get_value(obj), data, doc.GetAllocator());
+			rapidjson::Value name;
+			name.SetString(field.name.c_str(), static_cast<rapidjson::SizeType>(field.name.size()), doc.GetAllocator());
+			val.AddMember(name, data, doc.GetAllocator());
+			break;
+		}
+		case SerializerPlan::Kind::ENUMERATION:
+		{
+			//saves all enum data as int
+			rapidjson::Value name;
+			name.SetString(field.name.c_str(), static_cast<rapidjson::SizeType>(field.name.size()), doc.GetAllocator());
+			val.AddMember(name, rapidjson::Value(field.property.get_value(obj).to_int()), doc.GetAllocator());
+			break;
+		}
+		case SerializerPlan::Kind::SEQUENTIAL:
+			SaveSequentialContainer(field.property.get_value(obj), val, field.property, doc);
+			break;
+		case SerializerPlan::Kind::NESTED:
+			SaveNestedComponent(field.property.get_value(obj), val, field.property, doc);
+			break;
+		}
+	}
+}
+
 void Serializer::SaveSequentialContainer(rttr::variant variant, rapidjson::Value& val, rttr::property prop,rapidjson::Document& doc)
 {
 	rapidjson::Value arrayValue(rapidjson::kObjectType);
@@ -789,11 +844,17 @@ oo::UUID Serializer::Loading(std::shared_ptr<oo::GameObject> starting, oo::Scene
 	oo::UUID firstobj;
 	std::stack<std::shared_ptr<oo::GameObject>> parents;
 	std::vector<std::shared_ptr<oo::GameObject>> second_iter;
+	std::vector<oo::UUID> ids;
+	ids.reserve(doc.MemberCount());
+	for (auto iter = doc.MemberBegin(); iter != doc.MemberEnd(); ++iter)
+		ids.emplace_back(std::stoull(iter->name.GetString()));
+	auto spawned = scene.CreateGameObjectsImmediate(ids);
+
 	parents.push(starting);
+	size_t next_spawned = 0;
 	for (auto iter = doc.MemberBegin(); iter != doc.MemberEnd(); ++iter)
 	{
-		uint64_t id = std::stoull(iter->name.GetString());
-		auto go = scene.CreateGameObjectImmediate(id);
+		auto go = spawned[next_spawned++];
 		auto members = iter->value.MemberBegin();//get the order of hierarchy
 		int order = members->value.GetInt();
 
@@ -830,8 +891,98 @@ oo::UUID Serializer::Loading(std::shared_ptr<oo::GameObject> starting, oo::Scene
 	return firstobj;
 }
 
+oo::UUID Serializer::LoadingBinary(std::shared_ptr<oo::GameObject> starting, oo::Scene& scene, const SceneBinary& binary)
+{
+	const auto& objects = binary.GetObjects();
+	if (objects.empty())
+		return oo::UUID{};
+
+	std::vector<oo::UUID> ids;
+	ids.reserve(objects.size());
+	for (const auto& object : objects)
+		ids.emplace_back(object.id);
+	auto spawned = scene.CreateGameObjectsImmediate(ids);
+
+	//same hierarchy rebuild as Loading
+	std::stack<std::shared_ptr<oo::GameObject>> parents;
+	parents.push(starting);
+	for (size_t i = 0; i < objects.size(); ++i)
+	{
+		auto& go = spawned[i];
+		while (objects[i].order != parents.size())
+			parents.pop();
+
+		parents.top()->AddChild(*go, true);
+		parents.push(go);
+	}
+
+	scene.GetWorld().Get_System<oo::TransformSystem>()->UpdateSubTree(*starting, false);
+
+	//component types are looked up once per archetype instead of once per object
+	struct ArchetypeLoad
+	{
+		std::vector<uint64_t> component_hashes;
+		std::vector<const std::function<void(oo::GameObject&, rapidjson::Value&&)>*> loaders;
+	};
+	std::vector<ArchetypeLoad> archetypes(binary.GetArchetypeCount());
+	for (uint32_t a = 0; a < archetypes.size(); ++a)
+	{
+		for (const char* name : binary.GetArchetype(a))
+		{
+			const std::function<void(oo::GameObject&, rapidjson::Value&&)>* loader = nullptr;
+			rttr::type t = rttr::type::get_by_name(name);
+			if (t.is_valid())
+			{
+				auto hash_iter = load_component_hashes.find(t.get_id());
+				if (hash_iter != load_component_hashes.end())
+					archetypes[a].component_hashes.emplace_back(hash_iter->second);
+				auto lc_iter = load_components.find(t.get_id());
+				if (lc_iter != load_components.end())
+					loader = &lc_iter->second;
+			}
+			archetypes[a].loaders.emplace_back(loader);
+		}
+	}
+
+	//each object is decoded on its own, so only one object's values are held at a time
+	rapidjson::Value::AllocatorType allocator;
+	std::vector<rapidjson::Value> components;
+	for (size_t i = 0; i < objects.size(); ++i)
+	{
+		auto& go = *spawned[i];
+		const ArchetypeLoad& archetype = archetypes[objects[i].archetype];
+		if (archetype.component_hashes.empty() == false)
+			go.EnsureComponents(archetype.component_hashes);
+
+		binary.ReadComponents(objects[i], components, allocator);
+		for (size_t c = 0; c < components.size(); ++c)
+		{
+			if (archetype.loaders[c])
+				(*archetype.loaders[c])(go, std::move(components[c]));
+		}
+		components.clear();
+		allocator.Clear();
+	}
+
+	return spawned.front()->GetInstanceID();
+}
+
 void Serializer::LoadObject(oo::GameObject& go, rapidjson::Value::MemberIterator& iter , rapidjson::Value::MemberIterator& end)
 {
+	//add every component up front so the entity changes archetype once instead of once per component
+	std::vector<uint64_t> component_hashes;
+	for (auto it = iter; it != end; ++it)
+	{
+		rttr::type t = rttr::type::get_by_name(it->name.GetString());
+		if (t.is_valid() == false)
+			continue;
+		auto hash_iter = load_component_hashes.find(t.get_id());
+		if (hash_iter != load_component_hashes.end())
+			component_hashes.emplace_back(hash_iter->second);
+	}
+	if (component_hashes.empty() == false)
+		go.EnsureComponents(component_hashes);
+
 	for (; iter != end; ++iter)
 	{
 		rttr::type t = rttr::type::get_by_name(iter->name.GetString());
@@ -844,6 +995,47 @@ void Serializer::LoadObject(oo::GameObject& go, rapidjson::Value::MemberIterator
 	}
 }
 
+void Serializer::LoadFields(const SerializerPlan& plan, rttr::instance obj, rapidjson::Value& val)
+{
+	size_t hint = 0;
+	for (auto iter = val.MemberBegin(); iter != val.MemberEnd(); ++iter)
+	{
+		const SerializerPlan::Field* field = plan.Find(iter->name.GetString(), hint);
+		if (field == nullptr)
+			continue;//not saved by this component
+
+		const rttr::property& prop = field->property;
+		switch (field->kind)
+		{
+		case SerializerPlan::Kind::VALUE:
+			field->load(prop, obj, iter->value);
+			break;
+		case SerializerPlan::Kind::ENUMERATION:
+		{
+			//saves all enum data as int
+			rttr::variant enum_data = iter->value.GetInt();
+			rttr::enumeration enuma = prop.get_type().get_enumeration();
+			prop.set_value(obj, enuma.name_to_value(enuma.value_to_name(enum_data)));
+			break;
+		}
+		case SerializerPlan::Kind::SEQUENTIAL:
+		{
+			rttr::variant v = prop.get_value(obj);
+			LoadSequentialContainer(v, iter->value);
+			prop.set_value(obj, v);
+			break;
+		}
+		case SerializerPlan::Kind::NESTED:
+		{
+			rttr::variant variant = prop.get_value(obj);
+			LoadNestedComponent(variant, iter->value);
+			prop.set_value(obj, variant);
+			break;
+		}
+		}
+	}
+}
+
 void Serializer::LoadSequentialContainer(rttr::variant& variant, rapidjson::Value& val)
 {
 	rttr::variant_sequential_view sqv = variant.create_sequential_view();
@@ -910,6 +1102,14 @@ void Serializer::LoadNestedComponent(rttr::variant& variant, rapidjson::Value& v
 }
 
 
+const SerializerPlan& Serializer::GetPlan(rttr::type type)
+{
+	auto iter = component_plans.find(type.get_id());
+	if (iter == component_plans.end())
+		iter = component_plans.emplace(type.get_id(), type).first;
+	return iter->second;
+}
+
 oo::UUID Serializer::CreatePrefab(std::shared_ptr<oo::GameObject> starting, oo::Scene& scene, std::filesystem::path& p)
 {
 	oo::UUID firstobj;
@@ -940,6 +1140,9 @@ oo::UUID Serializer::CreatePrefab(std::shared_ptr<oo::GameObject> starting, oo::
 	std::stack<std::shared_ptr<oo::GameObject>> parents;
 	std::shared_ptr<oo::GameObject> gameobj = go;
 	std::vector<std::shared_ptr<oo::GameObject>> second_iter;
+	//the rest of the prefab's objects are created in one batch
+	auto spawned = scene.CreateGameObjectsImmediate(document.MemberCount() > 0 ? document.MemberCount() - 1 : 0);
+	size_t next_spawned = 0;
 	parents.push(gameobj);
 	for (auto iter = document.MemberBegin(); iter != document.MemberEnd();)
 	{
@@ -964,7 +1167,7 @@ oo::UUID Serializer::CreatePrefab(std::shared_ptr<oo::GameObject> starting, oo::
 		++iter;
 		if (iter != document.MemberEnd())
 		{
-			gameobj = scene.CreateGameObjectImmediate();
+			gameobj = spawned[next_spawned++];
 		}
 
 	}
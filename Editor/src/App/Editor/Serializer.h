@@ -45,6 +45,8 @@ Technology is prohibited.
 
 #include "App/Editor/Properties/SerializerProperties.h"
 #include "App/Editor/Properties/SerializerScriptingProperties.h"
+#include "App/Editor/Properties/SerializerPlan.h"
+#include "App/Editor/SceneBinary.h"
 #include "Project.h"
 class Serializer
 {
@@ -106,15 +108,18 @@ private:
 
 	template <typename Component>
 	static void SaveComponent(oo::GameObject& go, rapidjson::Value& val, rapidjson::Document& doc);
+	static void SaveFields(const SerializerPlan& plan, rttr::instance obj, rapidjson::Value& val, rapidjson::Document& doc);
 	static void SaveSequentialContainer(rttr::variant variant, rapidjson::Value& val, rttr::property prop,rapidjson::Document& doc);
 	static void SaveNestedComponent(rttr::variant var, rapidjson::Value& val, rttr::property prop,rapidjson::Document& doc);
 	//for saving 1 variant
 	static void SaveVariant(rttr::type t,rttr::property prop, rttr::variant v, rapidjson::Value& val, rapidjson::Document& doc);
 	//loading
 	static oo::UUID Loading(std::shared_ptr<oo::GameObject> starting, oo::Scene& scene,rapidjson::Document & doc);
+	static oo::UUID LoadingBinary(std::shared_ptr<oo::GameObject> starting, oo::Scene& scene, const SceneBinary& binary);
 	static void LoadObject(oo::GameObject& go, rapidjson::Value::MemberIterator& iter, rapidjson::Value::MemberIterator& end);
 	template <typename Component>
 	static void LoadComponent(oo::GameObject& go, rapidjson::Value&& val);
+	static void LoadFields(const SerializerPlan& plan, rttr::instance obj, rapidjson::Value& val);
 	static void LoadSequentialContainer(rttr::variant& variant, rapidjson::Value& val);
 	static void LoadNestedComponent(rttr::variant& variant, rapidjson::Value& val);
 
@@ -130,6 +135,11 @@ private:
 protected://serialzation helpers
 	template <typename Component>
 	static void AddLoadComponent() noexcept;
+	/*********************************************************************************//*!
+	\brief      Gets the serialization plan of a component type, building it if the
+				type was not registered through AddLoadComponent
+	*//**********************************************************************************/
+	static const SerializerPlan& GetPlan(rttr::type type);
 private:
 	//the function requires the user to insert the variant into the value manually
 	//saving
@@ -137,6 +147,10 @@ private:
 	inline static SerializerScriptingSaveProperties m_saveScriptProperties;
 	//loading
 	inline static std::unordered_map < rttr::type::type_id, std::function<void(oo::GameObject&, rapidjson::Value&&)>> load_components;
+	//ecs component hash of each loadable component, used to add them all before loading
+	inline static std::unordered_map < rttr::type::type_id, uint64_t> load_component_hashes;
+	//fields of each component with their codecs, built when the component is registered
+	inline static std::unordered_map < rttr::type::type_id, SerializerPlan> component_plans;
 	inline static SerializerLoadProperties m_LoadProperties;
 	inline static SerializerScriptingLoadProperties m_loadScriptProperties;
 	inline static constexpr int rapidjson_precision = 4;
@@ -162,47 +176,11 @@ inline void Serializer::SaveComponent(oo::GameObject& go, rapidjson::Value& val,
 	if (go.HasComponent<Component>() == false)
 		return;
 	rapidjson::Value v(rapidjson::kObjectType);
-	v.SetObject();
 	Component& component = go.GetComponent<Component>();
-	rttr::type type = component.get_type();
-	for (auto& prop : type.get_properties())
-	{
-		if (prop.is_readonly())
-			continue;
-		auto prop_type = prop.get_type();
-		auto iter = UI_RTTRType::types.find(prop_type.get_id());
-		if (iter == UI_RTTRType::types.end())
-		{
-			if (prop_type.is_sequential_container())
-			{
-				rttr::variant variant = prop.get_value(component);
-				SaveSequentialContainer(variant, v, prop,doc);
-			}
-			else if (prop_type.is_class())
-			{
-				rttr::variant component_variant = prop.get_value(component);
-				SaveNestedComponent(component_variant, v, prop,doc);
-			}
-			else if (prop_type.is_enumeration())
-			{
-				rttr::variant enum_data = prop.get_value(component);
-				//rttr::enumeration enuma = prop_type.get_enumeration();
-				//std::string value = enuma.value_to_name(enum_data);
-				int value = enum_data.to_int();
-				//saves all enum data as int
-				auto rttrType = UI_RTTRType::types.find(rttr::type::get<int>().get_id());
-				m_SaveProperties.m_save_commands.find(rttrType->second)->second(doc,v,value,prop);
-			}
-			continue;//not supported
-		}
-		auto sf = m_SaveProperties.m_save_commands.find(iter->second);
-		if (sf == m_SaveProperties.m_save_commands.end())
-			continue;//don't have this save function
-		sf->second(doc,v,prop.get_value(component),prop);
-	}
-	std::string temp = type.get_name().data();
+	const SerializerPlan& plan = GetPlan(rttr::type::get<Component>());
+	SaveFields(plan, component, v, doc);
 	rapidjson::Value name;
-	name.SetString(temp.c_str(), static_cast<rapidjson::SizeType>(temp.size()),doc.GetAllocator());
+	name.SetString(plan.name.c_str(), static_cast<rapidjson::SizeType>(plan.name.size()), doc.GetAllocator());
 	val.AddMember(name , v, doc.GetAllocator());
 }
 
@@ -216,47 +194,7 @@ inline void Serializer::LoadComponent(oo::GameObject& go, rapidjson::Value&& val
 		WarningMessage::DisplayWarning(WarningMessage::DisplayType::DISPLAY_ERROR, msg);
 	}
 	Component& component = go.GetComponent<Component>();
-	for (auto iter = val.MemberBegin(); iter != val.MemberEnd(); ++iter)
-	{
-		rttr::type t = component.get_type();
-		rttr::property prop = t.get_property(iter->name.GetString());
-		if (prop.is_valid() == false)
-			continue;
-		
-		auto types_UI = UI_RTTRType::types.find(prop.get_type().get_id());
-		if (types_UI == UI_RTTRType::types.end())
-		{
-			rttr::type prop_type = prop.get_type();
-			if (prop_type.is_sequential_container())
-			{
-				rttr::variant v = prop.get_value(component);
-				LoadSequentialContainer(v, iter->value);
-				prop.set_value(component, v);
-			}
-			if (prop_type.is_class())
-			{
-				rttr::variant variant = prop.get_value(component);
-				LoadNestedComponent(variant, iter->value);
-				prop.set_value(component, variant);
-			}
-			else if (prop_type.is_enumeration())
-			{
-				rttr::variant enum_data = prop.get_value(component);
-				//saves all enum data as int
-				auto rttrType = UI_RTTRType::types.find(rttr::type::get<int>().get_id());
-				m_LoadProperties.m_load_commands.find(rttrType->second)->second(enum_data, std::move(iter->value));
-				rttr::enumeration enuma = prop_type.get_enumeration();		
-				prop.set_value(component, enuma.name_to_value(enuma.value_to_name(enum_data)));
-			}
-			continue;//not supported
-		}
-		auto command = m_LoadProperties.m_load_commands.find(types_UI->second);
-		if (command == m_LoadProperties.m_load_commands.end())
-			continue;//don't have this save function
-		rttr::variant v;
-		command->second(v, std::move(iter->value));
-		prop.set_value(component, v);
-	}
+	LoadFields(GetPlan(rttr::type::get<Component>()), component, val);
 }
 template<typename Component>
 inline void Serializer::LoadVariant(oo::GameObject& go, rttr::variant& var, rttr::property& prop, rapidjson::Document& doc)
@@ -333,6 +271,9 @@ inline void Serializer::LoadComponent<oo::PrefabComponent>(oo::GameObject& go, r
 	std::stack<std::shared_ptr<oo::GameObject>> parents;
 	std::shared_ptr<oo::GameObject> gameobj = scene->FindWithInstanceID(go.GetInstanceID());
 	std::vector<std::shared_ptr<oo::GameObject>> second_iter;
+	//the rest of the prefab's objects are created in one batch
+	auto spawned = scene->CreateGameObjectsImmediate(document.MemberCount() > 0 ? document.MemberCount() - 1 : 0);
+	size_t next_spawned = 0;
 	parents.push(gameobj);
 	for (auto iter = document.MemberBegin(); iter != document.MemberEnd();)
 	{
@@ -357,7 +298,7 @@ inline void Serializer::LoadComponent<oo::PrefabComponent>(oo::GameObject& go, r
 		++iter;
 		if (iter != document.MemberEnd())
 		{
-			gameobj = scene->CreateGameObjectImmediate();
+			gameobj = spawned[next_spawned++];
 		}
 
 	}
@@ -394,6 +335,8 @@ inline void Serializer::LoadComponent<oo::PrefabComponent>(oo::GameObject& go, r
 template<typename Component>
 inline void Serializer::AddLoadComponent() noexcept
 {
+	component_plans.emplace(rttr::type::get<Component>().get_id(), rttr::type::get<Component>());
+	load_component_hashes.emplace(rttr::type::get<Component>().get_id(), Ecs::ECSWorld::get_component_hash<Component>());
 	load_components.emplace(rttr::type::get<Component>().get_id(),
 		[](oo::GameObject& go, rapidjson::Value&& v) 
 		{
@@ -405,6 +348,8 @@ inline void Serializer::AddLoadComponent() noexcept
 template <>
 inline void Serializer::AddLoadComponent<oo::PrefabComponent>() noexcept
 {
+	component_plans.emplace(rttr::type::get<oo::PrefabComponent>().get_id(), rttr::type::get<oo::PrefabComponent>());
+	load_component_hashes.emplace(rttr::type::get<oo::PrefabComponent>().get_id(), Ecs::ECSWorld::get_component_hash<oo::PrefabComponent>());
 	load_components.emplace(rttr::type::get<oo::PrefabComponent>().get_id(),
 		[](oo::GameObject& go, rapidjson::Value&& v)
 		{
@@ -531,7 +531,7 @@ void FileBrowser::BuildDirectoryList(const std::string& path)
 	
 	for (auto& directory : list)
 	{
-		if (directory.extension() == oo::Asset::EXT_META)
+		if (directory.extension() == oo::Asset::EXT_META || directory.extension() == oo::Asset::EXT_COOKED)
 		{
 			continue;
 		}
@@ -655,6 +655,9 @@ bool FileBrowser::RenameFilePopup(DirectoryInfo& info)
 
 			std::filesystem::rename(oldAssetPath, newAssetPath);
 			std::filesystem::rename(oldMetaPath, newMetaPath);
+			//cooked models follow their source, missing ones are simply cooked again
+			std::error_code ec;
+			std::filesystem::rename(std::filesystem::path{ oldAssetPath } += oo::Asset::EXT_COOKED, std::filesystem::path{ newAssetPath } += oo::Asset::EXT_COOKED, ec);
 			ImGui::CloseCurrentPopup();
 
 			Project::GetAssetManager()->Scan();
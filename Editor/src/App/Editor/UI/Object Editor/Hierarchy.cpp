@@ -313,6 +313,7 @@ void Hierarchy::SwappingUI(scenenode& node, bool setbelow)
 				auto source = scene->FindWithInstanceID(m_dragged);
 				oo::CommandStackManager::AddCommand(new oo::Ordering_ActionCommand(source, node.get_handle(), true));
 				source->GetSceneNode().lock()->move_to_after(node.shared_from_this());
+				scene->MarkHierarchyChanged(*source);
 			}
 			else
 			{
@@ -321,6 +322,7 @@ void Hierarchy::SwappingUI(scenenode& node, bool setbelow)
 				auto source = scene->FindWithInstanceID(m_dragged);
 				oo::CommandStackManager::AddCommand(new oo::Ordering_ActionCommand(source, node.get_handle(), false));
 				source->GetSceneNode().lock()->move_to(node.shared_from_this());
+				scene->MarkHierarchyChanged(*source);
 			}
 
 		}
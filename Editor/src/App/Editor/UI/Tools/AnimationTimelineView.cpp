@@ -20,6 +20,7 @@ Technology is prohibited.
 #include "App/Editor/UI/Object Editor/Hierarchy.h"
 #include "App/Editor/Utility/ImGuiManager.h"
 #include "Ouroboros/Animation/AnimationSystem.h"
+#include "Ouroboros/Animation/AnimationInternal.h"
 
 
 void AnimationTimelineView::Show()
@@ -475,6 +476,7 @@ void AnimationTimelineView::DrawToolbar(oo::AnimationComponent* _animator)
                     if (currentTime == animation->timelines[i].keyframes[j].time)
                     {
                         animation->timelines[i].keyframes.erase(animation->timelines[i].keyframes.begin() + j);
+                        oo::Anim::internal::BakeKeyFrameChannel(animation->timelines[i]);
                     }
                 }
             }
@@ -871,7 +873,8 @@ void AnimationTimelineView::DisplayInspector()
         {
             ImGui::Text("Time: ");
             ImGui::SameLine();
-            ImGui::DragFloat("##keyframetime", &keyframe->time, unitPerFrame);
+            if (ImGui::DragFloat("##keyframetime", &keyframe->time, unitPerFrame) && timeline != nullptr)
+                oo::Anim::internal::BakeKeyFrameChannel(*timeline);
             if (currentTime == keyframe->time)
             {
                 if (timeline != nullptr)
@@ -879,9 +882,12 @@ void AnimationTimelineView::DisplayInspector()
                     if (timeline->datatype == oo::Anim::Timeline::DATATYPE::VEC3)
                     {
                         //draw the property editor
-                        ImGui::DragFloat("X", &keyframe->data.get_value<glm::vec3>().x);
-                        ImGui::DragFloat("Y", &keyframe->data.get_value<glm::vec3>().y);
-                        ImGui::DragFloat("Z", &keyframe->data.get_value<glm::vec3>().z);
+                        bool changed = ImGui::DragFloat("X", &keyframe->data.get_value<glm::vec3>().x);
+                        changed |= ImGui::DragFloat("Y", &keyframe->data.get_value<glm::vec3>().y);
+                        changed |= ImGui::DragFloat("Z", &keyframe->data.get_value<glm::vec3>().z);
+                        //playback samples the baked channel, not the keyframes
+                        if (changed)
+                            oo::Anim::internal::BakeKeyFrameChannel(*timeline);
 
                         //need to support applying to child object
                         timeline->rttr_property.set_value(source_go.get()->GetComponent<oo::TransformComponent>(),
@@ -31,6 +31,7 @@ Technology is prohibited.
 #include "Testing/TestLayers/MainDebugLayer.h"
 #include "Testing/TestLayers/AssetDebugLayer.h"
 #include "Testing/TestLayers/FPSDisplayLayer.h"
+#include "Testing/TestLayers/EngineTestLayer.h"
 
 // Core Essential Layers
 #include "App/CoreLayers/SceneLayer.h"
@@ -90,6 +91,11 @@ public:
 #ifdef OO_EDITOR
         //m_layerset.PushLayer(std::make_shared<MainDebugLayer>());     //menu to test various debug scenes
         m_layerset.PushLayer(std::make_shared<FPSDisplayLayer>());      //FPS display counter
+        for (int i = 1; i < args.Count; ++i)
+        {
+            if (std::string_view{ args[i] } == "--run-tests")
+                m_layerset.PushLayer(std::make_shared<EngineTestLayer>());  //engine tests, once a project loads
+        }
 #endif
         // Main Layers
         // Scripting Layer
@@ -18,6 +18,9 @@ Technology is prohibited.
 
 #include "Ouroboros/Scripting/ScriptValue.h"
 #include "Ouroboros/Physics/ColliderComponents.h"
+#include "Ouroboros/Physics/RigidbodyComponent.h"
+#include "Ouroboros/Physics/ConvexVertexTransform.h"
+#include "Ouroboros/Transform/TransformComponent.h"
 
 namespace oo
 {
@@ -108,6 +111,8 @@ namespace oo
     {
         std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
         ConvexColliderComponent& component = obj->GetComponent<ConvexColliderComponent>();
+        // debug drawing may be off, so they are brought up to date here too
+        UpdateConvexWorldVertices(component, obj->GetComponent<RigidbodyComponent>(), obj->GetComponent<TransformComponent>().GetGlobalMatrix());
         return ConvertVerticeArray(component.WorldSpaceVertices);
     }
 }
\ No newline at end of file
@@ -337,4 +337,112 @@ namespace oo
             return ScriptDatabase::InvalidPtr;
         return mono_gchandle_new(CreateRaycastHit(result), false);
     }
+
+    // Batched queries, C# passes arrays of these blittable structs (see Physics.cs) and gets its results
+    // written back into the arrays it owns
+    struct ScriptRaycastQuery
+    {
+        ScriptValue::vec3_type origin;
+        ScriptValue::vec3_type direction;
+        float maxDistance;
+        uint layerMask;
+    };
+
+    struct ScriptShapeQuery
+    {
+        int shape;
+        ScriptValue::vec3_type center;
+        ScriptValue::vec3_type eulerAngles;
+        ScriptValue::vec3_type halfExtents;
+        float radius;
+        float halfHeight;
+        ScriptValue::vec3_type direction;
+        float maxDistance;
+        uint layerMask;
+    };
+
+    struct ScriptQueryHit
+    {
+        UUID::value_type instanceID;
+        ScriptValue::vec3_type point;
+        ScriptValue::vec3_type normal;
+        float distance;
+        int hit;
+    };
+
+    ShapeQuery ToShapeQuery(ScriptShapeQuery const& query)
+    {
+        ShapeQuery result;
+        result.Shape = static_cast<QueryShape>(query.shape);
+        result.Position = query.center;
+        result.Orientation = glm::quat{ glm::radians(static_cast<glm::vec3>(query.eulerAngles)) };
+        result.HalfExtents = query.halfExtents;
+        result.Radius = query.radius;
+        result.HalfHeight = query.halfHeight;
+        result.Direction = query.direction;
+        result.Distance = query.maxDistance;
+        result.Filter = query.layerMask;
+        return result;
+    }
+
+    void FillQueryHits(std::vector<RaycastResult> const& results, ScriptQueryHit* hits)
+    {
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            RaycastResult const& result = results[i];
+            hits[i] = ScriptQueryHit{ result.UUID.GetUUID()
+                , { result.Position.x, result.Position.y, result.Position.z }
+                , { result.Normal.x, result.Normal.y, result.Normal.z }
+                , result.Distance
+                , result.Intersect ? 1 : 0 };
+        }
+    }
+
+    SCRIPT_API void Physics_RaycastBatch(ScriptRaycastQuery* queries, ScriptQueryHit* hits, int count)
+    {
+        PhysicsSystem* ps = ScriptManager::s_SceneManager->GetActiveScene<Scene>()->GetWorld().Get_System<PhysicsSystem>();
+
+        static std::vector<RaycastQuery> batch;
+        static std::vector<RaycastResult> results;
+        batch.resize(static_cast<size_t>(std::max(count, 0)));
+        results.assign(batch.size(), RaycastResult{});
+
+        for (size_t i = 0; i < batch.size(); ++i)
+            batch[i] = RaycastQuery{ oo::Ray{ queries[i].origin, queries[i].direction }, queries[i].maxDistance, queries[i].layerMask };
+
+        ps->RaycastBatch(batch, results);
+        FillQueryHits(results, hits);
+    }
+
+    SCRIPT_API void Physics_SweepBatch(ScriptShapeQuery* queries, ScriptQueryHit* hits, int count)
+    {
+        PhysicsSystem* ps = ScriptManager::s_SceneManager->GetActiveScene<Scene>()->GetWorld().Get_System<PhysicsSystem>();
+
+        static std::vector<ShapeQuery> batch;
+        static std::vector<RaycastResult> results;
+        batch.resize(static_cast<size_t>(std::max(count, 0)));
+        results.assign(batch.size(), RaycastResult{});
+
+        for (size_t i = 0; i < batch.size(); ++i)
+            batch[i] = ToShapeQuery(queries[i]);
+
+        ps->SweepBatch(batch, results);
+        FillQueryHits(results, hits);
+    }
+
+    SCRIPT_API void Physics_OverlapBatch(ScriptShapeQuery* queries, int count, UUID::value_type* hits, int maxHitsPerQuery, uint* hitCounts)
+    {
+        PhysicsSystem* ps = ScriptManager::s_SceneManager->GetActiveScene<Scene>()->GetWorld().Get_System<PhysicsSystem>();
+
+        static std::vector<ShapeQuery> batch;
+        batch.resize(static_cast<size_t>(std::max(count, 0)));
+        size_t const maxHits = static_cast<size_t>(std::max(maxHitsPerQuery, 0));
+
+        for (size_t i = 0; i < batch.size(); ++i)
+            batch[i] = ToShapeQuery(queries[i]);
+
+        // oo::UUID only wraps its value, so the script's id array can be written to directly
+        static_assert(sizeof(UUID) == sizeof(UUID::value_type));
+        ps->OverlapBatch(batch, std::span<UUID>{ reinterpret_cast<UUID*>(hits), batch.size() * maxHits }, maxHits, std::span<std::uint32_t>{ hitCounts, batch.size() });
+    }
 }
\ No newline at end of file
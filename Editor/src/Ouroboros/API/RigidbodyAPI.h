@@ -37,8 +37,7 @@ namespace oo
 
     SCRIPT_API void RigidbodyComponent_GetOffset(Scene::ID_type sceneID, UUID uuid, float* x, float* y, float* z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        RigidbodyComponent& component = obj->GetComponent<RigidbodyComponent>();
+        RigidbodyComponent& component = ScriptComponentCache<RigidbodyComponent>::GetComponent(sceneID, uuid);
         glm::vec3 vec3 = component.Offset;
         *x = vec3.x;
         *y = vec3.y;
@@ -47,8 +46,7 @@ namespace oo
 
     SCRIPT_API void RigidbodyComponent_SetOffset(Scene::ID_type sceneID, UUID uuid, float x, float y, float z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        RigidbodyComponent& component = obj->GetComponent<RigidbodyComponent>();
+        RigidbodyComponent& component = ScriptComponentCache<RigidbodyComponent>::GetComponent(sceneID, uuid);
         component.Offset = glm::vec3({ x, y, z });
     }
 
@@ -61,8 +59,7 @@ namespace oo
 
     SCRIPT_API void Rigidbody_GetVelocity(Scene::ID_type sceneID, UUID uuid, float* x, float* y, float* z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        RigidbodyComponent& component = obj->GetComponent<RigidbodyComponent>();
+        RigidbodyComponent& component = ScriptComponentCache<RigidbodyComponent>::GetComponent(sceneID, uuid);
         glm::vec3 vec3 = component.GetLinearVelocity();
         *x = vec3.x;
         *y = vec3.y;
@@ -71,36 +68,31 @@ namespace oo
 
     SCRIPT_API void Rigidbody_SetVelocity(Scene::ID_type sceneID, UUID uuid, float x, float y, float z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        RigidbodyComponent& component = obj->GetComponent<RigidbodyComponent>();
+        RigidbodyComponent& component = ScriptComponentCache<RigidbodyComponent>::GetComponent(sceneID, uuid);
         component.SetLinearVelocity({ x, y, z });
     }
 
     SCRIPT_API void Rigidbody_AddForce(Scene::ID_type sceneID, UUID uuid, float x, float y, float z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        RigidbodyComponent& component = obj->GetComponent<RigidbodyComponent>();
+        RigidbodyComponent& component = ScriptComponentCache<RigidbodyComponent>::GetComponent(sceneID, uuid);
         component.AddForce(glm::vec3{ x, y, z });
     }
 
     SCRIPT_API void Rigidbody_AddForceWithMode(Scene::ID_type sceneID, UUID uuid, float x, float y, float z, int forceMode)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        RigidbodyComponent& component = obj->GetComponent<RigidbodyComponent>();
+        RigidbodyComponent& component = ScriptComponentCache<RigidbodyComponent>::GetComponent(sceneID, uuid);
         component.AddForce(glm::vec3{ x, y, z }, static_cast<ForceMode>(forceMode));
     }
 
     SCRIPT_API void Rigidbody_AddTorque(Scene::ID_type sceneID, UUID uuid, float x, float y, float z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        RigidbodyComponent& component = obj->GetComponent<RigidbodyComponent>();
+        RigidbodyComponent& component = ScriptComponentCache<RigidbodyComponent>::GetComponent(sceneID, uuid);
         component.AddTorque(glm::vec3{ x, y, z });
     }
 
     SCRIPT_API void Rigidbody_AddTorqueWithMode(Scene::ID_type sceneID, UUID uuid, float x, float y, float z, int forceMode)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        RigidbodyComponent& component = obj->GetComponent<RigidbodyComponent>();
+        RigidbodyComponent& component = ScriptComponentCache<RigidbodyComponent>::GetComponent(sceneID, uuid);
         component.AddTorque(glm::vec3{ x, y, z }, static_cast<ForceMode>(forceMode));
     }
 }
\ No newline at end of file
@@ -21,10 +21,29 @@ Technology is prohibited.
 
 namespace oo
 {
+    // Setters only mark the transform dirty, the transform system propagates everything once after the scripts run.
+    // Getters bring the transform up to date on demand, recalculating just its modified ancestors.
+
+    // global values are stale whenever the transform or one of its ancestors was modified
+    inline TransformComponent& Transform3D_ResolveGlobal(Scene::ID_type sceneID, oo::UUID uuid)
+    {
+        auto [obj, component] = ScriptComponentCache<TransformComponent>::Get(sceneID, uuid);
+        ScriptManager::GetSceneRef(sceneID).GetWorld().Get_System<TransformSystem>()->ResolveGlobalTransform(obj);
+        return component;
+    }
+
+    // local values only go stale once a global value was set on the transform itself
+    inline TransformComponent& Transform3D_ResolveLocal(Scene::ID_type sceneID, oo::UUID uuid)
+    {
+        auto [obj, component] = ScriptComponentCache<TransformComponent>::Get(sceneID, uuid);
+        if (component.GlobalMatrixDirty)
+            ScriptManager::GetSceneRef(sceneID).GetWorld().Get_System<TransformSystem>()->ResolveGlobalTransform(obj);
+        return component;
+    }
+
     SCRIPT_API void Transform3D_GetLocalPosition(Scene::ID_type sceneID, oo::UUID uuid, float* x, float* y, float* z)
-    { 
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        TransformComponent& component = obj->GetComponent<TransformComponent>();
+    {
+        TransformComponent& component = Transform3D_ResolveLocal(sceneID, uuid);
         TransformComponent::vec3 vec3 = component.GetPosition();
         *x = vec3.x;
         *y = vec3.y;
@@ -33,18 +52,13 @@ namespace oo
 
     SCRIPT_API void Transform3D_SetLocalPosition(Scene::ID_type sceneID, oo::UUID uuid, float x, float y, float z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        TransformComponent& component = obj->GetComponent<TransformComponent>();
+        TransformComponent& component = Transform3D_ResolveLocal(sceneID, uuid);
         component.SetPosition({ x, y, z });
-
-        std::shared_ptr<Scene> scene = ScriptManager::GetScene(sceneID);
-        scene->GetWorld().Get_System<TransformSystem>()->UpdateSubTree(*obj);
     }
 
     SCRIPT_API void Transform3D_GetGlobalPosition(Scene::ID_type sceneID, oo::UUID uuid, float* x, float* y, float* z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        TransformComponent& component = obj->GetComponent<TransformComponent>();
+        TransformComponent& component = Transform3D_ResolveGlobal(sceneID, uuid);
         TransformComponent::vec3 vec3 = component.GetGlobalPosition();
         *x = vec3.x;
         *y = vec3.y;
@@ -53,18 +67,13 @@ namespace oo
 
     SCRIPT_API void Transform3D_SetGlobalPosition(Scene::ID_type sceneID, oo::UUID uuid, float x, float y, float z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        TransformComponent& component = obj->GetComponent<TransformComponent>();
+        TransformComponent& component = Transform3D_ResolveGlobal(sceneID, uuid);
         component.SetGlobalPosition({ x, y, z });
-
-        std::shared_ptr<Scene> scene = ScriptManager::GetScene(sceneID);
-        scene->GetWorld().Get_System<TransformSystem>()->UpdateSubTree(*obj);
     }
 
     SCRIPT_API void Transform3D_GetGlobalForward(Scene::ID_type sceneID, oo::UUID uuid, float* x, float* y, float* z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        TransformComponent& component = obj->GetComponent<TransformComponent>();
+        TransformComponent& component = Transform3D_ResolveGlobal(sceneID, uuid);
         TransformComponent::vec3 vec3 = component.GlobalForward();
         *x = vec3.x;
         *y = vec3.y;
@@ -73,18 +82,13 @@ namespace oo
 
     SCRIPT_API void Transform3D_SetGlobalForward(Scene::ID_type sceneID, oo::UUID uuid, float x, float y, float z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        TransformComponent& component = obj->GetComponent<TransformComponent>();
+        TransformComponent& component = Transform3D_ResolveGlobal(sceneID, uuid);
         component.LookAt({ x, y, z });
-
-        std::shared_ptr<Scene> scene = ScriptManager::GetScene(sceneID);
-        scene->GetWorld().Get_System<TransformSystem>()->UpdateSubTree(*obj);
     }
 
     SCRIPT_API void Transform3D_GetGlobalLeft(Scene::ID_type sceneID, oo::UUID uuid, float* x, float* y, float* z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        TransformComponent& component = obj->GetComponent<TransformComponent>();
+        TransformComponent& component = Transform3D_ResolveGlobal(sceneID, uuid);
         TransformComponent::vec3 vec3 = component.GlobalLeft();
         *x = vec3.x;
         *y = vec3.y;
@@ -93,8 +97,7 @@ namespace oo
 
     SCRIPT_API void Transform3D_GetGlobalUp(Scene::ID_type sceneID, oo::UUID uuid, float* x, float* y, float* z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        TransformComponent& component = obj->GetComponent<TransformComponent>();
+        TransformComponent& component = Transform3D_ResolveGlobal(sceneID, uuid);
         TransformComponent::vec3 vec3 = component.GlobalUp();
         *x = vec3.x;
         *y = vec3.y;
@@ -103,8 +106,7 @@ namespace oo
 
     SCRIPT_API void Transform3D_GetLocalEulerAngles(Scene::ID_type sceneID, oo::UUID uuid, float* x, float* y, float* z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        TransformComponent& component = obj->GetComponent<TransformComponent>();
+        TransformComponent& component = Transform3D_ResolveLocal(sceneID, uuid);
         TransformComponent::vec3 vec3 = component.GetEulerAngles();
         *x = vec3.x;
         *y = vec3.y;
@@ -113,28 +115,19 @@ namespace oo
 
     SCRIPT_API void Transform3D_LookAt(Scene::ID_type sceneID, oo::UUID uuid, float x, float y, float z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        TransformComponent& component = obj->GetComponent<TransformComponent>();
+        TransformComponent& component = Transform3D_ResolveGlobal(sceneID, uuid);
         component.LookAt({ x, y, z });
-
-        std::shared_ptr<Scene> scene = ScriptManager::GetScene(sceneID);
-        scene->GetWorld().Get_System<TransformSystem>()->UpdateSubTree(*obj);
     }
 
     SCRIPT_API void Transform3D_SetLocalEulerAngles(Scene::ID_type sceneID, oo::UUID uuid, float x, float y, float z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        TransformComponent& component = obj->GetComponent<TransformComponent>();
+        TransformComponent& component = Transform3D_ResolveLocal(sceneID, uuid);
         component.SetRotation({ x, y, z });
-
-        std::shared_ptr<Scene> scene = ScriptManager::GetScene(sceneID);
-        scene->GetWorld().Get_System<TransformSystem>()->UpdateSubTree(*obj);
     }
 
     SCRIPT_API void Transform3D_GetGlobalEulerAngles(Scene::ID_type sceneID, oo::UUID uuid, float* x, float* y, float* z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        TransformComponent& component = obj->GetComponent<TransformComponent>();
+        TransformComponent& component = Transform3D_ResolveGlobal(sceneID, uuid);
         TransformComponent::vec3 vec3 = component.GetGlobalRotationDeg();
         *x = vec3.x;
         *y = vec3.y;
@@ -143,18 +136,13 @@ namespace oo
 
     SCRIPT_API void Transform3D_SetGlobalEulerAngles(Scene::ID_type sceneID, oo::UUID uuid, float x, float y, float z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        TransformComponent& component = obj->GetComponent<TransformComponent>();
+        TransformComponent& component = Transform3D_ResolveGlobal(sceneID, uuid);
         component.SetGlobalRotation({ x, y, z });
-
-        std::shared_ptr<Scene> scene = ScriptManager::GetScene(sceneID);
-        scene->GetWorld().Get_System<TransformSystem>()->UpdateSubTree(*obj);
     }
 
     SCRIPT_API void Transform3D_GetLocalScale(Scene::ID_type sceneID, oo::UUID uuid, float* x, float* y, float* z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        TransformComponent& component = obj->GetComponent<TransformComponent>();
+        TransformComponent& component = Transform3D_ResolveLocal(sceneID, uuid);
         TransformComponent::vec3 vec3 = component.GetScale();
         *x = vec3.x;
         *y = vec3.y;
@@ -163,18 +151,13 @@ namespace oo
 
     SCRIPT_API void Transform3D_SetLocalScale(Scene::ID_type sceneID, oo::UUID uuid, float x, float y, float z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        TransformComponent& component = obj->GetComponent<TransformComponent>();
+        TransformComponent& component = Transform3D_ResolveLocal(sceneID, uuid);
         component.SetScale({ x, y, z });
-
-        std::shared_ptr<Scene> scene = ScriptManager::GetScene(sceneID);
-        scene->GetWorld().Get_System<TransformSystem>()->UpdateSubTree(*obj);
     }
 
     SCRIPT_API void Transform3D_GetGlobalScale(Scene::ID_type sceneID, oo::UUID uuid, float* x, float* y, float* z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        TransformComponent& component = obj->GetComponent<TransformComponent>();
+        TransformComponent& component = Transform3D_ResolveGlobal(sceneID, uuid);
         TransformComponent::vec3 vec3 = component.GetGlobalScale();
         *x = vec3.x;
         *y = vec3.y;
@@ -183,12 +166,8 @@ namespace oo
 
     SCRIPT_API void Transform3D_SetGlobalScale(Scene::ID_type sceneID, oo::UUID uuid, float x, float y, float z)
     {
-        std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid);
-        TransformComponent& component = obj->GetComponent<TransformComponent>();
+        TransformComponent& component = Transform3D_ResolveGlobal(sceneID, uuid);
         component.SetGlobalScale({ x, y, z });
-
-        std::shared_ptr<Scene> scene = ScriptManager::GetScene(sceneID);
-        scene->GetWorld().Get_System<TransformSystem>()->UpdateSubTree(*obj);
     }
 
     SCRIPT_API int Transform_GetChildCount(Scene::ID_type sceneID, oo::UUID uuid)
@@ -253,6 +232,9 @@ namespace oo
             return;
         }
         std::shared_ptr<GameObject> parentObj = ScriptManager::GetObjectFromScene(sceneID, newParent);
+        // preserving transforms reads the global values of both
+        scene->GetWorld().Get_System<TransformSystem>()->ResolveGlobalTransform(*obj);
+        scene->GetWorld().Get_System<TransformSystem>()->ResolveGlobalTransform(*parentObj);
         parentObj->AddChild(*obj, preserveTransforms);
 
         //manually update all transforms if set parent is called
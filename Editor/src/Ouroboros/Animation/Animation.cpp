@@ -20,6 +20,8 @@ Technology is prohibited.
 #include "AnimationInternal.h"
 #include "Project.h"
 
+#include "OO_Vulkan/src/loader/ModelCache.h"
+
 #include "assimp/scene.h"
 #include "assimp/Importer.hpp"
 #include "assimp/postprocess.h"
@@ -202,28 +204,35 @@ namespace oo::Anim
 	{
 		std::ostringstream os;
 
-		Assimp::Importer importer;
-		uint flags = 0;
-		flags |= aiProcess_Triangulate;
-		flags |= aiProcess_GenSmoothNormals;
-		flags |= aiProcess_ImproveCacheLocality;
-		flags |= aiProcess_CalcTangentSpace;
-		flags |= aiProcess_FindInstances; // this step is slow but it finds duplicate instances in FBX
-		//flags |= aiProcess_LimitBoneWeights; // limmits bones to 4
-		const aiScene* scene = importer.ReadFile(filepath, flags
-		);
-
-		if (!scene)
+		//the renderer cooks the animations along with the model, only import again if it has not
+		oGFX::CookedModel cooked;
+		if (oGFX::ModelCache::Read(filepath, cooked) == false)
 		{
-			assert(false);
-			return {};
-		}
-		if (scene->HasAnimations() == false) return {};
+			Assimp::Importer importer;
+			uint flags = 0;
+			flags |= aiProcess_Triangulate;
+			flags |= aiProcess_GenSmoothNormals;
+			flags |= aiProcess_ImproveCacheLocality;
+			flags |= aiProcess_CalcTangentSpace;
+			flags |= aiProcess_FindInstances; // this step is slow but it finds duplicate instances in FBX
+			//flags |= aiProcess_LimitBoneWeights; // limmits bones to 4
+			const aiScene* scene = importer.ReadFile(filepath, flags
+			);
+
+			if (!scene)
+			{
+				assert(false);
+				return {};
+			}
 
 #ifdef EDITOR_DEBUG
-		PrintNodeHierarchy(scene);
+			PrintNodeHierarchy(scene);
 #endif // EDITOR_DEBUG
 
+			oGFX::ModelCache::CookAnimations(*scene, cooked);
+		}
+		if (cooked.animations.empty()) return {};
+
 		
 
 		os << "--------------|Bone hierarchy|--------------" << std::endl;
@@ -275,42 +284,41 @@ namespace oo::Anim
 
 		os << "Animated scene\n";
 		std::vector<Animation*> anims;
-		for (size_t i = 0; i < scene->mNumAnimations; i++)
+		for (auto const& cooked_anim : cooked.animations)
 		{
-			os << "Anim name: " << scene->mAnimations[i]->mName.C_Str() << std::endl;
-			os << "Anim frames: " << scene->mAnimations[i]->mDuration << std::endl;
-			os << "Anim ticksPerSecond: " << scene->mAnimations[i]->mTicksPerSecond << std::endl;
-			os << "Anim duration: " << static_cast<float>(scene->mAnimations[i]->mDuration) / scene->mAnimations[i]->mTicksPerSecond << std::endl;
-			os << "Anim numChannels: " << scene->mAnimations[i]->mNumChannels << std::endl;
-			os << "Anim numMeshChannels: " << scene->mAnimations[i]->mNumMeshChannels << std::endl;
+			std::string anim_name{ cooked.GetString(cooked_anim.name) };
+			os << "Anim name: " << anim_name << std::endl;
+			os << "Anim frames: " << cooked_anim.duration << std::endl;
+			os << "Anim ticksPerSecond: " << cooked_anim.ticksPerSecond << std::endl;
+			os << "Anim duration: " << static_cast<float>(cooked_anim.duration) / cooked_anim.ticksPerSecond << std::endl;
+			os << "Anim numChannels: " << cooked_anim.channelCount << std::endl;
 			os << "-------------------------------------------------------" << std::endl;
 
 			Animation anim{};
-			anim.name = prefix_name + scene->mAnimations[i]->mName.C_Str();
+			anim.name = prefix_name + anim_name;
 
-			if (scene->mAnimations[i]->mTicksPerSecond != 0)
-				anim.frames_per_second = static_cast<float>(scene->mAnimations[i]->mTicksPerSecond);
+			if (cooked_anim.ticksPerSecond != 0)
+				anim.frames_per_second = static_cast<float>(cooked_anim.ticksPerSecond);
 			else
 				anim.frames_per_second = 25.f;
 
-			//anim.total_frames	  = static_cast<float>(scene->mAnimations[i]->mDuration);
-			auto total_frames	  = static_cast<float>(scene->mAnimations[i]->mDuration);
+			//anim.total_frames	  = static_cast<float>(cooked_anim.duration);
+			auto total_frames	  = static_cast<float>(cooked_anim.duration);
 			anim.animation_length = total_frames / anim.frames_per_second;
 
 
 
-			for (size_t x = 0; x < scene->mAnimations[i]->mNumChannels; x++)
+			for (size_t x = 0; x < cooked_anim.channelCount; x++)
 			{
-				os << "Anim channel: " << scene->mAnimations[i]->mChannels[x]->mNodeName.C_Str() << std::endl;
-
-				auto& channel = scene->mAnimations[i]->mChannels[x];
+				auto& channel = cooked.channels[cooked_anim.firstChannel + x];
 				//oGFX::BoneNode* curr = resource->skeleton->m_boneNodes;
-				std::string boneName{ channel->mNodeName.C_Str() };
+				std::string boneName{ cooked.GetString(channel.nodeName) };
+				os << "Anim channel: " << boneName << std::endl;
 				//guarding for safety
 				//assert(resource->strToBone.contains(boneName));
 				if (resource->strToBone.contains(boneName) == false)
 				{
-					os << "Skipped: " << scene->mAnimations[i]->mChannels[x]->mNodeName.C_Str() << std::endl;
+					os << "Skipped: " << boneName << std::endl;
 					continue;
 				}
 
@@ -327,23 +335,23 @@ namespace oo::Anim
 					.type{Timeline::TYPE::FBX_ANIM},
 					.component_hash{Ecs::ECSWorld::get_component_hash<TransformComponent>()},
 					.rttr_property{ rttr::type::get<TransformComponent>().get_property("Position")},
-					.timeline_name{channel->mNodeName.C_Str() + std::string{" position"}},
+					.timeline_name{boneName + std::string{" position"}},
 					.children_index = children_index,
 					.hierarchy_provided = true};
 
 					auto timeline = internal::AddTimelineToAnimation(anim, timeline_info);
 					assert(timeline);
 
-					for (size_t y = 0; y < channel->mNumPositionKeys; y++)
+					for (size_t y = 0; y < channel.positionKeyCount; y++)
 					{
-						auto& key = channel->mPositionKeys[y];
-						KeyFrame kf{ glm::vec3{key.mValue.x,key.mValue.y,key.mValue.z},
-						static_cast<float>(key.mTime) / anim.frames_per_second };
+						auto& key = cooked.keys[channel.firstPositionKey + y];
+						KeyFrame kf{ glm::vec3{key.value[0],key.value[1],key.value[2]},
+						static_cast<float>(key.time) / anim.frames_per_second };
 
 						[[maybe_unused]] auto keyframe = internal::AddKeyframeToTimeline(*timeline, kf);
 						assert(keyframe);
 
-						os << y << "- Keyframe Position: " << key.mValue.x << "," << key.mValue.y << "," << key.mValue.z << std::endl;
+						os << y << "- Keyframe Position: " << key.value[0] << "," << key.value[1] << "," << key.value[2] << std::endl;
 					}
 
 				}
@@ -355,21 +363,21 @@ namespace oo::Anim
 					.type{Timeline::TYPE::FBX_ANIM},
 					.component_hash{Ecs::ECSWorld::get_component_hash<TransformComponent>()},
 					.rttr_property{ rttr::type::get<TransformComponent>().get_property("Quaternion")},
-					.timeline_name{channel->mNodeName.C_Str() + std::string{" rotation"}} ,
+					.timeline_name{boneName + std::string{" rotation"}} ,
 					.children_index = children_index,
 					.hierarchy_provided = true };
 					auto timeline = internal::AddTimelineToAnimation(anim, timeline_info);
 					assert(timeline);
 
-					for (size_t y = 0; y < channel->mNumRotationKeys; y++)
+					for (size_t y = 0; y < channel.rotationKeyCount; y++)
 					{
-						auto& key = channel->mRotationKeys[y];
-						KeyFrame kf{glm::quat{key.mValue.w, key.mValue.x,key.mValue.y,key.mValue.z} ,
-						static_cast<float>(key.mTime) / anim.frames_per_second };
+						auto& key = cooked.keys[channel.firstRotationKey + y];
+						KeyFrame kf{glm::quat{key.value[3], key.value[0],key.value[1],key.value[2]} ,
+						static_cast<float>(key.time) / anim.frames_per_second };
 
 						[[maybe_unused]] auto keyframe = internal::AddKeyframeToTimeline(*timeline, kf);
 						assert(keyframe);
-						os << y << "- Keyframe rotation: " << key.mValue.x << "," << key.mValue.y << "," << key.mValue.z << "," << key.mValue.w << std::endl;
+						os << y << "- Keyframe rotation: " << key.value[0] << "," << key.value[1] << "," << key.value[2] << "," << key.value[3] << std::endl;
 					}
 				}
 				/*--------
@@ -380,24 +388,24 @@ namespace oo::Anim
 					.type{Timeline::TYPE::FBX_ANIM},
 					.component_hash{Ecs::ECSWorld::get_component_hash<TransformComponent>()},
 					.rttr_property{ rttr::type::get<TransformComponent>().get_property("Scaling")},
-					.timeline_name{channel->mNodeName.C_Str() + std::string{" scale"}} ,
+					.timeline_name{boneName + std::string{" scale"}} ,
 					.children_index = children_index,
 					.hierarchy_provided = true };
 
 					auto timeline = internal::AddTimelineToAnimation(anim, timeline_info);
 					assert(timeline);
 
-					for (size_t y = 0; y < channel->mNumScalingKeys; y++)
+					for (size_t y = 0; y < channel.scaleKeyCount; y++)
 					{
-						auto& key = channel->mScalingKeys[y];
-						KeyFrame kf{glm::vec3{key.mValue.x,key.mValue.y,key.mValue.z} ,
-						static_cast<float>(key.mTime) / anim.frames_per_second };
+						auto& key = cooked.keys[channel.firstScaleKey + y];
+						KeyFrame kf{glm::vec3{key.value[0],key.value[1],key.value[2]} ,
+						static_cast<float>(key.time) / anim.frames_per_second };
 
 						[[maybe_unused]] auto keyframe = internal::AddKeyframeToTimeline(*timeline, kf);
 						assert(keyframe);
 					}
 				}
-				os << "Loaded: " << scene->mAnimations[i]->mChannels[x]->mNodeName.C_Str() << std::endl;
+				os << "Loaded: " << boneName << std::endl;
 			}
 
 			auto createdAnim = Animation::AddAnimation(std::move(anim));
@@ -539,6 +547,7 @@ namespace oo::Anim
 				new_timeline.keyframes.emplace_back(keyframe);
 			}
 			assert(new_timeline.keyframes.size() > 1ull);
+			internal::BakeKeyFrameChannel(new_timeline);
 			new_anim.timelines.emplace_back(std::move(new_timeline));
 		}
 
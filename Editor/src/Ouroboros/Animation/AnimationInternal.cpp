@@ -596,7 +596,16 @@ rttr::variant oo::Anim::internal::LoadRTTRVariant(rapidjson::Value& value)
 };
 namespace oo::Anim::internal
 {
-	
+	//resolves the tracker's gameobject through its cached handle, refreshing the handle if it went stale
+	GameObject* GetTimelineGameObject(Scene& scene, ProgressTracker& progressTracker)
+	{
+		if (GameObject* go = scene.FindWithHandle(progressTracker.timeline_gameobject_handle))
+			return go;
+
+		progressTracker.timeline_gameobject_handle = scene.GetHandle(progressTracker.timeline_gameobject_uid);
+		return scene.FindWithHandle(progressTracker.timeline_gameobject_handle);
+	}
+
 	/*uint GetAnimationIndex(std::string const& name)
 	{
 		assert(Animation::name_to_index.contains(name));
@@ -895,7 +904,7 @@ namespace oo::Anim::internal
 		data.component_hash = info.progressTracker.timeline->component_hash;
 		data.component_property = info.progressTracker.timeline->rttr_property;
 		{
-			auto ptr_to_go = info.tracker_info.system.Get_Scene().FindWithInstanceID(info.progressTracker.timeline_gameobject_uid);
+			auto ptr_to_go = GetTimelineGameObject(info.tracker_info.system.Get_Scene(), info.progressTracker);
 			GameObject go{ *ptr_to_go };
 			data.component = info.tracker_info.system.Get_Ecs_World()->get_component(
 				go.GetEntity(), data.component_hash);
@@ -1054,18 +1063,49 @@ namespace oo::Anim::internal
 		//assert(false);
 	}
 
+	//vec3 timelines snap to the next keyframe, same as GetInterpolatedValue
+	inline glm::vec3 InterpolateChannel(glm::vec3 const& /*prev*/, glm::vec3 const& next, float /*percentage*/)
+	{
+		return next;
+	}
+
+	inline glm::quat InterpolateChannel(glm::quat const& prev, glm::quat const& next, float percentage)
+	{
+		return glm::slerp(prev, next, percentage);
+	}
+
+	template<typename T>
+	T SampleChannel(std::vector<float> const& times, std::vector<T> const& values, size_t index, float updatedTimer)
+	{
+		//current progress in keyframe over total time in between keyframes
+		float const percentage = (updatedTimer - times[index]) / (times[index + 1ul] - times[index]);
+		return InterpolateChannel(values[index], values[index + 1ul], percentage);
+	}
+
+	//moves the tracker past every keyframe the timer is already past, returns true if it landed on the last keyframe
+	bool AdvanceChannel(ProgressTracker& progressTracker, std::vector<float> const& times, float updatedTimer)
+	{
+		size_t const max_index = times.size() - 1ul;
+		while (progressTracker.index < max_index && Withinbounds(updatedTimer, times[progressTracker.index + 1ul]))
+			++progressTracker.index;
+
+		return progressTracker.index >= max_index;
+	}
+
 	//void UpdateFBX_Animation(AnimationComponent& comp, AnimationTracker& tracker, ProgressTracker& progressTracker, float updatedTimer)
 	void UpdateFBX_Animation(UpdateProgressTrackerInfo& t_info, float updatedTimer)
 	{
 		assert(t_info.progressTracker.type == Timeline::TYPE::FBX_ANIM);
 
 		auto& timeline = *(t_info.progressTracker.timeline);
+		auto const& channel = timeline.channel;
+		auto& skeleton = t_info.tracker_info.comp.skeleton;
 
 		//no keyframes so we return
-		if (timeline.keyframes.empty()) return;
+		if (channel.times.empty()) return;
 
 		//already hit last 
-		if (t_info.progressTracker.index >= (timeline.keyframes.size() - 1ul))
+		if (t_info.progressTracker.index >= (channel.times.size() - 1ul))
 		{
 			//animation not looping so we return
 			if (t_info.tracker_info.tracker.currentNode->GetAnimation().looping == false)
@@ -1074,279 +1114,110 @@ namespace oo::Anim::internal
 			t_info.progressTracker.index = 0;
 			return;
 		}
-		// get the gameobject
-		TRACY_PROFILE_SCOPE_NC(locate_object , 0x004E41);
-		auto ptr_to_go = t_info.tracker_info.system.Get_Scene().FindWithInstanceID(t_info.progressTracker.timeline_gameobject_uid);
-		GameObject go{ *ptr_to_go };
-		TRACY_PROFILE_SCOPE_END();
-
 
 		TRACY_PROFILE_SCOPE_NC(next_keyframe_check, 0x004E41);
-		//if next keyframe within bounds increment index 
-		auto& nextEvent = *(timeline.keyframes.begin() + t_info.progressTracker.index + 1ul);
-		if (Withinbounds(updatedTimer, nextEvent.time))
+		bool const reached_end = AdvanceChannel(t_info.progressTracker, channel.times, updatedTimer);
+		TRACY_PROFILE_SCOPE_END();
+
+		//went past last keyframe so we set data to last and return
+		if (reached_end)
 		{
-			++t_info.progressTracker.index;
-			//check if passed more than 1 keyframe
-			auto max_index = (timeline.keyframes.size() - 1ul);
-			while(t_info.progressTracker.index < max_index &&
-				Withinbounds(updatedTimer, timeline.keyframes[t_info.progressTracker.index + 1ul].time))
-				++t_info.progressTracker.index;
+			if (channel.quat_values.empty() == false)
+				skeleton.SetCurrentPose_Bone_Quaternion_property(timeline.boneID, channel.quat_values.back());
+			else
+				skeleton.SetCurrentPose_Bone_vec3_property(timeline.boneID, timeline.rttr_property, channel.vec3_values.back());
 
-			//went past last keyframe so we set data to last and return
-			if (t_info.progressTracker.index >= max_index)
+			//if animation is looping, reset keyframe index
+			if (t_info.tracker_info.tracker.currentNode->GetAnimation().looping)
 			{
-				//get the instance
-				auto ptr = t_info.tracker_info.system.Get_Ecs_World()->get_component(
-					go.GetEntity(), t_info.progressTracker.timeline->component_hash);
-				auto rttr_instance = hash_to_instance[t_info.progressTracker.timeline->component_hash](ptr);
-				//set the value
-				if (timeline.keyframes.back().data.get_type() == rttr::type::get<oo::TransformComponent::quat>())
-				{
-					/*KeyFrame::DataType data = oo::TransformComponent::quat{ timeline.keyframes.back().data.get_value<glm::quat>() };
-					t_info.progressTracker.timeline->rttr_property.set_value(rttr_instance, 
-						data);*/
-					t_info.tracker_info.comp.skeleton.SetCurrentPose_Bone_Quaternion_property(
-						timeline.boneID,
-						timeline.keyframes.back().data.get_value<glm::quat>());
-				}
-				else
-				{
-					/*t_info.progressTracker.timeline->rttr_property.set_value(rttr_instance, timeline.keyframes.back().data);*/
-					t_info.tracker_info.comp.skeleton.SetCurrentPose_Bone_vec3_property(
-						timeline.boneID,
-						timeline.rttr_property,
-						timeline.keyframes.back().data.get_value<glm::vec3>());
-				}
-
-				//if animation is looping, reset keyframe index
-				if (t_info.tracker_info.tracker.currentNode->GetAnimation().looping)
-				{
-					t_info.progressTracker.index = 0;
-				}
-				TRACY_PROFILE_SCOPE_END();
-				return;
+				t_info.progressTracker.index = 0;
 			}
-
+			return;
 		}
-		TRACY_PROFILE_SCOPE_END();
 
 		/*--------------------------------
-		interpolate animation accordingly
+		interpolate and set skeleton's pose's bone data
 		--------------------------------*/
-		TRACY_PROFILE_SCOPE_NC(interpolation, 0x004E41);
-		auto& prevKeyframe = *(timeline.keyframes.begin() + t_info.progressTracker.index);
-		auto& nextKeyframe = *(timeline.keyframes.begin() + t_info.progressTracker.index + 1u);
-		auto prevTime = prevKeyframe.time;
-		auto nextTime = nextKeyframe.time;
-		TRACY_PROFILE_SCOPE_END();
-
-		TRACY_PROFILE_SCOPE_NC(calculate_percentage, 0x122F59);
-		//current progress in keyframe over total time in between keyframes
-		float percentage = (updatedTimer - prevTime) / (nextTime - prevTime);
-		TRACY_PROFILE_SCOPE_END();
-
 		TRACY_PROFILE_SCOPE_NC(get_interpolated_value, 0x122F59);
-		KeyFrame::DataType interpolated_value = GetInterpolatedValue(
-			t_info.progressTracker.timeline->rttr_type, prevKeyframe.data, nextKeyframe.data, percentage);
-		TRACY_PROFILE_SCOPE_END();
-		
-		/*--------------------------------
-		set related game object's data - not set here anymore
-		--------------------------------*/
-		/*
-		TRACY_PROFILE_SCOPE_NC(set_game_object, 0x004E41);
-		//get a ptr to the component
-		auto ptr = t_info.tracker_info.system.Get_Ecs_World()->get_component(
-			go.GetEntity(), t_info.progressTracker.timeline->component_hash);
-
-		//get the instance
-		auto rttr_instance = hash_to_instance[t_info.progressTracker.timeline->component_hash](ptr);
-		//set the value
-		//if (interpolated_value.get_type() == rttr::type::get< glm::vec3>()) return;
-
-		auto result = t_info.progressTracker.timeline->rttr_property.set_value(rttr_instance, interpolated_value);
-		if (result == false)
-		{
-			auto type_name = interpolated_value.get_type().get_name();
-			auto correct_Type_name = t_info.progressTracker.timeline->rttr_property.get_type().get_name();
-			auto temp = rttr::type::get<oo::TransformComponent::quat>().get_name();
-			assert(result);
-		}
-		TRACY_PROFILE_SCOPE_END();
-		*/
-		/*--------------------------------
-		set skeleton's pose's bone data 
-		--------------------------------*/
-		static const auto vec3_type = rttr::type::get<glm::vec3>();
-
-		if (interpolated_value.get_type() == vec3_type)
+		size_t const index = t_info.progressTracker.index;
+		if (channel.quat_values.empty() == false)
 		{
-			t_info.tracker_info.comp.skeleton.SetCurrentPose_Bone_vec3_property(
+			skeleton.SetCurrentPose_Bone_Quaternion_property(
 				timeline.boneID,
-				timeline.rttr_property,
-				interpolated_value.get_value< glm::vec3>());
+				SampleChannel(channel.times, channel.quat_values, index, updatedTimer));
 		}
-		else // quaternion
+		else
 		{
-			t_info.tracker_info.comp.skeleton.SetCurrentPose_Bone_Quaternion_property(
+			skeleton.SetCurrentPose_Bone_vec3_property(
 				timeline.boneID,
-				interpolated_value.get_value<glm::quat>());
+				timeline.rttr_property,
+				SampleChannel(channel.times, channel.vec3_values, index, updatedTimer));
 		}
-		
-
-		
-		//SetComponentData(timeline, interpolated_value);
-		//assert(false);
+		TRACY_PROFILE_SCOPE_END();
 	}
 	void UpdateFBX_Animation_Transition(UpdateProgressTrackerInfo& t_info, float updatedTimer)
 	{
 		assert(t_info.progressTracker.type == Timeline::TYPE::FBX_ANIM);
 
 		auto& timeline = *(t_info.progressTracker.timeline);
+		auto const& channel = timeline.channel;
+		auto& skeleton = t_info.tracker_info.comp.skeleton;
 
 		//no keyframes so we return
-		if (timeline.keyframes.empty()) return;
+		if (channel.times.empty()) return;
 
 		//already hit last and animation not looping so we return
-		if (t_info.progressTracker.index >= (timeline.keyframes.size() - 1ul) &&
+		if (t_info.progressTracker.index >= (channel.times.size() - 1ul) &&
 			t_info.tracker_info.tracker.currentNode->GetAnimation().looping == false)
 		{
 			return;
 		}
-		// get the gameobject
-		TRACY_PROFILE_SCOPE_NC(locate_object, 0x004E41);
-		auto ptr_to_go = t_info.tracker_info.system.Get_Scene().FindWithInstanceID(t_info.progressTracker.timeline_gameobject_uid);
-		GameObject go{ *ptr_to_go };
-		TRACY_PROFILE_SCOPE_END();
 
+		//samples go into the transition pose unblended, 
+		//UpdateTrackerKeyframeProgress_Transitions blends the whole pose afterwards
 		auto const pose_index = t_info.tracker_info.tracker.transition_info.pose_index;
-		auto const quick_blend_weight = t_info.tracker_info.tracker.transition_info.quick_blend_weight;
 
 		TRACY_PROFILE_SCOPE_NC(next_keyframe_check, 0x004E41);
-		//if next keyframe within bounds increment index 
-		auto& nextEvent = *(timeline.keyframes.begin() + t_info.progressTracker.index + 1ul);
-		if (Withinbounds(updatedTimer, nextEvent.time))
+		bool const reached_end = AdvanceChannel(t_info.progressTracker, channel.times, updatedTimer);
+		TRACY_PROFILE_SCOPE_END();
+
+		//went past last keyframe so we set data to last and return
+		if (reached_end)
 		{
-			++t_info.progressTracker.index;
-			//check if passed more than 1 keyframe
-			auto max_index = (timeline.keyframes.size() - 1ul);
-			while (t_info.progressTracker.index < max_index &&
-				Withinbounds(updatedTimer, timeline.keyframes[t_info.progressTracker.index + 1ul].time))
-				++t_info.progressTracker.index;
+			if (channel.quat_values.empty() == false)
+				skeleton.SetPose_Bone_Quaternion_property(pose_index, timeline.boneID, channel.quat_values.back());
+			else
+				skeleton.SetPose_Bone_vec3_property(pose_index, timeline.boneID, timeline.rttr_property, channel.vec3_values.back());
 
-			//went past last keyframe so we set data to last and return
-			if (t_info.progressTracker.index >= max_index)
+			//if animation is looping, reset keyframe index
+			if (t_info.tracker_info.tracker.currentNode->GetAnimation().looping)
 			{
-				//get the instance
-				auto ptr = t_info.tracker_info.system.Get_Ecs_World()->get_component(
-					go.GetEntity(), t_info.progressTracker.timeline->component_hash);
-				auto rttr_instance = hash_to_instance[t_info.progressTracker.timeline->component_hash](ptr);
-				//set the value
-				if (timeline.keyframes.back().data.get_type() == rttr::type::get<oo::TransformComponent::quat>())
-				{
-					/*KeyFrame::DataType data = oo::TransformComponent::quat{ timeline.keyframes.back().data.get_value<glm::quat>() };
-					t_info.progressTracker.timeline->rttr_property.set_value(rttr_instance,
-						data);*/
-					t_info.tracker_info.comp.skeleton.SetPoseBlended_Bone_Quaternion_property(
-						pose_index,
-						AnimationSkeleton::CURRENT_POSE_INDEX,
-						quick_blend_weight,
-						timeline.boneID,
-						timeline.keyframes.back().data.get_value<glm::quat>());
-				}
-				else
-				{
-					/*t_info.progressTracker.timeline->rttr_property.set_value(rttr_instance, timeline.keyframes.back().data);*/
-					t_info.tracker_info.comp.skeleton.SetPoseBlended_Bone_vec3_property(
-						pose_index,
-						AnimationSkeleton::CURRENT_POSE_INDEX,
-						quick_blend_weight,
-						timeline.boneID,
-						timeline.rttr_property,
-						timeline.keyframes.back().data.get_value<glm::vec3>());
-				}
-
-				//if animation is looping, reset keyframe index
-				if (t_info.tracker_info.tracker.currentNode->GetAnimation().looping)
-				{
-					t_info.progressTracker.index = 0;
-				}
-				TRACY_PROFILE_SCOPE_END();
-				return;
+				t_info.progressTracker.index = 0;
 			}
-
+			return;
 		}
-		TRACY_PROFILE_SCOPE_END();
 
 		/*--------------------------------
-		interpolate animation accordingly
+		interpolate and set skeleton's pose's bone data
 		--------------------------------*/
-		TRACY_PROFILE_SCOPE_NC(interpolation, 0x004E41);
-		auto& prevKeyframe = *(timeline.keyframes.begin() + t_info.progressTracker.index);
-		auto& nextKeyframe = *(timeline.keyframes.begin() + t_info.progressTracker.index + 1u);
-		auto prevTime = prevKeyframe.time;
-		auto nextTime = nextKeyframe.time;
-		TRACY_PROFILE_SCOPE_END();
-
-		TRACY_PROFILE_SCOPE_NC(calculate_percentage, 0x122F59);
-		//current progress in keyframe over total time in between keyframes
-		float percentage = (updatedTimer - prevTime) / (nextTime - prevTime);
-		TRACY_PROFILE_SCOPE_END();
-
 		TRACY_PROFILE_SCOPE_NC(get_interpolated_value, 0x122F59);
-		KeyFrame::DataType interpolated_value = GetInterpolatedValue(
-			t_info.progressTracker.timeline->rttr_type, prevKeyframe.data, nextKeyframe.data, percentage);
-		TRACY_PROFILE_SCOPE_END();
-
-		/*--------------------------------
-		set related game object's data - not set here anymore
-		--------------------------------*/
-		/*
-		TRACY_PROFILE_SCOPE_NC(set_game_object, 0x004E41);
-		//get a ptr to the component
-		auto ptr = t_info.tracker_info.system.Get_Ecs_World()->get_component(
-			go.GetEntity(), t_info.progressTracker.timeline->component_hash);
-
-		//get the instance
-		auto rttr_instance = hash_to_instance[t_info.progressTracker.timeline->component_hash](ptr);
-		//set the value
-		//if (interpolated_value.get_type() == rttr::type::get< glm::vec3>()) return;
-
-		auto result = t_info.progressTracker.timeline->rttr_property.set_value(rttr_instance, interpolated_value);
-		if (result == false)
-		{
-			auto type_name = interpolated_value.get_type().get_name();
-			auto correct_Type_name = t_info.progressTracker.timeline->rttr_property.get_type().get_name();
-			auto temp = rttr::type::get<oo::TransformComponent::quat>().get_name();
-			assert(result);
-		}
-		TRACY_PROFILE_SCOPE_END();
-		*/
-		/*--------------------------------
-		set skeleton's pose's bone data
-		--------------------------------*/
-		static const auto vec3_type = rttr::type::get<glm::vec3>();
-
-		if (interpolated_value.get_type() == vec3_type)
+		size_t const index = t_info.progressTracker.index;
+		if (channel.quat_values.empty() == false)
 		{
-			t_info.tracker_info.comp.skeleton.SetPoseBlended_Bone_vec3_property(
+			skeleton.SetPose_Bone_Quaternion_property(
 				pose_index,
-				AnimationSkeleton::CURRENT_POSE_INDEX,
-				quick_blend_weight,
 				timeline.boneID,
-				timeline.rttr_property,
-				interpolated_value.get_value< glm::vec3>());
+				SampleChannel(channel.times, channel.quat_values, index, updatedTimer));
 		}
-		else // quaternion
+		else
 		{
-			t_info.tracker_info.comp.skeleton.SetPoseBlended_Bone_Quaternion_property(
+			skeleton.SetPose_Bone_vec3_property(
 				pose_index,
-				AnimationSkeleton::CURRENT_POSE_INDEX,
-				quick_blend_weight,
 				timeline.boneID,
-				interpolated_value.get_value<glm::quat>());
+				timeline.rttr_property,
+				SampleChannel(channel.times, channel.vec3_values, index, updatedTimer));
 		}
+		TRACY_PROFILE_SCOPE_END();
 	}
 	//go through all progress trackers and call their update function
 	void UpdateTrackerKeyframeProgress(UpdateTrackerInfo& t_info, float updatedTimer)
@@ -1449,6 +1320,17 @@ namespace oo::Anim::internal
 			//call the respective update function on this tracker
 			progressTracker.updatefunction(p_info, updatedTimer);
 		}
+
+		//quick blend from the current pose into the sampled pose in one go,
+		//the output pose is what gets applied while in transition
+		auto const& transition_info = t_info.tracker.transition_info;
+		auto& skeleton = t_info.comp.skeleton;
+		skeleton.BlendPoses(
+			AnimationSkeleton::OUTPUT_POSE_INDEX,
+			AnimationSkeleton::CURRENT_POSE_INDEX,
+			transition_info.pose_index,
+			transition_info.quick_blend_weight);
+		skeleton.ClearChanged(transition_info.pose_index);
 	}
 
 	void ResetTrackerProgress(AnimationTracker& tracker)
@@ -1489,7 +1371,7 @@ namespace oo::Anim::internal
 			//eventqueue.emplace_back(info.uuid , events[tracker.nextEvent_index].script_function_info);
 			
 			//thread safe version
-			info.system.AddToScriptEventQueue(info.uuid, events[tracker.nextEvent_index].script_function_info);
+			info.system.AddToScriptEventQueue(info.entity, info.uuid, events[tracker.nextEvent_index].script_function_info);
 			
 			//update index
 			++tracker.nextEvent_index;
@@ -1693,6 +1575,7 @@ namespace oo::Anim::internal
 		ResetTriggers(info, *link);
 		info.tracker.pipeline_buffer.reserve(info.tracker.trackers.size());
 		//TODO: transitions
+		bool const was_in_transition = info.tracker.transition_info.in_transition;
 		info.tracker.transition_info.in_transition = true;
 		info.tracker.transition_info.link = link;
 		info.tracker.transition_info.transition_timer = 0.f;
@@ -1717,11 +1600,14 @@ namespace oo::Anim::internal
 
 		BindAnimTransitionTrackersToGameobject(info, info.tracker);
 
-		//if in transition, copy pose from next to current
-		if (info.tracker.transition_info.in_transition)
+		//if in transition, blend from the pose that was being shown
+		if (was_in_transition)
 		{
-			info.comp.skeleton.CopyPose(AnimationSkeleton::NEXT_POSE_INDEX, AnimationSkeleton::CURRENT_POSE_INDEX);
+			info.comp.skeleton.CopyPose(AnimationSkeleton::OUTPUT_POSE_INDEX, AnimationSkeleton::CURRENT_POSE_INDEX);
 		}
+		//bones the destination does not sample then blend into themselves and stay unchanged
+		info.comp.skeleton.CopyPose(AnimationSkeleton::CURRENT_POSE_INDEX, AnimationSkeleton::NEXT_POSE_INDEX);
+		info.comp.skeleton.ClearChanged(AnimationSkeleton::NEXT_POSE_INDEX);
 	}
 
 	void UpdateTracker(UpdateTrackerInfo& t_info)
@@ -2231,6 +2117,17 @@ namespace oo::Anim::internal
 		}*/
 	}
 
+	void InsertChannelKeyFrame(KeyFrameChannel& channel, size_t index, KeyFrame const& keyframe)
+	{
+		DataVariant const value = DataVariant_From_RTTRVariant(keyframe.data);
+
+		channel.times.emplace(channel.times.begin() + index, keyframe.time);
+		if (auto const quat = std::get_if<glm::quat>(&value))
+			channel.quat_values.emplace(channel.quat_values.begin() + index, *quat);
+		else
+			channel.vec3_values.emplace(channel.vec3_values.begin() + index, std::get<glm::vec3>(value));
+	}
+
 	KeyFrame* AddKeyframeToTimeline(Timeline& timeline, KeyFrame const& keyframe)
 	{
 		assert(KeyframeMatchesTimeline(timeline, keyframe));
@@ -2242,6 +2139,7 @@ namespace oo::Anim::internal
 			if (Equal(kf.time, keyframe.time))
 			{
 				kf.data = keyframe.data;
+				BakeKeyFrameChannel(timeline);
 				return &kf;
 			}
 			//first keyframe that is past the inserted keyframe time
@@ -2251,11 +2149,28 @@ namespace oo::Anim::internal
 			}
 			++index;
 		}
-		//insert
+		//insert, mirrored into the channel so loading a fbx doesn't rebake per keyframe
+		if (timeline.type == Timeline::TYPE::FBX_ANIM)
+			InsertChannelKeyFrame(timeline.channel, index, keyframe);
+
 		auto iterator = timeline.keyframes.begin() + index;
 		return &(*(timeline.keyframes.emplace(iterator, keyframe)));
 	}
 
+	void BakeKeyFrameChannel(Timeline& timeline)
+	{
+		auto& channel = timeline.channel;
+		channel.times.clear();
+		channel.vec3_values.clear();
+		channel.quat_values.clear();
+
+		if (timeline.type != Timeline::TYPE::FBX_ANIM) return;
+
+		channel.times.reserve(timeline.keyframes.size());
+		for (auto const& kf : timeline.keyframes)
+			InsertChannelKeyFrame(channel, channel.times.size(), kf);
+	}
+
 	ScriptEvent* AddScriptEventToAnimation(Animation& animation, ScriptEvent const& scriptevent)
 	{
 		//check if valid script function here later
@@ -2702,5 +2617,6 @@ namespace oo::Anim::internal
 		timeline.keyframes.erase(timeline.keyframes.begin() + index);
 
 		AddKeyframeToTimeline(timeline, kf);
+		BakeKeyFrameChannel(timeline);
 	}
 }
\ No newline at end of file
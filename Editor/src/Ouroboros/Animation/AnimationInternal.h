@@ -21,6 +21,12 @@ Technology is prohibited.
 #include <rapidjson/document.h>
 #include <rapidjson/reader.h>
 
+namespace oo
+{
+	class Scene;
+	class GameObject;
+}
+
 namespace oo::Anim::internal
 {
 	//serialization
@@ -80,6 +86,7 @@ namespace oo::Anim::internal
 	void UpdateScriptEventProgress(UpdateTrackerInfo& info, float updatedTimer);
 
 	KeyFrame* GetCurrentKeyFrame(ProgressTracker& tracker);
+	GameObject* GetTimelineGameObject(Scene& scene, ProgressTracker& progressTracker);
 
 	void UpdateTrackerTransitionProgress(UpdateTrackerInfo& info, float updatedTimer);
 
@@ -133,7 +140,10 @@ namespace oo::Anim::internal
 
 	bool KeyframeMatchesTimeline(Timeline& timeline, KeyFrame const& keyframe);
 
+	void InsertChannelKeyFrame(KeyFrameChannel& channel, size_t index, KeyFrame const& keyframe);
 	KeyFrame* AddKeyframeToTimeline(Timeline& timeline, KeyFrame const& keyframe);
+	//rebuilds the typed channel from the timeline's keyframes
+	void BakeKeyFrameChannel(Timeline& timeline);
 
 	ScriptEvent* AddScriptEventToAnimation(Animation& animation, ScriptEvent const& scriptevent);
 
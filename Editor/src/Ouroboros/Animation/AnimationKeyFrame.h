@@ -31,6 +31,16 @@ namespace oo::Anim
 		RTTR_ENABLE();
 	};
 
+	//typed copy of a fbx timeline's keyframes so sampling never goes through rttr
+	//kept in sync with the timeline's keyframes, which stay the serialized form
+	struct KeyFrameChannel
+	{
+		std::vector<float> times{};
+		//only one of these is filled, position & scale use vec3, rotation uses quat
+		std::vector<glm::vec3> vec3_values{};
+		std::vector<glm::quat> quat_values{};
+	};
+
 	struct ScriptEvent
 	{
 		//scriptevent handle or something variable HERE
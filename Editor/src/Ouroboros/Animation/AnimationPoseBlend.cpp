@@ -0,0 +1,73 @@
+/************************************************************************************//*!
+\file           AnimationPoseBlend.cpp
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          
+Kernels that blend whole poses at once, 4 floats at a time
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#include "pch.h"
+#include "AnimationPoseBlend.h"
+
+#include <cmath>
+#include <xmmintrin.h>
+
+namespace oo::Anim::internal
+{
+	static_assert(sizeof(glm::quat) == 4 * sizeof(float));
+
+	void BlendFloats(float* dst, float const* a, float const* b, size_t count, float weight)
+	{
+		__m128 const w = _mm_set1_ps(weight);
+
+		size_t i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			__m128 const va = _mm_loadu_ps(a + i);
+			__m128 const vb = _mm_loadu_ps(b + i);
+			_mm_storeu_ps(dst + i, _mm_add_ps(va, _mm_mul_ps(_mm_sub_ps(vb, va), w)));
+		}
+		for (; i < count; ++i)
+			dst[i] = a[i] + (b[i] - a[i]) * weight;
+	}
+
+	void NlerpQuats(glm::quat* dst, glm::quat const* a, glm::quat const* b, size_t count, float weight)
+	{
+		float* const out = reinterpret_cast<float*>(dst);
+		float const* const in_a = reinterpret_cast<float const*>(a);
+		float const* const in_b = reinterpret_cast<float const*>(b);
+
+		__m128 const w = _mm_set1_ps(weight);
+		__m128 const sign_bit = _mm_set1_ps(-0.0f);
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			__m128 const va = _mm_loadu_ps(in_a + i * 4);
+			__m128 vb = _mm_loadu_ps(in_b + i * 4);
+
+			//horizontal dot product, broadcast to every lane
+			__m128 dot = _mm_mul_ps(va, vb);
+			dot = _mm_add_ps(dot, _mm_shuffle_ps(dot, dot, _MM_SHUFFLE(2, 3, 0, 1)));
+			dot = _mm_add_ps(dot, _mm_shuffle_ps(dot, dot, _MM_SHUFFLE(1, 0, 3, 2)));
+
+			//negate b if it is on the other hemisphere
+			vb = _mm_xor_ps(vb, _mm_and_ps(dot, sign_bit));
+
+			__m128 result = _mm_add_ps(va, _mm_mul_ps(_mm_sub_ps(vb, va), w));
+
+			__m128 length_sq = _mm_mul_ps(result, result);
+			length_sq = _mm_add_ps(length_sq, _mm_shuffle_ps(length_sq, length_sq, _MM_SHUFFLE(2, 3, 0, 1)));
+			length_sq = _mm_add_ps(length_sq, _mm_shuffle_ps(length_sq, length_sq, _MM_SHUFFLE(1, 0, 3, 2)));
+
+			//full precision divide, rsqrt drifts too much once poses get blended every frame
+			result = _mm_div_ps(result, _mm_sqrt_ps(length_sq));
+			_mm_storeu_ps(out + i * 4, result);
+		}
+	}
+}
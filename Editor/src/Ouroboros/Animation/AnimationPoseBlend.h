@@ -0,0 +1,43 @@
+/************************************************************************************//*!
+\file           AnimationPoseBlend.h
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          
+Kernels that blend whole poses at once, 4 floats at a time
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#pragma once
+#include <cstddef>
+
+#include <glm/gtc/quaternion.hpp>
+
+namespace oo::Anim::internal
+{
+	/*
+	* dst[i] = a[i] + (b[i] - a[i]) * weight for count floats
+	* dst may alias a or b
+	*/
+	void BlendFloats(float* dst, float const* a, float const* b, size_t count, float weight);
+
+	/*
+	* normalized lerp from a to b for count quaternions, b is flipped onto a's
+	* hemisphere first so the blend takes the shorter path
+	* dst may alias a or b
+	*/
+	void NlerpQuats(glm::quat* dst, glm::quat const* a, glm::quat const* b, size_t count, float weight);
+
+	//vec3s are blended as plain floats, any padding lanes just get blended along
+	inline void BlendVec3s(glm::vec3* dst, glm::vec3 const* a, glm::vec3 const* b, size_t count, float weight)
+	{
+		static_assert(sizeof(glm::vec3) % sizeof(float) == 0);
+		constexpr size_t floats_per_vec3 = sizeof(glm::vec3) / sizeof(float);
+		BlendFloats(reinterpret_cast<float*>(dst), reinterpret_cast<float const*>(a),
+			reinterpret_cast<float const*>(b), count * floats_per_vec3, weight);
+	}
+}
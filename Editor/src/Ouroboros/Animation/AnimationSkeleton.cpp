@@ -1,65 +1,60 @@
 #include "pch.h"
 #include "AnimationSkeleton.h"
+#include "AnimationPoseBlend.h"
 #include "glm/common.hpp"
 
 
 void oo::Anim::AnimationSkeleton::SetCurrentPose_Bone_Quaternion_property(UID boneID, glm::quat const& rotation)
 {
-	auto& bone = CurrentPoseBone(boneID);
-	bone.rotation = rotation;
-	bone.changed = true;
+	SetPose_Bone_Quaternion_property(CURRENT_POSE_INDEX, boneID, rotation);
 }
 
 void oo::Anim::AnimationSkeleton::SetCurrentPose_Bone_vec3_property(UID boneID, rttr::property prop, glm::vec3 const& value)
 {
-	auto& bone = CurrentPoseBone(boneID);
-	//either its setting position or scale for vec3 type
-	if (prop == transform_Position_property)
-		bone.position = value;
-	else
-		bone.scale = value;
-
-	bone.changed = true;
+	SetPose_Bone_vec3_property(CURRENT_POSE_INDEX, boneID, prop, value);
 }
 
 void oo::Anim::AnimationSkeleton::SetPose_Bone_Quaternion_property(uint pose_index, UID boneID, glm::quat const& rotation)
 {
-	auto& bone = PoseBone(pose_index, boneID);
-	bone.rotation = rotation;
-	bone.changed = true;
+	auto& pose = poses[pose_index];
+	auto const index = pose.GetBoneIndex(boneID);
+	pose.rotations[index] = rotation;
+	pose.changed[index] = true;
 }
 
 void oo::Anim::AnimationSkeleton::SetPose_Bone_vec3_property(uint pose_index, UID boneID, rttr::property prop, glm::vec3 const& value)
 {
-	auto& bone = PoseBone(pose_index, boneID);
+	auto& pose = poses[pose_index];
+	auto const index = pose.GetBoneIndex(boneID);
 	//either its setting position or scale for vec3 type
 	if (prop == transform_Position_property)
-		bone.position = value;
+		pose.positions[index] = value;
 	else
-		bone.scale = value;
+		pose.scales[index] = value;
 
-	bone.changed = true;
+	pose.changed[index] = true;
 }
 
 void oo::Anim::AnimationSkeleton::SetPoseBlended_Bone_Quaternion_property(uint pose_index, uint blend_pose_index, float blend_weight, UID boneID, glm::quat const& rotation)
 {
-	auto& bone = PoseBone(pose_index, boneID);
-	auto& inputbone = PoseBone(blend_pose_index, boneID);
-	bone.rotation = glm::slerp(inputbone.rotation, rotation, blend_weight);
-	bone.changed = true;
+	auto& pose = poses[pose_index];
+	auto const index = pose.GetBoneIndex(boneID);
+	pose.rotations[index] = glm::slerp(poses[blend_pose_index].rotations[index], rotation, blend_weight);
+	pose.changed[index] = true;
 }
 
 void oo::Anim::AnimationSkeleton::SetPoseBlended_Bone_vec3_property(uint pose_index, uint blend_pose_index, float blend_weight, UID boneID, rttr::property prop, glm::vec3 const& value)
 {
-	auto& bone = PoseBone(pose_index, boneID);
-	auto& inputbone = PoseBone(blend_pose_index, boneID);
+	auto& pose = poses[pose_index];
+	auto& inputpose = poses[blend_pose_index];
+	auto const index = pose.GetBoneIndex(boneID);
 	//either its setting position or scale for vec3 type
 	if (prop == transform_Position_property)
-		bone.position = glm::mix(inputbone.position, value, blend_weight);
+		pose.positions[index] = glm::mix(inputpose.positions[index], value, blend_weight);
 	else
-		bone.scale = glm::mix(inputbone.scale, value, blend_weight);
+		pose.scales[index] = glm::mix(inputpose.scales[index], value, blend_weight);
 
-	bone.changed = true;
+	pose.changed[index] = true;
 }
 
 void oo::Anim::AnimationSkeleton::Apply_CurrentPose_To_Gameobjects(Scene& scene)
@@ -80,49 +75,57 @@ void oo::Anim::AnimationSkeleton::Apply_OutputPose_To_Gameobjects(Scene& scene)
 void oo::Anim::AnimationSkeleton::CopyPose(uint from, uint to)
 {
 	auto& to_pose = poses[to];
-	auto& from_bones = poses[from].bones;
+	auto& from_pose = poses[from];
 
-	uint index{ 0ul };
+	//every pose has the same bones in the same order, see SetBoneData
+	to_pose.rotations = from_pose.rotations;
+	to_pose.positions = from_pose.positions;
+	to_pose.scales = from_pose.scales;
+	to_pose.changed = from_pose.changed;
+}
 
-	for (auto& bone : to_pose.bones)
-	{
-		bone = from_bones[index];
-		++index;
-	}
+void oo::Anim::AnimationSkeleton::ClearChanged(uint pose_index)
+{
+	auto& pose = poses[pose_index];
+	std::fill(pose.changed.begin(), pose.changed.end(), uint8_t{ 0 });
+}
+
+void oo::Anim::AnimationSkeleton::BlendPoses(uint pose_index, uint src_pose_index, uint dst_pose_index, float blend_weight)
+{
+	auto& pose = poses[pose_index];
+	auto const& src = poses[src_pose_index];
+	auto const& dst = poses[dst_pose_index];
+	auto const count = pose.boneIDs.size();
+
+	internal::BlendVec3s(pose.positions.data(), src.positions.data(), dst.positions.data(), count, blend_weight);
+	internal::NlerpQuats(pose.rotations.data(), src.rotations.data(), dst.rotations.data(), count, blend_weight);
+	internal::BlendVec3s(pose.scales.data(), src.scales.data(), dst.scales.data(), count, blend_weight);
 
+	//bones neither input touched keep what their gameobjects already hold
+	for (size_t index = 0; index < count; ++index)
+		pose.changed[index] = static_cast<uint8_t>(pose.changed[index] | src.changed[index] | dst.changed[index]);
 }
 
 void oo::Anim::AnimationSkeleton::Blend_OutputPose_with_NextPose(float blendFactor)
 {
-	auto& outputPose = poses[OUTPUT_POSE_INDEX];
-	auto& nextPose = poses[NEXT_POSE_INDEX];
-
-	uint index = 0ul;
-	for (auto& bone : outputPose.bones)
-	{
-		auto& nextBone = nextPose.bones[index];
-		
-		bone.position = glm::mix(bone.position, nextBone.position, blendFactor);
-		bone.rotation = glm::slerp(bone.rotation, nextBone.rotation, blendFactor);
-		bone.scale = glm::mix(bone.scale, nextBone.scale, blendFactor);
-	}
+	BlendPoses(OUTPUT_POSE_INDEX, OUTPUT_POSE_INDEX, NEXT_POSE_INDEX, blendFactor);
 }
 
 void oo::Anim::AnimationSkeleton::Apply_Pose_To_Gameobjects(uint pose_index, Scene& scene)
 {
 	auto& pose = poses[pose_index];
 
-	for (auto& bone : pose.bones)
+	for (size_t index = 0; index < pose.boneIDs.size(); ++index)
 	{
-		if (bone.changed == false) continue;
+		if (pose.changed[index] == false) continue;
 
-		auto go = scene.FindWithInstanceID(bone.gameobjectUUID);
+		auto go = scene.FindRawWithInstanceID(pose.gameobjectUUIDs[index]);
 		auto& transform = go->GetComponent<oo::TransformComponent>();
 
-		transform.SetPosition(bone.position);
-		transform.SetOrientation(bone.rotation);
-		transform.SetScale(bone.scale);
+		transform.SetPosition(pose.positions[index]);
+		transform.SetOrientation(pose.rotations[index]);
+		transform.SetScale(pose.scales[index]);
 
-		bone.changed = false;
+		pose.changed[index] = false;
 	}
 }
@@ -19,44 +19,43 @@ Technology is prohibited.
 #include <unordered_map>
 namespace oo::Anim
 {
-	class SkeletonBone
-	{
-		friend class AnimationSkeleton;
-		friend class Pose;
-		UID boneID{ internal::invalid_ID };
-		UUID gameobjectUUID{};
-		bool changed{ false };
-		
-		glm::quat rotation{ 1.0f, 0.0f, 0.0f, 0.0f };
-		glm::vec3 position{ 0.0f, 0.0f, 0.0f };
-		glm::vec3 scale	  { 1.0f, 1.0f, 1.0f };
-	};
 	//a collection of bones and their transformations
+	//stored as parallel arrays so whole poses can be blended at once
 	class Pose
 	{
 		friend class AnimationSkeleton;
 		std::unordered_map<size_t, uint> uid_to_boneIndex{};
-		std::vector<SkeletonBone> bones{};
+		std::vector<UID> boneIDs{};
+		std::vector<UUID> gameobjectUUIDs{};
+		std::vector<glm::quat> rotations{};
+		std::vector<glm::vec3> positions{};
+		std::vector<glm::vec3> scales{};
+		//not vector<bool>, so bones can be flagged independently
+		std::vector<uint8_t> changed{};
 
-		inline SkeletonBone& GetBone(UID boneID)
+		inline uint GetBoneIndex(UID boneID)
 		{
-			return bones[uid_to_boneIndex[boneID]];
+			return uid_to_boneIndex[boneID];
 		}
 
-		inline SkeletonBone& EnsureBone(UID boneID)
+		inline uint EnsureBone(UID boneID)
 		{
 			if (uid_to_boneIndex.contains(boneID) == false)
 			{
-				uid_to_boneIndex[boneID] = static_cast<uint>(bones.size());
-				bones.emplace_back();
-				bones.back().boneID = boneID;
+				uid_to_boneIndex[boneID] = static_cast<uint>(boneIDs.size());
+				boneIDs.emplace_back(boneID);
+				gameobjectUUIDs.emplace_back();
+				rotations.emplace_back(1.0f, 0.0f, 0.0f, 0.0f);
+				positions.emplace_back(0.0f, 0.0f, 0.0f);
+				scales.emplace_back(1.0f, 1.0f, 1.0f);
+				changed.emplace_back(0);
 			}
-			return GetBone(boneID);
+			return GetBoneIndex(boneID);
 		}
 
 		inline void SetBoneData(UID boneID, UUID gameobjectUUID)
 		{
-			EnsureBone(boneID).gameobjectUUID = gameobjectUUID;
+			gameobjectUUIDs[EnsureBone(boneID)] = gameobjectUUID;
 		}
 	};
 	//a collection of poses that can be blended and applied to their corresponding gameobjects
@@ -69,16 +68,7 @@ namespace oo::Anim
 		rttr::property transform_Scaling_property { rttr::type::get<TransformComponent>().get_property("Scaling") };
 		
 
-		inline SkeletonBone& CurrentPoseBone(UID boneID)
-		{
-			return poses[CURRENT_POSE_INDEX].GetBone(boneID);
-		}
 
-		inline SkeletonBone& PoseBone(uint pose_index, UID boneID)
-		{
-			return poses[pose_index].GetBone(boneID);
-		}
-		
 		inline void Apply_Pose_To_Gameobjects(uint pose_index, Scene& scene);
 	public:
 		static constexpr uint CURRENT_POSE_INDEX = 0;
@@ -106,6 +96,16 @@ namespace oo::Anim
 		void Apply_OutputPose_To_Gameobjects(Scene& scene);
 
 		void CopyPose(uint from, uint to);
+		//marks every bone of the pose as already applied
+		void ClearChanged(uint pose_index);
+
+		/*
+		* blends every bone of two poses at once
+		* pose_index -> pose to write to, may be either of the inputs
+		* blend_weight -> weight of the pose at dst_pose_index, 0 gives src_pose_index
+		* only bones changed in either input are marked changed in pose_index
+		*/
+		void BlendPoses(uint pose_index, uint src_pose_index, uint dst_pose_index, float blend_weight);
 		
 		//QUICK BLEND
 		/*
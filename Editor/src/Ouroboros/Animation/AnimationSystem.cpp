@@ -103,26 +103,18 @@ namespace oo::Anim
 		//m_world->for_each(query, [&](oo::GameObjectComponent& goc, oo::AnimationComponent& animationComp)
 		m_world->parallel_for_each(animationQuery, [&](oo::GameObjectComponent& goc, oo::AnimationComponent& animationComp)
 			{
-				auto go = scene->FindWithInstanceID(goc.Id);
+				auto go = scene->FindRawWithInstanceID(goc.Id);
 				auto& anim_component = animationComp.GetActualComponent();
 				internal::UpdateTrackerInfo info{ *this,anim_component,animationComp.GetTracker(), go->GetEntity(), go->GetInstanceID(), timer::dt() };
 				internal::UpdateTracker(info);
 				if (anim_component.tracker.transition_info.in_transition)
 				{
-					animationComp.GetActualComponent().skeleton.Apply_NextPose_To_Gameobjects(*scene);
+					animationComp.GetActualComponent().skeleton.Apply_OutputPose_To_Gameobjects(*scene);
 				}
 				else
 					animationComp.GetActualComponent().skeleton.Apply_CurrentPose_To_Gameobjects(*scene);
 			});
 
-		for (auto& scriptevent : scriptEventsToBeCalled)
-		{
-			scriptevent.script_function_info.Invoke(scriptevent.uuid);
-		}
-
-		scriptEventsToBeCalled.clear();
-			
-
 		TRACY_PROFILE_SCOPE_END();
 		/*world->for_each(query, [&](AnimationComponent& animationComp) {
 			internal::UpdateTracker(*this, animationComp, animationComp.GetTracker(), 0.016f);
@@ -153,7 +145,7 @@ namespace oo::Anim
 		//world->for_each_entity_and_component(query, [&](Ecs::EntityID entity, oo::AnimationComponent& animationComp) 
 		m_world->parallel_for_each(animationQuery, [&](oo::GameObjectComponent& goc, oo::AnimationComponent& animationComp)
 		{
-			auto go = scene->FindWithInstanceID(goc.Id);
+			auto go = scene->FindRawWithInstanceID(goc.Id);
 			animationComp.Set_Root_Entity(go->GetEntity());
 			internal::InitialiseComponent(animationComp.GetActualComponent());
 		});
@@ -389,7 +381,7 @@ namespace oo::Anim
 		//world->for_each_entity_and_component(query, [&](Ecs::EntityID entity, oo::AnimationComponent& animationComp) 
 		m_world->parallel_for_each(animationQuery, [&](oo::GameObjectComponent& goc, oo::AnimationComponent& animationComp)
 		{
-			auto go = scene->FindWithInstanceID(goc.Id);
+			auto go = scene->FindRawWithInstanceID(goc.Id);
 			if (animationComp.GetActualComponent().root_objectID.value == go->GetEntity().value) return;
 			
 			animationComp.Set_Root_Entity(go->GetEntity());
@@ -37,15 +37,6 @@ namespace oo::Anim
 		static std::set<std::string> modified_animations;
 		static std::set<std::string> modified_animation_trees;
 		bool bindPhaseOver{false};
-
-		struct ScriptEventTicket
-		{
-			oo::UUID uuid;
-			oo::ScriptValue::function_info script_function_info{};
-		};
-		std::vector<ScriptEventTicket> scriptEventsToBeCalled{};
-
-		std::mutex scriptEvents_mutex{};
 	public:
 		struct ModifyAnimationEvent : oo::Event {
 			std::string name{};
@@ -72,15 +63,18 @@ namespace oo::Anim
 			assert(scene);
 			return *scene;
 		}
-		std::vector<ScriptEventTicket>& GetScriptEventQueue()
-		{
-			return scriptEventsToBeCalled;
-		}
-
-		void AddToScriptEventQueue(UUID uid, oo::ScriptValue::function_info const& info)
+		//safe to call from parallel_for_each, the event is invoked on the main thread when the
+		//world plays back its command buffers, in entity order whichever thread hit it.
+		//note this is later than events used to fire: playback is in Scene::EndOfFrameUpdate, so the
+		//event runs after LateUpdate and rendering of the frame it was hit in, along with the other
+		//structural changes of that frame, instead of right after the animation update.
+		//it is not invoked from Run since scripts may touch the physics scene while its step is in flight
+		void AddToScriptEventQueue(Ecs::EntityID entity, UUID uid, oo::ScriptValue::function_info const& info)
 		{
-			std::scoped_lock lock(scriptEvents_mutex);
-			scriptEventsToBeCalled.emplace_back(uid, info);
+			world->get_command_buffer().enqueue(entity.index, [uid, info](Ecs::IECSWorld&)
+				{
+					info.Invoke(uid);
+				});
 		}
 		
 		//test function
@@ -107,6 +107,7 @@ namespace oo::Anim::internal
 				assert(result.is_valid());
 				timeline.keyframes.emplace_back(std::move(new_kf));
 			}
+			internal::BakeKeyFrameChannel(timeline);
 		}
 
 		//generate and set boneID if it is not set yet
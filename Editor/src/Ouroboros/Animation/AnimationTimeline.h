@@ -14,7 +14,9 @@ Technology is prohibited.
 *//*************************************************************************************/
 #pragma once
 #include "Anim_Utils.h"
+#include "AnimationKeyFrame.h"
 #include "Utility/UUID.h"
+#include "Ouroboros/Scene/GameObjectTable.h"
 
 namespace oo::Anim
 {
@@ -40,6 +42,8 @@ namespace oo::Anim
 		DATATYPE datatype{};
 		std::vector<int> children_index{};
 		std::vector<KeyFrame> keyframes{};
+		//filled for FBX_ANIM timelines only
+		KeyFrameChannel channel{};
 		//function pointer to get the component
 		Ecs::GetCompFn* get_componentFn{ nullptr };
 		rttr::type rttr_type{ rttr::type::get<InvalidType>()};
@@ -85,6 +89,8 @@ namespace oo::Anim
 		UpdateFn updatefunction{ nullptr };
 		Timeline* timeline{ nullptr };
 		UUID timeline_gameobject_uid{};
+		//cached so the gameobject doesn't need to be looked up by uuid every update
+		GameObjectTable::Handle timeline_gameobject_handle{};
 
 		ProgressTracker(const Timeline::TYPE _type);
 		static ProgressTracker Create(Timeline::TYPE type);
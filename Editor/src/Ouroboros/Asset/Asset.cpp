@@ -18,10 +18,12 @@ Technology is prohibited.
 
 #include "OO_Vulkan/src/Font.h"
 #include "OO_Vulkan/src/MeshModel.h"
+#include "OO_Vulkan/src/VulkanUtils.h"
 #include "Ouroboros/Animation/Animation.h"
 #include "Ouroboros/Animation/AnimationSystem.h"
 #include "Ouroboros/Animation/AnimationTree.h"
 #include "Ouroboros/Audio/Audio.h"
+#include "Physics/Source/phy.h"
 #include "Utility/IEqual.h"
 
 namespace
@@ -47,6 +49,9 @@ namespace
         // 48 bits of time, 16 bits of sequence number
         return (time.count() << 16) | ++sequence;
     }
+
+    // The model, font and animation loaders share state that is not guarded against parallel loads
+    std::mutex exclusiveLoadMutex;
 }
 
 namespace oo
@@ -88,25 +93,45 @@ namespace oo
 
     void AssetInfo::Reload(AssetInfo::Type t)
     {
-        Unload();
+        const LoadSteps STEPS = GetLoadSteps(t);
+        std::vector<uint8_t> content;
+        if (STEPS.readsContent)
+            content = ReadContent(contentPath);
+        CompleteLoad(t, STEPS, STEPS.decode(contentPath, std::move(content)));
+    }
 
-        type = t;
-        switch (type)
+    AssetInfo::LoadSteps AssetInfo::GetLoadSteps(AssetInfo::Type t)
+    {
+        LoadSteps steps;
+        steps.decode = [](const std::filesystem::path&, std::vector<uint8_t>&&) { return Callback{}; };
+        steps.onAssetDestroy = [](AssetInfo&) {};
+        switch (t)
         {
             case AssetInfo::Type::Texture:
             {
-                // Load texture
-                onAssetCreate = [](AssetInfo& self)
+                // Load texture, decoding the image before the renderer sees it
+                steps.readsContent = true;
+                steps.decode = [](const std::filesystem::path& fp, std::vector<uint8_t>&& content) -> Callback
                 {
-                    std::scoped_lock lock{ self.accessMutex };
-                    auto vc = Application::Get().GetWindow().GetVulkanContext();
-                    auto vr = vc->getRenderer();
-                    auto tid = vr->CreateTexture(self.contentPath.string());
-                    self.data.reserve(2);
-                    self.data.emplace_back(tid);
-                    self.data.emplace_back(vr->GetImguiID(tid));
+                    auto image = std::make_shared<oGFX::FileImageData>();
+                    if (!image->Create(fp.string(), content))
+                    {
+                        LOG_WARN("Failed to decode texture {0}", fp.string());
+                        return {};
+                    }
+                    return [image](AssetInfo& self)
+                    {
+                        std::scoped_lock lock{ self.accessMutex };
+                        auto vc = Application::Get().GetWindow().GetVulkanContext();
+                        auto vr = vc->getRenderer();
+                        auto tid = vr->CreateTexture(*image);
+                        image->Free();
+                        self.data.reserve(2);
+                        self.data.emplace_back(tid);
+                        self.data.emplace_back(vr->GetImguiID(tid));
+                    };
                 };
-                onAssetDestroy = [this](AssetInfo& self)
+                steps.onAssetDestroy = [](AssetInfo& self)
                 {
                     // TODO: Unload texture
                     //const auto& value = self.GetData<AssetInfo::TextureData>();
@@ -116,26 +141,34 @@ namespace oo
             case AssetInfo::Type::Font:
             {
                 // Load texture
-                onAssetCreate = [](AssetInfo& self)
+                steps.exclusive = true;
+                steps.decode = [](const std::filesystem::path& fp, std::vector<uint8_t>&&) -> Callback
                 {
-                    std::scoped_lock lock{ self.accessMutex };
+                    std::scoped_lock exclusiveLock{ exclusiveLoadMutex };
                     auto vc = Application::Get().GetWindow().GetVulkanContext();
                     auto vr = vc->getRenderer();
-                    auto fp = std::shared_ptr<oGFX::Font>(vr->LoadFont(self.contentPath.string()));
-                    self.data.emplace_back(fp);
+                    auto font = std::shared_ptr<oGFX::Font>(vr->LoadFont(fp.string()));
+                    return [font](AssetInfo& self)
+                    {
+                        std::scoped_lock lock{ self.accessMutex };
+                        self.data.emplace_back(font);
+                    };
                 };
-                onAssetDestroy = [this](AssetInfo& self) {};
                 break;
             }
             case AssetInfo::Type::Audio:
             {
                 // Load audio
-                onAssetCreate = [](AssetInfo& self)
+                steps.decode = [](const std::filesystem::path& fp, std::vector<uint8_t>&&) -> Callback
                 {
-                    std::scoped_lock lock{ self.accessMutex };
-                    self.data.emplace_back(audio::CreateSound(self.contentPath.string()));
+                    auto sound = audio::CreateSound(fp.string());
+                    return [sound](AssetInfo& self)
+                    {
+                        std::scoped_lock lock{ self.accessMutex };
+                        self.data.emplace_back(sound);
+                    };
                 };
-                onAssetDestroy = [](AssetInfo& self)
+                steps.onAssetDestroy = [](AssetInfo& self)
                 {
                     std::scoped_lock lock{ self.accessMutex };
                     audio::FreeSound(self.GetData<oo::SoundID>());
@@ -145,13 +178,18 @@ namespace oo
             case AssetInfo::Type::Model:
             {
                 // Load model
-                onAssetCreate = [](AssetInfo& self)
+                steps.exclusive = true;
+                steps.decode = [](const std::filesystem::path& fp, std::vector<uint8_t>&&) -> Callback
                 {
-                    std::scoped_lock lock{ self.accessMutex };
+                    std::scoped_lock exclusiveLock{ exclusiveLoadMutex };
                     auto vc = Application::Get().GetWindow().GetVulkanContext();
                     auto vr = vc->getRenderer();
-                    auto sp = std::shared_ptr<ModelFileResource>(vr->LoadModelFromFile(self.contentPath.string()));
-                    self.data.emplace_back(sp);
+                    auto sp = std::shared_ptr<ModelFileResource>(vr->LoadModelFromFile(fp.string()));
+                    return [sp](AssetInfo& self)
+                    {
+                        std::scoped_lock lock{ self.accessMutex };
+                        self.data.emplace_back(sp);
+                    };
 
                     /*auto anims = Anim::LoadAnimationFromFBX::LoadAnimationFromFBX(self.contentPath.string(), sp.get());
                     auto v = std::vector<std::string>();
@@ -161,37 +199,73 @@ namespace oo
                     }
                     self.data.emplace_back(v);*/
                 };
-                onAssetDestroy = [](AssetInfo& self) {};
+                steps.onAssetDestroy = [](AssetInfo& self)
+                {
+                    // convex hulls are cached by model ID across worlds, drop the hull cooked from this load
+                    // so a reloaded model is cooked again instead of picking up the old shape
+                    myPhysx::physx_system::releaseConvexMesh(static_cast<std::uint64_t>(self.id));
+                };
                 break;
             }
             case AssetInfo::Type::Animation:
             {
                 // Load animation
-                onAssetCreate = [](AssetInfo& self)
+                steps.exclusive = true;
+                steps.decode = [](const std::filesystem::path& fp, std::vector<uint8_t>&&) -> Callback
                 {
-                    std::scoped_lock lock{ self.accessMutex };
+                    std::scoped_lock exclusiveLock{ exclusiveLoadMutex };
                     using namespace Anim;
-                    Animation* anim = AnimationSystem::LoadAnimation(self.contentPath.string());
-                    self.data.emplace_back(anim->name);
-                    self.data.emplace_back(anim->animation_ID);
+                    Animation* anim = AnimationSystem::LoadAnimation(fp.string());
+                    return [name = anim->name, id = anim->animation_ID](AssetInfo& self)
+                    {
+                        std::scoped_lock lock{ self.accessMutex };
+                        self.data.emplace_back(name);
+                        self.data.emplace_back(id);
+                    };
                 };
-                onAssetDestroy = [](AssetInfo& self) {};
                 break;
             }
             case AssetInfo::Type::AnimationTree:
             {
                 // Load animation tree
-                onAssetCreate = [](AssetInfo& self)
+                steps.exclusive = true;
+                steps.decode = [](const std::filesystem::path& fp, std::vector<uint8_t>&&) -> Callback
                 {
+                    std::scoped_lock exclusiveLock{ exclusiveLoadMutex };
                     using namespace Anim;
-                    AnimationTree* animTree = AnimationSystem::LoadAnimationTree(self.contentPath.string());
-                    self.data.emplace_back(animTree->name);
-                    self.data.emplace_back(animTree->treeID);
+                    AnimationTree* animTree = AnimationSystem::LoadAnimationTree(fp.string());
+                    return [name = animTree->name, id = animTree->treeID](AssetInfo& self)
+                    {
+                        self.data.emplace_back(name);
+                        self.data.emplace_back(id);
+                    };
                 };
-                onAssetDestroy = [](AssetInfo& self) {};
                 break;
             }
         }
+        return steps;
+    }
+
+    std::vector<uint8_t> AssetInfo::ReadContent(const std::filesystem::path& fp)
+    {
+        std::vector<uint8_t> content;
+        std::ifstream ifs{ fp, std::ios::binary | std::ios::ate };
+        if (!ifs)
+            return content;
+        content.resize(static_cast<size_t>(ifs.tellg()));
+        ifs.seekg(0);
+        if (!ifs.read(reinterpret_cast<char*>(content.data()), content.size()))
+            content.clear();
+        return content;
+    }
+
+    void AssetInfo::CompleteLoad(AssetInfo::Type t, const LoadSteps& steps, Callback create)
+    {
+        Unload();
+
+        type = t;
+        onAssetCreate = std::move(create);
+        onAssetDestroy = steps.onAssetDestroy;
 
         // Call asset creation callback
         if (onAssetCreate)
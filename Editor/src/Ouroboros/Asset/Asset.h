@@ -27,6 +27,7 @@ Technology is prohibited.
 #include <rttr/variant.h>
 
 #include "OO_Vulkan/src/MeshModel.h"
+#include "OO_Vulkan/src/loader/ModelCache.h"
 #include "Ouroboros/Audio/Audio.h"
 #include "Ouroboros/Core/Application.h"
 #include "Ouroboros/Vulkan/VulkanContext.h"
@@ -38,7 +39,7 @@ Technology is prohibited.
 * 1) Add the type of asset to the AssetInfo::Type enum (in Asset.h).
 * 2) Declare the list of supported extensions for the asset type.
 * 3) Implement the loading and unloading procedure for the corresponding asset in the
-*     AssetInfo::Reload(AssetInfo::Type) method (in Asset.cpp).
+*     AssetInfo::GetLoadSteps(AssetInfo::Type) method (in Asset.cpp).
 *
 ****************************************************************************************/
 
@@ -80,6 +81,19 @@ namespace oo
             _COUNT,
         };
 
+        /// <summary>
+        /// How data of a type is loaded, split into steps that may run on different threads.
+        /// </summary>
+        struct LoadSteps
+        {
+            using Decode = std::function<Callback(const std::filesystem::path& fp, std::vector<uint8_t>&& content)>;
+
+            bool readsContent = false;  // decode is given the contents of the file
+            bool exclusive = false;     // decode calls loaders that only load one thing at a time
+            Decode decode;              // runs on any thread, returns what completes the load on the main thread
+            Callback onAssetDestroy;
+        };
+
         /* --------------------------------------------------------------------------- */
         /* Constants                                                                   */
         /* --------------------------------------------------------------------------- */
@@ -124,6 +138,28 @@ namespace oo
         /// <param name="type">The explicit type of asset to load as.</param>
         void Reload(AssetInfo::Type type);
 
+        /// <summary>
+        /// Retrieves how data of a type is loaded.
+        /// </summary>
+        /// <param name="type">The type of asset.</param>
+        /// <returns>The load steps.</returns>
+        static LoadSteps GetLoadSteps(AssetInfo::Type type);
+
+        /// <summary>
+        /// Reads the contents of a file.
+        /// </summary>
+        /// <param name="fp">The file path.</param>
+        /// <returns>The contents, empty if the file could not be read.</returns>
+        static std::vector<uint8_t> ReadContent(const std::filesystem::path& fp);
+
+        /// <summary>
+        /// Replaces the data in the asset with newly decoded data.
+        /// </summary>
+        /// <param name="type">The type of asset the data was loaded as.</param>
+        /// <param name="steps">The load steps the data was decoded with.</param>
+        /// <param name="create">What decoding returned.</param>
+        void CompleteLoad(AssetInfo::Type type, const LoadSteps& steps, Callback create);
+
         /// <summary>
         /// Unloads the data in the asset.
         /// </summary>
@@ -179,6 +215,7 @@ namespace oo
 
         static constexpr AssetID ID_NULL = AssetInfo::ID_NULL;
         static constexpr Extension EXT_META = ".meta";
+        static constexpr Extension EXT_COOKED = oGFX::ModelCache::EXTENSION;
         static constexpr ExtensionList<5> EXTS_TEXTURE = { ".png", ".jpg", ".jpeg", ".dds", ".tga" };
         static constexpr ExtensionList<2> EXTS_FONT = { ".ttf", ".otf" };
         static constexpr ExtensionList<3> EXTS_AUDIO = { ".ogg", ".mp3", ".wav" };
@@ -0,0 +1,407 @@
+/************************************************************************************//*!
+\file           AssetIndex.cpp
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Contains the definition for the AssetIndex class.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+
+#include "pch.h"
+
+#include "AssetIndex.h"
+
+#include "Ouroboros/Asset/AssetManager.h"
+#include "Ouroboros/Asset/BinaryIO.h"
+#include "Ouroboros/TracyProfiling/OO_TracyProfiler.h"
+
+namespace
+{
+    struct ScannedFile
+    {
+        std::string key;
+        std::int64_t writeTime;
+        std::uint64_t size;
+        bool isDirectory;
+    };
+
+    std::int64_t toTicks(const std::filesystem::file_time_type& t)
+    {
+        return static_cast<std::int64_t>(t.time_since_epoch().count());
+    }
+
+    bool isUnder(const std::string& key, const std::string& dir)
+    {
+        return dir.empty() ||
+               (key.size() > dir.size() && key[dir.size()] == '/' && key.compare(0, dir.size(), dir) == 0);
+    }
+
+    std::optional<std::string> relativeKey(const std::filesystem::path& fp, const std::filesystem::path& base)
+    {
+        const std::filesystem::path REL = fp.lexically_normal().lexically_relative(base);
+        if (REL.empty())
+            return std::nullopt;
+        std::string key = REL.generic_string();
+        if (key == ".")
+            return std::string{};
+        if (key.starts_with(".."))
+            return std::nullopt;
+        return key;
+    }
+}
+
+namespace oo
+{
+    AssetIndex::AssetIndex(const std::filesystem::path& root)
+        : root{ std::filesystem::exists(root) ? std::filesystem::canonical(root) : std::filesystem::absolute(root) }
+        , rootGiven{ std::filesystem::absolute(root).lexically_normal() }
+    {
+    }
+
+    bool AssetIndex::Load(const std::filesystem::path& fp)
+    {
+        std::unique_lock lock{ mutex };
+        entries.clear();
+
+        std::ifstream ifs = std::ifstream(fp, std::ios::binary | std::ios::ate);
+        if (!ifs)
+            return false;
+        const std::streamoff fileSize = ifs.tellg();
+        ifs.seekg(0);
+        // counts and lengths come from disk, never trust one past what the file still holds
+        auto bytesLeft = [&]() -> std::uint64_t
+        {
+            const std::streamoff position = ifs.tellg();
+            return position < 0 ? 0 : static_cast<std::uint64_t>(fileSize - position);
+        };
+
+        std::uint32_t magic = 0;
+        std::uint32_t version = 0;
+        std::uint64_t count = 0;
+        BinaryIO::Read(ifs, magic);
+        BinaryIO::Read(ifs, version);
+        BinaryIO::Read(ifs, count);
+        if (!ifs || magic != FILE_MAGIC || version != FILE_VERSION)
+            return false;
+        if (count > bytesLeft())
+            return false;
+
+        for (std::uint64_t i = 0; i < count; ++i)
+        {
+            std::uint32_t length = 0;
+            BinaryIO::Read(ifs, length);
+            if (!ifs || length > bytesLeft())
+            {
+                entries.clear();
+                return false;
+            }
+            std::string key(length, '\0');
+            ifs.read(key.data(), length);
+
+            Entry entry;
+            std::uint8_t isDirectory = 0;
+            BinaryIO::Read(ifs, entry.writeTime);
+            BinaryIO::Read(ifs, entry.size);
+            BinaryIO::Read(ifs, entry.metaWriteTime);
+            BinaryIO::Read(ifs, entry.id);
+            BinaryIO::Read(ifs, isDirectory);
+            entry.isDirectory = isDirectory != 0;
+            if (!ifs)
+            {
+                // truncated, a full scan is cheaper to trust than half a record
+                entries.clear();
+                return false;
+            }
+            entries.emplace_hint(entries.end(), std::move(key), entry);
+        }
+        return true;
+    }
+
+    bool AssetIndex::Save(const std::filesystem::path& fp) const
+    {
+        std::shared_lock lock{ mutex };
+
+        // write beside the old file and swap, so a crash mid-write never leaves a torn index
+        std::filesystem::path fpTemp = fp;
+        fpTemp += ".tmp";
+        {
+            std::ofstream ofs = std::ofstream(fpTemp, std::ios::binary | std::ios::trunc);
+            if (!ofs)
+                return false;
+
+            BinaryIO::Write(ofs, FILE_MAGIC);
+            BinaryIO::Write(ofs, FILE_VERSION);
+            BinaryIO::Write(ofs, static_cast<std::uint64_t>(entries.size()));
+            for (const auto& [key, entry] : entries)
+            {
+                BinaryIO::Write(ofs, static_cast<std::uint32_t>(key.size()));
+                ofs.write(key.data(), key.size());
+                BinaryIO::Write(ofs, entry.writeTime);
+                BinaryIO::Write(ofs, entry.size);
+                BinaryIO::Write(ofs, entry.metaWriteTime);
+                BinaryIO::Write(ofs, entry.id);
+                BinaryIO::Write(ofs, static_cast<std::uint8_t>(entry.isDirectory));
+            }
+            if (!ofs)
+                return false;
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(fpTemp, fp, ec);
+        return !ec;
+    }
+
+    AssetIndex::ChangeList AssetIndex::Scan(const std::vector<std::filesystem::path>& dirs, bool trustRecord)
+    {
+        TRACY_PROFILE_SCOPE_NC(ASSET_INDEX_SCAN, tracy::Color::Aquamarine2);
+
+        // Drop directories already covered by another one
+        std::vector<std::string> scanDirs;
+        if (dirs.empty())
+            scanDirs.emplace_back();
+        for (const auto& dir : dirs)
+        {
+            std::string key = dir.lexically_normal().generic_string();
+            if (key == "." || key == "./")
+                key.clear();
+            while (!key.empty() && key.back() == '/')
+                key.pop_back();
+            scanDirs.emplace_back(std::move(key));
+        }
+        std::sort(scanDirs.begin(), scanDirs.end());
+        scanDirs.erase(std::unique(scanDirs.begin(), scanDirs.end()), scanDirs.end());
+        {
+            // a parent always sorts before what is under it
+            std::vector<std::string> kept;
+            for (auto& dir : scanDirs)
+            {
+                if (std::none_of(kept.begin(), kept.end(), [&dir](const std::string& parent) { return isUnder(dir, parent); }))
+                    kept.emplace_back(std::move(dir));
+            }
+            scanDirs = std::move(kept);
+        }
+
+        // One walk, collecting contents and the write times of their meta files
+        std::vector<ScannedFile> found;
+        std::unordered_map<std::string, std::int64_t> metaTimes;
+        std::vector<std::string> cookedKeys;
+        for (const auto& dir : scanDirs)
+        {
+            const std::filesystem::path DIR = dir.empty() ? root : root / std::filesystem::path{ dir };
+            std::error_code ec;
+            auto it = std::filesystem::recursive_directory_iterator(DIR, std::filesystem::directory_options::skip_permission_denied, ec);
+            for (; !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec))
+            {
+                const std::filesystem::directory_entry& file = *it;
+                std::string key = file.path().lexically_relative(DIR).generic_string();
+                if (!dir.empty())
+                    key = dir + '/' + key;
+
+                // Files can vanish mid walk, those are picked up by the next scan
+                std::error_code ecFile;
+                const auto WRITE_TIME = toTicks(file.last_write_time(ecFile));
+                if (ecFile)
+                    continue;
+
+                if (file.path().extension().string() == Asset::EXT_META)
+                {
+                    key.resize(key.size() - std::char_traits<char>::length(Asset::EXT_META));
+                    metaTimes.emplace(std::move(key), WRITE_TIME);
+                    continue;
+                }
+
+                // Cooked models sit beside their source like meta files, they are not assets themselves
+                if (file.path().extension().string() == Asset::EXT_COOKED)
+                {
+                    key.resize(key.size() - std::char_traits<char>::length(Asset::EXT_COOKED));
+                    cookedKeys.emplace_back(std::move(key));
+                    continue;
+                }
+
+                const bool IS_DIRECTORY = file.is_directory(ecFile);
+                const std::uint64_t SIZE = IS_DIRECTORY ? 0 : file.file_size(ecFile);
+                if (ecFile)
+                    continue;
+                found.emplace_back(ScannedFile{ std::move(key), WRITE_TIME, SIZE, IS_DIRECTORY });
+            }
+        }
+
+        // Compare against the record, only opening meta files of what looks different
+        ChangeList changes;
+        std::vector<std::pair<std::string, Entry>> updated;
+        std::vector<std::string> erased;
+        std::unordered_set<std::string> seen;
+        seen.reserve(found.size());
+        for (auto& file : found)
+        {
+            seen.emplace(file.key);
+            const auto META_IT = metaTimes.find(file.key);
+            const auto RECORD_IT = entries.find(file.key);
+            // A directory's write time moves whenever something inside it does, only its meta file matters
+            if (trustRecord && RECORD_IT != entries.end() && META_IT != metaTimes.end() &&
+                RECORD_IT->second.isDirectory == file.isDirectory &&
+                RECORD_IT->second.metaWriteTime == META_IT->second &&
+                (file.isDirectory || (RECORD_IT->second.writeTime == file.writeTime && RECORD_IT->second.size == file.size)))
+                continue;
+
+            const std::filesystem::path FP = root / std::filesystem::path{ file.key };
+            const AssetMetaContent META = AssetManager::ensureMeta(FP);
+            if (META.id == Asset::ID_NULL)
+                continue;
+
+            Entry entry{ file.writeTime, file.size, 0, META.id, file.isDirectory };
+            if (META_IT != metaTimes.end())
+            {
+                entry.metaWriteTime = META_IT->second;
+            }
+            else
+            {
+                // Meta file was just created
+                std::filesystem::path fpMeta = FP;
+                fpMeta += Asset::EXT_META;
+                std::error_code ec;
+                entry.metaWriteTime = toTicks(std::filesystem::last_write_time(fpMeta, ec));
+            }
+
+            if (RECORD_IT == entries.end())
+            {
+                changes.emplace_back(Change{ Change::Kind::Added, META.id, FP, {}, file.isDirectory });
+            }
+            else if (RECORD_IT->second.id != META.id)
+            {
+                // Meta file was replaced
+                changes.emplace_back(Change{ Change::Kind::Removed, RECORD_IT->second.id, FP, {}, file.isDirectory });
+                changes.emplace_back(Change{ Change::Kind::Added, META.id, FP, {}, file.isDirectory });
+            }
+            else if (!file.isDirectory && (RECORD_IT->second.writeTime != file.writeTime || RECORD_IT->second.size != file.size))
+            {
+                changes.emplace_back(Change{ Change::Kind::Modified, META.id, FP, {}, file.isDirectory });
+            }
+            updated.emplace_back(std::move(file.key), entry);
+        }
+
+        // Whatever was recorded under the scanned directories but not found is gone
+        std::unordered_map<AssetID, std::pair<std::string, bool>> missing;
+        for (const auto& dir : scanDirs)
+        {
+            auto it = dir.empty() ? entries.begin() : entries.lower_bound(dir + '/');
+            for (; it != entries.end() && isUnder(it->first, dir); ++it)
+            {
+                if (seen.contains(it->first))
+                    continue;
+                missing.emplace(it->second.id, std::pair{ it->first, it->second.isDirectory });
+                erased.emplace_back(it->first);
+            }
+        }
+
+        // An addition carrying a recorded ID is a move
+        std::unordered_map<AssetID, std::string> recordedByID;
+        for (auto& change : changes)
+        {
+            if (change.kind != Change::Kind::Added)
+                continue;
+
+            if (auto it = missing.find(change.id); it != missing.end())
+            {
+                change.kind = Change::Kind::Moved;
+                change.oldPath = root / std::filesystem::path{ it->second.first };
+                missing.erase(it);
+                continue;
+            }
+
+            // Moved in from somewhere this scan did not cover
+            if (scanDirs.front().empty() || entries.empty())
+                continue;
+            if (recordedByID.empty())
+            {
+                for (const auto& [key, entry] : entries)
+                    recordedByID.emplace(entry.id, key);
+            }
+            if (auto it = recordedByID.find(change.id); it != recordedByID.end())
+            {
+                const bool IN_SCAN = std::any_of(scanDirs.begin(), scanDirs.end(), [&it](const std::string& dir) { return isUnder(it->second, dir); });
+                if (IN_SCAN)
+                {
+                    LOG_WARN("{0} shares its asset ID with {1}", change.path.filename(), it->second);
+                    continue;
+                }
+                change.kind = Change::Kind::Moved;
+                change.oldPath = root / std::filesystem::path{ it->second };
+                erased.emplace_back(it->second);
+            }
+        }
+
+        for (const auto& [id, recorded] : missing)
+            changes.emplace_back(Change{ Change::Kind::Removed, id, root / std::filesystem::path{ recorded.first }, {}, recorded.second });
+
+#if not OO_END_PRODUCT
+        // Remove orphaned meta files
+        for (const auto& [key, writeTime] : metaTimes)
+        {
+            if (seen.contains(key))
+                continue;
+            const std::filesystem::path FP = root / std::filesystem::path{ key };
+            std::error_code ec;
+            if (std::filesystem::exists(FP, ec))
+                continue;
+            std::filesystem::path fpMeta = FP;
+            fpMeta += Asset::EXT_META;
+            std::filesystem::remove(fpMeta, ec);
+            LOG_WARN("Removed orphaned meta file {0}", fpMeta.filename());
+        }
+
+        // Remove cooked models whose source is gone
+        for (const auto& key : cookedKeys)
+        {
+            if (seen.contains(key))
+                continue;
+            const std::filesystem::path FP = root / std::filesystem::path{ key };
+            std::error_code ec;
+            if (std::filesystem::exists(FP, ec))
+                continue;
+            std::filesystem::path fpCooked = FP;
+            fpCooked += Asset::EXT_COOKED;
+            std::filesystem::remove(fpCooked, ec);
+            LOG_WARN("Removed orphaned cooked file {0}", fpCooked.filename());
+        }
+#endif
+
+        if (!updated.empty() || !erased.empty())
+        {
+            std::unique_lock lock{ mutex };
+            for (const auto& key : erased)
+                entries.erase(key);
+            for (auto& [key, entry] : updated)
+                entries.insert_or_assign(std::move(key), entry);
+        }
+
+        TRACY_PROFILE_SCOPE_END();
+        return changes;
+    }
+
+    std::optional<AssetID> AssetIndex::Find(const std::filesystem::path& fp) const
+    {
+        const auto KEY = toKey(fp);
+        if (!KEY)
+            return std::nullopt;
+
+        std::shared_lock lock{ mutex };
+        const auto IT = entries.find(*KEY);
+        if (IT == entries.end())
+            return std::nullopt;
+        return IT->second.id;
+    }
+
+    std::optional<std::string> AssetIndex::toKey(const std::filesystem::path& fp) const
+    {
+        const std::filesystem::path FP = fp.is_absolute() ? fp : root / fp;
+        if (auto key = relativeKey(FP, root))
+            return key;
+        return relativeKey(FP, rootGiven);
+    }
+}
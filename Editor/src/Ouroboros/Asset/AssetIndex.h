@@ -0,0 +1,166 @@
+/************************************************************************************//*!
+\file           AssetIndex.h
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Contains the declaration for the AssetIndex class, a persisted record of
+                every file under the asset root and the asset ID its meta file holds.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "Asset.h"
+
+/****************************************************************************************
+*
+* Asset Index
+*
+* 1) Every file and directory under the root is recorded by its path relative to the
+*    root, with its write time, size, the write time of its meta file and its asset ID.
+* 2) A scan walks the tree once, comparing what it finds against the record. Only
+*    entries whose times or sizes differ have their meta file opened.
+* 3) A scan returns what changed, so callers apply deltas instead of rebuilding.
+*
+****************************************************************************************/
+
+namespace oo
+{
+    class AssetIndex
+    {
+    public:
+        /* --------------------------------------------------------------------------- */
+        /* Type Definitions                                                            */
+        /* --------------------------------------------------------------------------- */
+
+        struct Entry
+        {
+            std::int64_t writeTime = 0;
+            std::uint64_t size = 0;
+            std::int64_t metaWriteTime = 0;
+            AssetID id = Asset::ID_NULL;
+            bool isDirectory = false;
+        };
+
+        struct Change
+        {
+            enum class Kind : std::uint8_t
+            {
+                Added,
+                Modified,
+                Moved,
+                Removed,
+            };
+
+            Kind kind;
+            AssetID id;
+            std::filesystem::path path;     // absolute, under the canonical root
+            std::filesystem::path oldPath;  // only set for moves
+            bool isDirectory = false;
+        };
+
+        using ChangeList = std::vector<Change>;
+
+        /* --------------------------------------------------------------------------- */
+        /* Constants                                                                   */
+        /* --------------------------------------------------------------------------- */
+
+        static constexpr std::uint32_t FILE_MAGIC = 0x4941'4F4F; // "OOAI"
+        static constexpr std::uint32_t FILE_VERSION = 1;
+
+        /* --------------------------------------------------------------------------- */
+        /* Constructors and Destructors                                                */
+        /* --------------------------------------------------------------------------- */
+
+        AssetIndex(const std::filesystem::path& root);
+
+        /* --------------------------------------------------------------------------- */
+        /* Getters                                                                     */
+        /* --------------------------------------------------------------------------- */
+
+        [[nodiscard]] inline const std::filesystem::path& GetRootDirectory() const { return root; };
+
+        /* --------------------------------------------------------------------------- */
+        /* Functions                                                                   */
+        /* --------------------------------------------------------------------------- */
+
+        /// <summary>
+        /// Replaces the record with the one saved in a file.
+        /// A missing, outdated or corrupt file leaves the record empty.
+        /// </summary>
+        /// <param name="fp">The index file.</param>
+        /// <returns>Whether the file was loaded.</returns>
+        bool Load(const std::filesystem::path& fp);
+
+        /// <summary>
+        /// Saves the record to a file.
+        /// </summary>
+        /// <param name="fp">The index file.</param>
+        /// <returns>Whether the file was written.</returns>
+        bool Save(const std::filesystem::path& fp) const;
+
+        /// <summary>
+        /// Walks the given directories and brings the record up to date with them.
+        /// Only one thread may scan at a time, Find may be called alongside.
+        /// </summary>
+        /// <param name="dirs">The directories relative to the root, each scanned recursively. Empty scans the whole root.</param>
+        /// <param name="trustRecord">Whether unchanged files can skip reading their meta file.</param>
+        /// <returns>What changed since the last scan.</returns>
+        ChangeList Scan(const std::vector<std::filesystem::path>& dirs = {}, bool trustRecord = true);
+
+        /// <summary>
+        /// Retrieves the asset ID recorded for a file.
+        /// </summary>
+        /// <param name="fp">The file path, relative to the root or absolute under it.</param>
+        /// <returns>The asset ID, if the file is recorded.</returns>
+        std::optional<AssetID> Find(const std::filesystem::path& fp) const;
+
+        /// <summary>
+        /// Calls a function with the absolute path and entry of everything recorded.
+        /// </summary>
+        /// <param name="fn">The function.</param>
+        template<typename Func>
+        void ForEach(Func&& fn) const
+        {
+            std::shared_lock lock{ mutex };
+            for (const auto& [relative, entry] : entries)
+                fn(root / std::filesystem::path{ relative }, entry);
+        }
+
+    private:
+        /* --------------------------------------------------------------------------- */
+        /* Members                                                                     */
+        /* --------------------------------------------------------------------------- */
+
+        std::filesystem::path root;     // canonical
+        std::filesystem::path rootGiven;
+        // keyed by generic relative path, sorted so everything under a directory is one range
+        std::map<std::string, Entry> entries;
+        mutable std::shared_mutex mutex;
+
+        /* --------------------------------------------------------------------------- */
+        /* Functions                                                                   */
+        /* --------------------------------------------------------------------------- */
+
+        /// <summary>
+        /// Converts a path to the key it is recorded under.
+        /// </summary>
+        /// <param name="fp">The file path, relative to the root or absolute under it.</param>
+        /// <returns>The key, if the path is under the root.</returns>
+        std::optional<std::string> toKey(const std::filesystem::path& fp) const;
+    };
+}
@@ -0,0 +1,345 @@
+/************************************************************************************//*!
+\file           AssetLoader.cpp
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Contains the definition for the AssetLoader class.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+
+#include "pch.h"
+
+#include "AssetLoader.h"
+
+#include "Ouroboros/TracyProfiling/OO_TracyProfiler.h"
+
+namespace oo
+{
+    AssetLoader::AssetLoader(UploadCallback requestUpload)
+        : requestUpload{ std::move(requestUpload) }
+    {
+        for (size_t i = 0; i < READ_THREADS; ++i)
+            readThreads.emplace_back(&AssetLoader::runReads, this);
+    }
+
+    AssetLoader::~AssetLoader()
+    {
+        {
+            std::scoped_lock lock{ mutex };
+            stopRequested = true;
+        }
+        readCondition.notify_all();
+        for (auto& thread : readThreads)
+            thread.join();
+
+        // Decodes already running still touch this loader
+        worker_pool::wait(decodeTasks);
+
+        // Whatever never reached the main thread counts as done, so nothing waits on it forever
+        for (auto& [id, job] : jobs)
+            for (auto& request : job->requests)
+                ++request->loadedCount;
+    }
+
+    AssetLoader::ProgressPtr AssetLoader::Load(const std::vector<AssetInfoPtr>& assets, int priority)
+    {
+        auto progress = std::make_shared<Progress>();
+        progress->totalCount = assets.size();
+        {
+            std::vector<JobPtr> added;
+            std::scoped_lock lock{ mutex };
+            for (const auto& info : assets)
+            {
+                if (!info || info->isDataLoaded || stopRequested)
+                {
+                    ++progress->loadedCount;
+                    continue;
+                }
+
+                // Already on its way, this request waits on it as well
+                if (auto it = jobs.find(info->id); it != jobs.end())
+                {
+                    it->second->requests.emplace_back(progress);
+                    continue;
+                }
+
+                auto job = std::make_shared<Job>();
+                job->info = info;
+                job->path = info->contentPath;
+                job->type = info->GetType();
+                job->steps = AssetInfo::GetLoadSteps(job->type);
+                job->level = getLevel(job->type);
+                job->priority = priority;
+                job->order = nextOrder++;
+                job->requests.emplace_back(progress);
+                jobs.emplace(info->id, job);
+
+                ++unfinished[job->level];
+                added.emplace_back(std::move(job));
+            }
+
+            // Only once the whole batch is counted, so a dependent listed before what it depends on still waits
+            for (auto& job : added)
+            {
+                if (isReleased(job->level))
+                    start(job);
+                else
+                    held[job->level].emplace_back(job);
+            }
+        }
+        submitDecodes();
+        return progress;
+    }
+
+    void AssetLoader::Upload(std::chrono::microseconds budget)
+    {
+        TRACY_PROFILE_SCOPE_NC(asset_loader_upload, tracy::Color::Aquamarine1);
+
+        const auto START = std::chrono::steady_clock::now();
+        bool more = false;
+        while (true)
+        {
+            JobPtr job;
+            {
+                std::scoped_lock lock{ mutex };
+                if (uploadQueue.empty())
+                {
+                    uploadRequested = false;
+                    break;
+                }
+                job = uploadQueue.top();
+                uploadQueue.pop();
+            }
+
+            // Completed even if cancelled by now, decoded data is only freed by unloading it
+            job->info->CompleteLoad(job->type, job->steps, std::move(job->complete));
+            finish(job);
+
+            if (std::chrono::steady_clock::now() - START >= budget)
+            {
+                std::scoped_lock lock{ mutex };
+                more = !uploadQueue.empty();
+                uploadRequested = more;
+                break;
+            }
+        }
+
+        // Picked up next frame
+        if (more)
+            requestUpload();
+
+        TRACY_PROFILE_SCOPE_END();
+    }
+
+    void AssetLoader::runReads()
+    {
+        while (true)
+        {
+            ReadTask task;
+            {
+                std::unique_lock lock{ mutex };
+                readCondition.wait(lock, [this]() { return stopRequested || !readQueue.empty(); });
+                if (stopRequested)
+                    return;
+                task = readQueue.top();
+                readQueue.pop();
+            }
+            task.work();
+        }
+    }
+
+    void AssetLoader::pushRead(int priority, std::function<void()> work)
+    {
+        {
+            std::scoped_lock lock{ mutex };
+            readQueue.push(ReadTask{ priority, nextOrder++, std::move(work) });
+        }
+        readCondition.notify_one();
+    }
+
+    void AssetLoader::start(const JobPtr& job)
+    {
+        if (!job->steps.readsContent)
+        {
+            queueDecode(job);
+            return;
+        }
+
+        readQueue.push(ReadTask{ job->priority, job->order, [this, job]()
+        {
+            bool cancelled = false;
+            {
+                std::scoped_lock lock{ mutex };
+                cancelled = isCancelled(*job);
+            }
+            if (cancelled)
+            {
+                finish(job);
+                return;
+            }
+
+            TRACY_PROFILE_SCOPE_NC(asset_loader_read, tracy::Color::Orange);
+            job->content = AssetInfo::ReadContent(job->path);
+            TRACY_PROFILE_SCOPE_END();
+
+            {
+                std::scoped_lock lock{ mutex };
+                queueDecode(job);
+            }
+            submitDecodes();
+        } });
+        readCondition.notify_one();
+    }
+
+    void AssetLoader::queueDecode(const JobPtr& job)
+    {
+        if (job->steps.exclusive)
+            exclusiveQueue.push(job);
+        else
+            decodeQueue.push(job);
+    }
+
+    void AssetLoader::submitDecodes()
+    {
+        // A decode run inline by the pool lands back here, the outer loop picks up what it queued
+        thread_local bool submitting = false;
+        if (submitting)
+            return;
+        submitting = true;
+
+        // Leave the rest of the pool to frame work
+        const size_t DECODE_LIMIT = std::max<size_t>(1, worker_pool::thread_count() / 2);
+        while (true)
+        {
+            JobPtr job;
+            bool exclusive = false;
+            {
+                std::scoped_lock lock{ mutex };
+                if (stopRequested)
+                    break;
+                if (!exclusiveRunning && !exclusiveQueue.empty())
+                {
+                    job = exclusiveQueue.top();
+                    exclusiveQueue.pop();
+                    exclusiveRunning = true;
+                    exclusive = true;
+                }
+                else if (decodeRunning < DECODE_LIMIT && !decodeQueue.empty())
+                {
+                    job = decodeQueue.top();
+                    decodeQueue.pop();
+                    ++decodeRunning;
+                }
+                else
+                {
+                    break;
+                }
+            }
+            worker_pool::submit(decodeTasks, [this, job, exclusive]() { decode(job, exclusive); });
+        }
+
+        submitting = false;
+    }
+
+    void AssetLoader::decode(const JobPtr& job, bool exclusive)
+    {
+        TRACY_PROFILE_SCOPE_NC(asset_loader_decode, tracy::Color::Orange);
+
+        bool cancelled = false;
+        {
+            std::scoped_lock lock{ mutex };
+            cancelled = isCancelled(*job);
+        }
+        if (!cancelled)
+        {
+            try
+            {
+                job->complete = job->steps.decode(job->path, std::move(job->content));
+            }
+            catch (const std::exception& e)
+            {
+                LOG_ERROR("Failed to load {0}: {1}", job->path.string(), e.what());
+                cancelled = true;
+            }
+        }
+        job->content = {};
+
+        bool notify = false;
+        {
+            std::scoped_lock lock{ mutex };
+            if (exclusive)
+                exclusiveRunning = false;
+            else
+                --decodeRunning;
+            if (!cancelled)
+            {
+                uploadQueue.push(job);
+                notify = !uploadRequested;
+                uploadRequested = true;
+            }
+        }
+
+        if (cancelled)
+            finish(job);
+        else if (notify)
+            requestUpload();
+        submitDecodes();
+
+        TRACY_PROFILE_SCOPE_END();
+    }
+
+    void AssetLoader::finish(const JobPtr& job)
+    {
+        {
+            std::scoped_lock lock{ mutex };
+            if (auto it = jobs.find(job->info->id); it != jobs.end() && it->second == job)
+                jobs.erase(it);
+            --unfinished[job->level];
+            for (auto& request : job->requests)
+                ++request->loadedCount;
+
+            for (size_t level = 1; level < LEVEL_COUNT; ++level)
+            {
+                if (held[level].empty() || !isReleased(level))
+                    continue;
+                for (auto& heldJob : held[level])
+                    start(heldJob);
+                held[level].clear();
+            }
+        }
+        submitDecodes();
+    }
+
+    bool AssetLoader::isReleased(size_t level) const
+    {
+        for (size_t i = 0; i < level; ++i)
+        {
+            if (unfinished[i] > 0)
+                return false;
+        }
+        return true;
+    }
+
+    bool AssetLoader::isCancelled(const Job& job)
+    {
+        return std::all_of(job.requests.begin(), job.requests.end(), [](const ProgressPtr& request) { return request->cancelled.load(); });
+    }
+
+    size_t AssetLoader::getLevel(AssetInfo::Type type)
+    {
+        switch (type)
+        {
+            case AssetInfo::Type::Animation:
+                return 1;
+            case AssetInfo::Type::AnimationTree:
+                return 2;
+            default:
+                return 0;
+        }
+    }
+}
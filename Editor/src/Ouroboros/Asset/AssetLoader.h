@@ -0,0 +1,274 @@
+/************************************************************************************//*!
+\file           AssetLoader.h
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Contains the declaration for the AssetLoader class, which loads batches of
+                assets through bounded file reading, decoding and upload stages.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Asset.h"
+#include "Ouroboros/Core/WorkerPool.h"
+
+/****************************************************************************************
+*
+* Asset Loading Pipeline
+*
+* 1) Read: a few loader threads read file contents, so slow disks never stall the pool.
+* 2) Decode: decoding runs on the worker pool, with only some of its threads at a time
+*    so frame work keeps the rest. Types whose loaders cannot run alongside each other
+*    go through one at a time instead.
+* 3) Upload: decoded data is handed to the main thread, which completes loads within a
+*    time budget each frame.
+*
+* Higher priority requests move through every stage first. Types that others depend on
+* (models before animations before animation trees) finish before their dependents start.
+*
+****************************************************************************************/
+
+namespace oo
+{
+    class AssetLoader
+    {
+    public:
+        /* --------------------------------------------------------------------------- */
+        /* Type Definitions                                                            */
+        /* --------------------------------------------------------------------------- */
+
+        using AssetInfoPtr = std::shared_ptr<AssetInfo>;
+        using UploadCallback = std::function<void()>;
+
+        struct Progress
+        {
+            Progress() : loadedCount{ 0 }, totalCount{ 0 }, cancelled{ false } {}
+            std::atomic<size_t> loadedCount;
+            std::atomic<size_t> totalCount;
+            std::atomic<bool> cancelled;
+            double percent() const { return totalCount != 0 ? (static_cast<double>(loadedCount) * 100 / totalCount) : 100; }
+            bool done() const { return loadedCount >= totalCount; }
+            // Assets not yet loaded are skipped and counted as done, unless another request still wants them
+            void cancel() { cancelled = true; }
+        };
+
+        using ProgressPtr = std::shared_ptr<Progress>;
+
+        /* --------------------------------------------------------------------------- */
+        /* Constants                                                                   */
+        /* --------------------------------------------------------------------------- */
+
+        static constexpr int PRIORITY_LOW = -1;
+        static constexpr int PRIORITY_NORMAL = 0;
+        static constexpr int PRIORITY_HIGH = 1;
+        static constexpr size_t READ_THREADS = 2;
+        static constexpr std::chrono::microseconds UPLOAD_BUDGET = std::chrono::milliseconds(4);
+
+        /* --------------------------------------------------------------------------- */
+        /* Constructors and Destructors                                                */
+        /* --------------------------------------------------------------------------- */
+
+        /// <summary>
+        /// Starts the loader threads.
+        /// </summary>
+        /// <param name="requestUpload">Called from any thread when Upload should be called on the main thread.</param>
+        AssetLoader(UploadCallback requestUpload);
+        AssetLoader(const AssetLoader&) = delete;
+        AssetLoader& operator=(const AssetLoader&) = delete;
+        ~AssetLoader();
+
+        /* --------------------------------------------------------------------------- */
+        /* Functions                                                                   */
+        /* --------------------------------------------------------------------------- */
+
+        /// <summary>
+        /// Queues assets to be loaded. Assets already loaded or null count as done.
+        /// </summary>
+        /// <param name="assets">The assets.</param>
+        /// <param name="priority">The priority of the request.</param>
+        /// <returns>The progress of the request.</returns>
+        ProgressPtr Load(const std::vector<AssetInfoPtr>& assets, int priority = PRIORITY_NORMAL);
+
+        /// <summary>
+        /// Completes decoded loads on the calling thread, which must be the main thread.
+        /// </summary>
+        /// <param name="budget">How long to keep completing loads for. At least one is always completed.</param>
+        void Upload(std::chrono::microseconds budget = UPLOAD_BUDGET);
+
+        /// <summary>
+        /// Runs a blocking function on the loader threads, alongside file reads.
+        /// </summary>
+        /// <param name="fn">The function.</param>
+        /// <param name="priority">The priority of the function.</param>
+        /// <returns>The future result of the function.</returns>
+        template<typename Func>
+        auto RunAsync(Func&& fn, int priority = PRIORITY_NORMAL) -> std::future<std::invoke_result_t<Func>>
+        {
+            using Result = std::invoke_result_t<Func>;
+            auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Func>(fn));
+            auto future = task->get_future();
+            pushRead(priority, [task]() { (*task)(); });
+            return future;
+        }
+
+    private:
+        /* --------------------------------------------------------------------------- */
+        /* Type Definitions                                                            */
+        /* --------------------------------------------------------------------------- */
+
+        struct Job
+        {
+            AssetInfoPtr info;
+            std::filesystem::path path;
+            AssetInfo::Type type;
+            AssetInfo::LoadSteps steps;
+            size_t level = 0;
+            int priority = PRIORITY_NORMAL;
+            uint64_t order = 0;
+            std::vector<ProgressPtr> requests;
+            std::vector<uint8_t> content;
+            AssetInfo::Callback complete;
+        };
+
+        using JobPtr = std::shared_ptr<Job>;
+
+        struct ReadTask
+        {
+            int priority;
+            uint64_t order;
+            std::function<void()> work;
+        };
+
+        struct ByPriority
+        {
+            bool operator()(const JobPtr& a, const JobPtr& b) const
+            {
+                return a->priority != b->priority ? a->priority < b->priority : a->order > b->order;
+            }
+            bool operator()(const ReadTask& a, const ReadTask& b) const
+            {
+                return a.priority != b.priority ? a.priority < b.priority : a.order > b.order;
+            }
+        };
+
+        template<typename T>
+        using PriorityQueue = std::priority_queue<T, std::vector<T>, ByPriority>;
+
+        /* --------------------------------------------------------------------------- */
+        /* Constants                                                                   */
+        /* --------------------------------------------------------------------------- */
+
+        static constexpr size_t LEVEL_COUNT = 3;
+
+        /* --------------------------------------------------------------------------- */
+        /* Members                                                                     */
+        /* --------------------------------------------------------------------------- */
+
+        UploadCallback requestUpload;
+        std::vector<std::thread> readThreads;
+        worker_pool::task_group decodeTasks;
+
+        std::mutex mutex;
+        std::condition_variable readCondition;
+        bool stopRequested = false;
+        uint64_t nextOrder = 0;
+        std::unordered_map<AssetID, JobPtr> jobs;
+        std::array<size_t, LEVEL_COUNT> unfinished{};
+        std::array<std::vector<JobPtr>, LEVEL_COUNT> held;
+        PriorityQueue<ReadTask> readQueue;
+        PriorityQueue<JobPtr> decodeQueue;
+        PriorityQueue<JobPtr> exclusiveQueue;
+        PriorityQueue<JobPtr> uploadQueue;
+        size_t decodeRunning = 0;
+        bool exclusiveRunning = false;
+        bool uploadRequested = false;
+
+        /* --------------------------------------------------------------------------- */
+        /* Functions                                                                   */
+        /* --------------------------------------------------------------------------- */
+
+        /// <summary>
+        /// Pops and runs read queue tasks until stopped.
+        /// </summary>
+        void runReads();
+
+        /// <summary>
+        /// Queues a task for the loader threads.
+        /// </summary>
+        /// <param name="priority">The priority of the task.</param>
+        /// <param name="work">The task.</param>
+        void pushRead(int priority, std::function<void()> work);
+
+        /// <summary>
+        /// Sends a job to its first stage. The mutex must be held.
+        /// </summary>
+        /// <param name="job">The job.</param>
+        void start(const JobPtr& job);
+
+        /// <summary>
+        /// Queues a job for decoding. The mutex must be held.
+        /// </summary>
+        /// <param name="job">The job.</param>
+        void queueDecode(const JobPtr& job);
+
+        /// <summary>
+        /// Submits queued decodes to the worker pool while under their limits.
+        /// The mutex must not be held.
+        /// </summary>
+        void submitDecodes();
+
+        /// <summary>
+        /// Decodes a job, then queues it for upload.
+        /// </summary>
+        /// <param name="job">The job.</param>
+        /// <param name="exclusive">Whether the job went through one at a time.</param>
+        void decode(const JobPtr& job, bool exclusive);
+
+        /// <summary>
+        /// Counts a job as done for every request waiting on it, then starts the jobs it held back.
+        /// The mutex must not be held.
+        /// </summary>
+        /// <param name="job">The job.</param>
+        void finish(const JobPtr& job);
+
+        /// <summary>
+        /// Checks whether every level a level depends on has finished. The mutex must be held.
+        /// </summary>
+        /// <param name="level">The dependency level.</param>
+        /// <returns>Whether jobs of the level can start.</returns>
+        bool isReleased(size_t level) const;
+
+        /// <summary>
+        /// Checks whether every request waiting on a job was cancelled. The mutex must be held.
+        /// </summary>
+        /// <param name="job">The job.</param>
+        /// <returns>Whether the job can be skipped.</returns>
+        static bool isCancelled(const Job& job);
+
+        /// <summary>
+        /// Retrieves the dependency level of a type, lower levels finish first.
+        /// </summary>
+        /// <param name="type">The type of asset.</param>
+        /// <returns>The level.</returns>
+        static size_t getLevel(AssetInfo::Type type);
+    };
+}
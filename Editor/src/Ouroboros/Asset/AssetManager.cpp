@@ -31,44 +31,9 @@ namespace
         return path.extension().string() == oo::Asset::EXT_META;
     }
 
-    void loadProgress(const oo::AssetManager& am, std::weak_ptr<oo::AssetManager::LoadProgress> lpptr, std::vector<oo::AssetID> ids)
+    bool isCookedPath(const std::filesystem::path& path)
     {
-        std::mutex loadMutex;
-        auto loadAsync = [&am, &loadMutex](const oo::AssetID& id)
-        {
-            std::scoped_lock lock{ loadMutex };
-            oo::Asset asset = am.Get(id);
-            if (!asset.IsDataLoaded())
-                asset.Reload();
-        };
-
-        // Start async functions
-        std::vector<std::future<void>> futures;
-        for (const oo::AssetID& id : ids)
-        {
-            futures.emplace_back(std::async(std::launch::async, loadAsync, id));
-        }
-
-        // Progress loop
-        if (auto sp = lpptr.lock())
-        {
-            sp->totalCount = futures.size();
-            while (sp->loadedCount < sp->totalCount)
-            {
-                std::this_thread::sleep_for(oo::AssetManager::LOAD_INTERVAL);
-
-                // Count all ready futures
-                int count = 0;
-                for (const auto& future : futures)
-                {
-                    if (future.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
-                    {
-                        ++count;
-                    }
-                }
-                sp->loadedCount = count;
-            }
-        }
+        return path.extension().string() == oo::Asset::EXT_COOKED;
     }
 }
 namespace oo
@@ -235,14 +200,39 @@ namespace oo
 
     AssetManager::AssetManager(std::filesystem::path root)
         : root{ root }
+        , index{ std::make_shared<AssetIndex>(root) }
     {
         EventManager::Subscribe<AssetManager, FileWatchEvent>(this, &AssetManager::watchFiles);
+        EventManager::Subscribe<AssetManager, AssetUploadEvent>(this, &AssetManager::uploadAssets);
 #if not OO_END_PRODUCT
         EventManager::Subscribe<AssetManager, WindowFocusEvent>(this, &AssetManager::windowFocusHandler);
 #endif
         for (int i = 0; i < static_cast<int>(AssetInfo::Type::_COUNT); ++i)
             store.byType.emplace(static_cast<AssetInfo::Type>(i), AssetInfoMap());
-        GetDirectory(root, true);
+
+        // Bring the saved index up to date, then index everything it holds
+        const auto FP_INDEX = index->GetRootDirectory().parent_path() / INDEX_FILE_NAME;
+        index->Load(FP_INDEX);
+        index->Scan();
+        index->Save(FP_INDEX);
+        index->ForEach([this](const std::filesystem::path& fp, const AssetIndex::Entry& entry)
+        {
+            insertAsset(fp, entry.id);
+        });
+
+        // Changes found from here on are applied at the next queued event dispatch
+        watcher = std::make_unique<AssetWatcher>(*index, [source = std::weak_ptr<AssetIndex>(index)](AssetIndex::ChangeList&& changes)
+        {
+            EventManager::Enqueue(FileWatchEvent{ std::chrono::file_clock::now(),
+                                                  std::make_shared<const AssetIndex::ChangeList>(std::move(changes)),
+                                                  source });
+        });
+
+        // An event queued while events are dispatched is delivered next frame, so uploads spread over frames
+        loader = std::make_unique<AssetLoader>([]()
+        {
+            EventManager::Enqueue(AssetUploadEvent{});
+        });
     }
 
     AssetManager::~AssetManager()
@@ -250,7 +240,14 @@ namespace oo
 #if not OO_END_PRODUCT
         EventManager::Unsubscribe<AssetManager, WindowFocusEvent>(this, &AssetManager::windowFocusHandler);
 #endif
+        EventManager::Unsubscribe<AssetManager, AssetUploadEvent>(this, &AssetManager::uploadAssets);
         EventManager::Unsubscribe<AssetManager, FileWatchEvent>(this, &AssetManager::watchFiles);
+        loader.reset();
+        if (watcher)
+        {
+            watcher.reset();
+            index->Save(index->GetRootDirectory().parent_path() / INDEX_FILE_NAME);
+        }
         store.clear();
     }
 
@@ -264,16 +261,19 @@ namespace oo
 
     std::future<Asset> AssetManager::GetAsync(const AssetID& id) const
     {
-        return std::async(std::launch::async, &AssetManager::Get, this, id);
+        // Only a lookup, not worth a thread
+        std::promise<Asset> promise;
+        promise.set_value(Get(id));
+        return promise.get_future();
     }
 
-    AssetManager::LoadProgressPtr AssetManager::LoadMultipleAsync(const std::vector<AssetID>& ids)
+    AssetManager::LoadProgressPtr AssetManager::LoadMultipleAsync(const std::vector<AssetID>& ids, int priority)
     {
-        // Create progress tracker
-        LoadProgressPtr lpptr = std::make_shared<LoadProgress>();
-        lpptr->progressThread = std::thread(loadProgress, std::cref(*this), lpptr, ids);
-        lpptr->progressThread.detach();
-        return lpptr;
+        std::vector<AssetInfoPtr> infos;
+        infos.reserve(ids.size());
+        for (const AssetID& id : ids)
+            infos.emplace_back(store.contains(id) ? store.at(id) : nullptr);
+        return loader->Load(infos, priority);
     }
 
     std::vector<Asset> AssetManager::GetAssetsByType(AssetInfo::Type type) const
@@ -306,7 +306,7 @@ namespace oo
 
     std::future<Asset> AssetManager::GetOrLoadPathAsync(const std::filesystem::path& fp)
     {
-        return std::async(std::launch::async, &AssetManager::GetOrLoadPath, this, fp);
+        return loader->RunAsync([this, fp]() { return GetOrLoadPath(fp); });
     }
 
 #define DIR_ITER(_CALLBACK)                                                                         \
@@ -321,7 +321,7 @@ else for (auto& file : std::filesystem::directory_iterator(PATH)) { _CALLBACK; }
             return {};
 
         std::vector<std::filesystem::path> files;
-        DIR_ITER({ if (isMetaPath(file.path())) continue; files.emplace_back(file); });
+        DIR_ITER({ if (isMetaPath(file.path()) || isCookedPath(file.path())) continue; files.emplace_back(file); });
         std::vector<Asset> v;
         std::transform(files.begin(), files.end(), std::back_inserter(v), [this](const auto& file) { return getAsset(file); });
         return v;
@@ -329,7 +329,7 @@ else for (auto& file : std::filesystem::directory_iterator(PATH)) { _CALLBACK; }
 
     std::future<std::vector<Asset>> AssetManager::GetDirectoryAsync(const std::filesystem::path& path, bool recursive)
     {
-        return std::async(std::launch::async, &AssetManager::GetDirectory, this, path, recursive);
+        return loader->RunAsync([this, path, recursive]() { return GetDirectory(path, recursive); });
     }
 
     std::vector<Asset> AssetManager::GetOrLoadDirectory(const std::filesystem::path& path, bool recursive)
@@ -340,7 +340,7 @@ else for (auto& file : std::filesystem::directory_iterator(PATH)) { _CALLBACK; }
             return {};
 
         std::vector<std::filesystem::path> files;
-        DIR_ITER({ if (isMetaPath(file.path())) continue; files.emplace_back(file); });
+        DIR_ITER({ if (isMetaPath(file.path()) || isCookedPath(file.path())) continue; files.emplace_back(file); });
         std::vector<Asset> v;
         std::transform(files.begin(), files.end(), std::back_inserter(v), [this](const auto& file) { return getLoadedAsset(file); });
         return v;
@@ -348,7 +348,7 @@ else for (auto& file : std::filesystem::directory_iterator(PATH)) { _CALLBACK; }
 
     std::future<std::vector<Asset>> AssetManager::GetOrLoadDirectoryAsync(const std::filesystem::path& path, bool recursive)
     {
-        return std::async(std::launch::async, &AssetManager::GetOrLoadDirectory, this, path, recursive);
+        return loader->RunAsync([this, path, recursive]() { return GetOrLoadDirectory(path, recursive); });
     }
 
 #undef DIR_ITER
@@ -371,7 +371,7 @@ else for (auto& file : std::filesystem::directory_iterator(PATH)) { _CALLBACK; }
 
     std::future<std::vector<Asset>> AssetManager::GetOrLoadNameAsync(const std::filesystem::path& fn, bool caseSensitive)
     {
-        return std::async(std::launch::async, &AssetManager::GetOrLoadDirectory, this, fn, caseSensitive);
+        return loader->RunAsync([this, fn, caseSensitive]() { return GetOrLoadName(fn, caseSensitive); });
     }
 
     void AssetManager::UnloadAll()
@@ -382,14 +382,12 @@ else for (auto& file : std::filesystem::directory_iterator(PATH)) { _CALLBACK; }
 
     void AssetManager::Scan()
     {
-        FileWatchEvent fwe{ lastReloadTime };
-        EventManager::Broadcast<FileWatchEvent>(&fwe);
+        watcher->RequestScan();
     }
 
     void AssetManager::ForceScan()
     {
-        FileWatchEvent fwe{ std::chrono::file_clock::time_point() };
-        EventManager::Broadcast<FileWatchEvent>(&fwe);
+        watcher->RequestFullScan();
     }
 
     void AssetManager::windowFocusHandler(WindowFocusEvent*)
@@ -397,172 +395,55 @@ else for (auto& file : std::filesystem::directory_iterator(PATH)) { _CALLBACK; }
         Scan();
     }
 
-    void AssetManager::watchFiles(FileWatchEvent* ev)
+    void AssetManager::uploadAssets(AssetUploadEvent*)
     {
-        TRACY_PROFILE_SCOPE_NC(ASSET_MANAGER_WATCH_FILES, tracy::Color::Aquamarine1);
-
-        std::chrono::file_clock::time_point tLast = ev->time;
-        if (std::filesystem::exists(root))
-        {
-#if not OO_END_PRODUCT
-            iterateDirectoryOrphans(root, tLast);
-#endif
-            iterateDirectoryAdditions(root, tLast);
-            iterateDirectoryOmissions(root, tLast);
-        }
-        lastReloadTime = std::chrono::file_clock::now();
-
-        TRACY_PROFILE_SCOPE_END();
+        loader->Upload();
     }
 
-    void AssetManager::iterateDirectoryOrphans(const std::filesystem::path& dir,
-                                               const std::chrono::file_clock::time_point& tLast,
-                                               const std::chrono::file_clock::time_point& t)
+    void AssetManager::watchFiles(FileWatchEvent* ev)
     {
-        const std::filesystem::path DIR = std::filesystem::canonical(dir);
-        std::list<std::filesystem::path> toRemove;
-
-        // Iterate directory contents
-        for (auto& fp : std::filesystem::directory_iterator(DIR))
-        {
-            const std::filesystem::path FP = std::filesystem::canonical(fp.path());
-
-            // Recurse
-            if (std::filesystem::is_directory(FP))
-                iterateDirectoryOrphans(FP, tLast, t);
-
-            // Check if meta file
-            if (!isMetaPath(FP))
-                continue;
-
-            // Convert to asset path
-            std::filesystem::path fpContent = FP;
-            fpContent.replace_extension();
-
-            // Check if item exists
-            if (std::filesystem::exists(fpContent))
-                continue;
-
-            toRemove.emplace_back(FP);
-        }
-
-        // Remove orphans
-        for (const auto& fp : toRemove)
-        {
-            std::filesystem::remove(fp);
-            LOG_WARN("Removed orphaned meta file {0}", fp.filename());
-        }
-    }
+        if (!ev->changes || ev->source.lock() != index)
+            return;
 
-    void AssetManager::iterateDirectoryAdditions(const std::filesystem::path& dir,
-                                                 const std::chrono::file_clock::time_point& tLast,
-                                                 const std::chrono::file_clock::time_point& t)
-    {
-        const std::filesystem::path DIR = std::filesystem::canonical(dir);
-        const auto DIR_WRITE_TIME = std::filesystem::last_write_time(DIR);
+        TRACY_PROFILE_SCOPE_NC(ASSET_MANAGER_WATCH_FILES, tracy::Color::Aquamarine1);
 
-        // Iterate directory contents
-        for (auto& fp : std::filesystem::directory_iterator(DIR))
+        for (const auto& change : *ev->changes)
         {
-            const std::filesystem::path FP = std::filesystem::canonical(fp.path());
-
-            // Recurse
-            if (std::filesystem::is_directory(FP))
-                iterateDirectoryAdditions(FP, tLast, t);
-
-            // Check if directory was updated recently
-            if (tLast < DIR_WRITE_TIME && DIR_WRITE_TIME <= t)
+            switch (change.kind)
             {
-                // Check if not meta file
-                if (isMetaPath(FP))
-                    continue;
-
-                // Ensure meta file exists
-                auto fpMeta = FP;
-                fpMeta += Asset::EXT_META;
-                AssetMetaContent meta = ensureMeta(fpMeta);
-
-                // Check if file
-                if (!std::filesystem::is_regular_file(FP))
-                    continue;
-
-                // Read meta contents
-                const auto WRITE_TIME = std::filesystem::last_write_time(fp.path());
-                if (!store.contains(meta.id))
-                {
-                    // Created
-                    getAsset(FP);
-                }
-                else if (store.at(meta.id)->contentPath != FP)
+                case AssetIndex::Change::Kind::Added:
+                case AssetIndex::Change::Kind::Moved:
                 {
-                    // Moved
-                    const auto FP_OLD = store.at(meta.id)->contentPath;
-                    store.tree.erase(FP_OLD);
-                    store.at(meta.id)->contentPath = FP;
-                    store.at(meta.id)->metaPath = fpMeta;
-                    if (store.at(meta.id)->isDataLoaded)
-                        store.at(meta.id)->Reload();
-                    store.tree.insert(FP);
-                    //LOG_INFO("Move {0}", FP.filename());
+                    if (!store.contains(change.id))
+                        insertAsset(change.path, change.id);
+                    else if (store.at(change.id)->contentPath != change.path)
+                        moveAsset(change.id, change.path);
+                    break;
                 }
-                else if (tLast < WRITE_TIME && WRITE_TIME <= t)
-                {
-                    // Modified
-                    store.at(meta.id)->contentPath = FP;
-                    store.at(meta.id)->metaPath = fpMeta;
-                    store.at(meta.id)->timeLoaded = t;
-                    if (store.at(meta.id)->isDataLoaded)
-                        store.at(meta.id)->Reload();
-                    //LOG_INFO("Modified asset {0}", FP.filename());
-                }
-            }
-        }
-    }
-
-    void AssetManager::iterateDirectoryOmissions(const std::filesystem::path& dir,
-                                                 const std::chrono::file_clock::time_point& tLast,
-                                                 const std::chrono::file_clock::time_point& t)
-    {
-        const std::filesystem::path DIR = std::filesystem::canonical(dir);
-
-        // Iterate directory contents
-        for (auto& fp : std::filesystem::directory_iterator(DIR))
-        {
-            const std::filesystem::path FP = std::filesystem::canonical(fp.path());
-
-            // Recurse
-            if (std::filesystem::is_directory(FP))
-                iterateDirectoryOmissions(FP, tLast, t);
-
-            // Check if directory was updated recently
-            const auto DIR_WRITE_TIME = std::filesystem::last_write_time(DIR);
-            if (tLast < DIR_WRITE_TIME && DIR_WRITE_TIME <= t)
-            {
-                // Get tree node
-                std::vector<AssetID> toRemove;
-                auto node = store.at(DIR);
-                if (node)
+                case AssetIndex::Change::Kind::Modified:
                 {
-                    // Iterate tree node children
-                    for (const auto& asset : node->children)
+                    if (!store.contains(change.id))
                     {
-                        const std::filesystem::path ASS_FP = DIR / asset.second->name; // haha ass
-
-                        // Check if file in tree no longer exists
-                        if (std::filesystem::exists(ASS_FP))
-                            continue;
-
-                        // Remove
-                        toRemove.emplace_back(asset.second->id);
-                        //LOG_INFO("Un-indexed asset {0}", ASS_FP.filename());
+                        insertAsset(change.path, change.id);
+                        break;
                     }
+                    auto& info = store.at(change.id);
+                    info->timeLoaded = ev->time;
+                    if (info->isDataLoaded)
+                        info->Reload();
+                    break;
                 }
-                for (const auto& i : toRemove)
+                case AssetIndex::Change::Kind::Removed:
                 {
-                    store.erase(i);
+                    // The ID may already live elsewhere, if its meta file moved before the scan saw it leave
+                    if (store.contains(change.id) && store.at(change.id)->contentPath == change.path)
+                        store.erase(change.id);
+                    break;
                 }
             }
         }
+
+        TRACY_PROFILE_SCOPE_END();
     }
 
     AssetMetaContent AssetManager::ensureMeta(const std::filesystem::path& fp)
@@ -593,22 +474,43 @@ else for (auto& file : std::filesystem::directory_iterator(PATH)) { _CALLBACK; }
     Asset AssetManager::indexAsset(const std::filesystem::path& fp, AssetID id)
     {
         //LOG_INFO("Indexed asset {0}", fp.filename());
+        return insertAsset(std::filesystem::canonical(fp), id);
+    }
+
+    Asset AssetManager::insertAsset(const std::filesystem::path& fp, AssetID id)
+    {
         std::lock_guard<std::mutex> guard(storeMutex);
 
         auto info = std::make_shared<AssetInfo>();
         info->id = id;
-        info->contentPath = std::filesystem::canonical(fp);
-        info->metaPath = std::filesystem::canonical(fp); info->metaPath += Asset::EXT_META;
+        info->contentPath = fp;
+        info->metaPath = fp; info->metaPath += Asset::EXT_META;
         info->timeLoaded = std::chrono::file_clock::now();
         info->type = info->GetType();
         //LOG_INFO("Indexed asset {0}", fp.filename());
         return Asset(store.emplace(info->id, info));
     }
 
+    void AssetManager::moveAsset(const AssetID& id, const std::filesystem::path& fp)
+    {
+        auto& info = store.at(id);
+        store.tree.erase(info->contentPath);
+        info->contentPath = fp;
+        info->metaPath = fp; info->metaPath += Asset::EXT_META;
+        store.tree.insert(fp)->id = id;
+        if (info->isDataLoaded)
+            info->Reload();
+        //LOG_INFO("Move {0}", fp.filename());
+    }
+
     Asset AssetManager::getAsset(const std::filesystem::path& fp)
     {
         auto [fpContent, fpMeta, fpExt] = getAssetPathParts(fp);
 
+        // Get an indexed asset without touching its meta file
+        if (auto id = index->Find(fpContent); id && store.contains(*id))
+            return Asset(store.at(*id));
+
         // Get or index asset
         AssetMetaContent meta = ensureMeta(fpContent);
         if (store.contains(meta.id))
@@ -24,6 +24,9 @@ Technology is prohibited.
 #include <vector>
 
 #include "Asset.h"
+#include "AssetIndex.h"
+#include "AssetLoader.h"
+#include "AssetWatcher.h"
 
 #include "Ouroboros/Core/Events/ApplicationEvent.h"
 #include "Ouroboros/EventSystem/Event.h"
@@ -37,16 +40,34 @@ Technology is prohibited.
 *   b) Unloaded: asset is indexed by system but data not loaded.
 *   c) Loaded: asset is indexed by system and loaded.
 * 2) Avoid loading all assets on system/project startup. Index all assets only.
+* 3) The index is saved between runs. At startup and afterwards, only files whose write
+*    time or size differ from the saved index have their meta files read.
+* 4) The AssetWatcher rescans off the main thread. What changed arrives on the main
+*    thread as a FileWatchEvent, queued through the EventManager.
+* 5) Batches of assets load through the AssetLoader. Loads it decoded are completed on
+*    the main thread for a few milliseconds each frame, on an AssetUploadEvent.
 *
 ****************************************************************************************/
 
 class FileWatchEvent :public oo::Event
 {
 public:
-    FileWatchEvent(const std::chrono::file_clock::time_point& t) : time{ t } {};
+    using ChangeListPtr = std::shared_ptr<const oo::AssetIndex::ChangeList>;
+
+    FileWatchEvent(const std::chrono::file_clock::time_point& t, ChangeListPtr changes, std::weak_ptr<oo::AssetIndex> source)
+        : time{ t }, changes{ std::move(changes) }, source{ std::move(source) } {};
     ~FileWatchEvent() {};
 
     std::chrono::file_clock::time_point time;
+    ChangeListPtr changes;
+    std::weak_ptr<oo::AssetIndex> source; // the index that changed, so a newer AssetManager ignores stale events
+};
+
+class AssetUploadEvent :public oo::Event
+{
+public:
+    AssetUploadEvent() {};
+    ~AssetUploadEvent() {};
 };
 
 namespace oo
@@ -115,23 +136,14 @@ namespace oo
             AssetInfoFileTree tree;
         };
 
-        struct LoadProgress
-        {
-            LoadProgress() : loadedCount{ 0 }, totalCount{ 0 }{}
-            //~LoadProgress() { progressThread.join(); }
-            std::atomic<size_t> loadedCount;
-            std::atomic<size_t> totalCount;
-            std::thread progressThread;
-            double percent() const { return totalCount != 0 ? (static_cast<double>(loadedCount) * 100 / totalCount) : 100; }
-        };
-
-        using LoadProgressPtr = std::shared_ptr<LoadProgress>;
+        using LoadProgress = AssetLoader::Progress;
+        using LoadProgressPtr = AssetLoader::ProgressPtr;
 
         /* --------------------------------------------------------------------------- */
         /* Constants                                                                   */
         /* --------------------------------------------------------------------------- */
 
-        static constexpr std::chrono::duration LOAD_INTERVAL = std::chrono::seconds(1);
+        static constexpr const char* INDEX_FILE_NAME = "AssetIndex.cache";
 
         /* --------------------------------------------------------------------------- */
         /* Constructors and Destructors                                                */
@@ -187,8 +199,9 @@ namespace oo
         /// Asynchronously loads a vector of assets using its ID.
         /// </summary>
         /// <param name="ids">The vector of IDs of the assets.</param>
-        /// <returns>The pointer to the load progress object.</returns>
-        LoadProgressPtr LoadMultipleAsync(const std::vector<AssetID>& ids);
+        /// <param name="priority">The priority of the load, higher loads first.</param>
+        /// <returns>The pointer to the load progress object, which can also cancel the load.</returns>
+        LoadProgressPtr LoadMultipleAsync(const std::vector<AssetID>& ids, int priority = AssetLoader::PRIORITY_NORMAL);
 
         /// <summary>
         /// Retrieves all assets of a given type.
@@ -266,11 +279,12 @@ namespace oo
 
         /// <summary>
         /// Scans for updated assets.
+        /// The scan runs on the watcher thread, its changes are applied at the next queued event dispatch.
         /// </summary>
         void Scan();
 
         /// <summary>
-        /// Scans all assets.
+        /// Scans all assets, reading every meta file again.
         /// </summary>
         void ForceScan();
 
@@ -281,7 +295,9 @@ namespace oo
 
         std::filesystem::path root;
         AssetStore store;
-        std::chrono::file_clock::time_point lastReloadTime;
+        std::shared_ptr<AssetIndex> index;
+        std::unique_ptr<AssetWatcher> watcher;
+        std::unique_ptr<AssetLoader> loader;
 
         /* --------------------------------------------------------------------------- */
         /* Functions                                                                   */
@@ -294,46 +310,22 @@ namespace oo
         void windowFocusHandler(WindowFocusEvent*);
 
         /// <summary>
-        /// Scans the filesystem for changes in files.
+        /// Applies the changes a scan found to the store.
         /// </summary>
         /// <param name="ev">The file watch event.</param>
         void watchFiles(FileWatchEvent* ev);
 
         /// <summary>
-        /// Iterates through a directory for orphaned meta files in the filesystem.
-        /// </summary>
-        /// <param name="dir">The directory to iterate.</param>
-        /// <param name="lastTime">The last time at which an iteration was performed.</param>
-        /// <param name="iterationTime">The time at which this iteration is performed.</param>
-        void iterateDirectoryOrphans(const std::filesystem::path& dir,
-                                     const std::chrono::file_clock::time_point& lastTime,
-                                     const std::chrono::file_clock::time_point& iterationTime = std::chrono::file_clock::now());
-
-        /// <summary>
-        /// Iterates through a directory for additions and modifications in the filesystem.
+        /// Completes loads the loader has decoded.
         /// </summary>
-        /// <param name="dir">The directory to iterate.</param>
-        /// <param name="lastTime">The last time at which an iteration was performed.</param>
-        /// <param name="iterationTime">The time at which this iteration is performed.</param>
-        void iterateDirectoryAdditions(const std::filesystem::path& dir,
-                                       const std::chrono::file_clock::time_point& lastTime,
-                                       const std::chrono::file_clock::time_point& iterationTime = std::chrono::file_clock::now());
-
-        /// <summary>
-        /// Iterates through a directory for omissions in the filesystem.
-        /// </summary>
-        /// <param name="dir">The directory to iterate.</param>
-        /// <param name="lastTime">The last time at which an iteration was performed.</param>
-        /// <param name="iterationTime">The time at which this iteration is performed.</param>
-        void iterateDirectoryOmissions(const std::filesystem::path& dir,
-                                       const std::chrono::file_clock::time_point& lastTime,
-                                       const std::chrono::file_clock::time_point& iterationTime = std::chrono::file_clock::now());
+        /// <param name="ev">The asset upload event.</param>
+        void uploadAssets(AssetUploadEvent* ev);
 
         /// <summary>
         /// Ensures that a meta file for an asset exists
         /// </summary>
         /// <param name="fp">The file path of the asset.</param>
-        AssetMetaContent ensureMeta(const std::filesystem::path& fp);
+        static AssetMetaContent ensureMeta(const std::filesystem::path& fp);
 
         /// <summary>
         /// Indexes an asset from a given file into the store.
@@ -343,6 +335,21 @@ namespace oo
         /// <returns>The asset.</returns>
         Asset indexAsset(const std::filesystem::path& fp, AssetID id = Asset::GenerateSnowflake());
 
+        /// <summary>
+        /// Indexes an asset from a given canonical file path into the store.
+        /// </summary>
+        /// <param name="fp">The canonical file path.</param>
+        /// <param name="id">The asset ID.</param>
+        /// <returns>The asset.</returns>
+        Asset insertAsset(const std::filesystem::path& fp, AssetID id);
+
+        /// <summary>
+        /// Points an indexed asset at its new file path.
+        /// </summary>
+        /// <param name="id">The asset ID.</param>
+        /// <param name="fp">The new canonical file path.</param>
+        void moveAsset(const AssetID& id, const std::filesystem::path& fp);
+
         /// <summary>
         /// Retrieves an asset at a given absolute file path.
         /// </summary>
@@ -362,9 +369,10 @@ namespace oo
         /// </summary>
         /// <param name="fp">The file path.</param>
         /// <returns>The tuple containing the content path, meta path, and extension respectively.</returns>
-        std::tuple<std::filesystem::path, std::filesystem::path, std::filesystem::path> getAssetPathParts(const std::filesystem::path& fp);
+        static std::tuple<std::filesystem::path, std::filesystem::path, std::filesystem::path> getAssetPathParts(const std::filesystem::path& fp);
 
         friend Asset;
+        friend AssetIndex;
     };
 
     class AssetNotFoundException : public std::exception
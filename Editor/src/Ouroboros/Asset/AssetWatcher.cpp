@@ -0,0 +1,227 @@
+/************************************************************************************//*!
+\file           AssetWatcher.cpp
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Contains the definition for the AssetWatcher class.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+
+#include "pch.h"
+
+#include "AssetWatcher.h"
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+#ifdef __linux__
+    constexpr std::uint32_t WATCH_MASK = IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO | IN_ATTRIB | IN_ONLYDIR;
+#endif
+}
+
+namespace oo
+{
+    AssetWatcher::AssetWatcher(AssetIndex& index, ChangeCallback onChanges)
+        : index{ index }
+        , onChanges{ std::move(onChanges) }
+    {
+#ifdef __linux__
+        notifyHandle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (notifyHandle >= 0)
+        {
+            notified = true;
+            watchTree({});
+            // Catch whatever changed between the caller's last scan and the watches going up
+            rootDirty = true;
+        }
+#endif
+        thread = std::thread(&AssetWatcher::run, this);
+    }
+
+    AssetWatcher::~AssetWatcher()
+    {
+        {
+            std::scoped_lock lock{ requestMutex };
+            stopRequested = true;
+        }
+        requestCondition.notify_all();
+        thread.join();
+#ifdef __linux__
+        if (notifyHandle >= 0)
+            close(notifyHandle);
+#endif
+    }
+
+    bool AssetWatcher::IsNotified() const
+    {
+        return notified;
+    }
+
+    void AssetWatcher::RequestScan()
+    {
+        {
+            std::scoped_lock lock{ requestMutex };
+            scanRequested = true;
+            // Nothing tells us what changed, so look everywhere
+            if (!notified)
+                rootDirty = true;
+        }
+        requestCondition.notify_all();
+    }
+
+    void AssetWatcher::RequestFullScan()
+    {
+        {
+            std::scoped_lock lock{ requestMutex };
+            fullScanRequested = true;
+        }
+        requestCondition.notify_all();
+    }
+
+    void AssetWatcher::run()
+    {
+        while (true)
+        {
+            waitForChanges(WAKE_INTERVAL);
+
+            std::vector<std::filesystem::path> dirs;
+            bool trustRecord = true;
+            {
+                std::scoped_lock lock{ requestMutex };
+                if (stopRequested)
+                    break;
+
+                const bool SETTLED = std::chrono::steady_clock::now() - lastChange >= DEBOUNCE;
+                const bool DIRTY = rootDirty || !dirtyDirs.empty();
+                if (fullScanRequested)
+                {
+                    trustRecord = false;
+                }
+                else if (!DIRTY || !(scanRequested || SETTLED))
+                {
+                    // Requested with nothing to do, or still waiting for the changes to settle
+                    if (!DIRTY)
+                        scanRequested = false;
+                    continue;
+                }
+
+                if (!rootDirty && !fullScanRequested)
+                    dirs = std::move(dirtyDirs);
+                dirtyDirs.clear();
+                rootDirty = false;
+                scanRequested = false;
+                fullScanRequested = false;
+            }
+
+            AssetIndex::ChangeList changes = index.Scan(dirs, trustRecord);
+            if (!changes.empty())
+                onChanges(std::move(changes));
+        }
+    }
+
+#ifdef __linux__
+    void AssetWatcher::waitForChanges(std::chrono::milliseconds timeout)
+    {
+        if (!notified)
+        {
+            std::unique_lock lock{ requestMutex };
+            requestCondition.wait_for(lock, timeout, [this]() { return stopRequested || scanRequested || fullScanRequested; });
+            return;
+        }
+
+        // Requests are picked up when this times out
+        pollfd pfd{ notifyHandle, POLLIN, 0 };
+        if (poll(&pfd, 1, static_cast<int>(timeout.count())) <= 0)
+            return;
+
+        alignas(inotify_event) char buffer[16 * 1024];
+        ssize_t length = 0;
+        while ((length = read(notifyHandle, buffer, sizeof(buffer))) > 0)
+        {
+            std::vector<std::filesystem::path> newDirs;
+            {
+                std::scoped_lock lock{ requestMutex };
+                for (char* p = buffer; p < buffer + length; p += sizeof(inotify_event) + reinterpret_cast<inotify_event*>(p)->len)
+                {
+                    const inotify_event* ev = reinterpret_cast<inotify_event*>(p);
+                    if (ev->mask & IN_Q_OVERFLOW)
+                    {
+                        // Lost track of what changed
+                        rootDirty = true;
+                        continue;
+                    }
+                    if (ev->mask & IN_IGNORED)
+                    {
+                        watchedDirs.erase(ev->wd);
+                        continue;
+                    }
+
+                    const auto IT = watchedDirs.find(ev->wd);
+                    if (IT == watchedDirs.end())
+                        continue;
+                    dirtyDirs.emplace_back(IT->second);
+                    if ((ev->mask & IN_ISDIR) && (ev->mask & (IN_CREATE | IN_MOVED_TO)) && ev->len > 0)
+                        newDirs.emplace_back(IT->second / ev->name);
+                }
+                lastChange = std::chrono::steady_clock::now();
+            }
+
+            // Anything created inside these before they are watched is still found, their parent is dirty
+            for (const auto& dir : newDirs)
+                watchTree(dir);
+        }
+    }
+
+    void AssetWatcher::watchTree(const std::filesystem::path& dir)
+    {
+        const std::filesystem::path& ROOT = index.GetRootDirectory();
+        const std::filesystem::path DIR = dir.empty() ? ROOT : ROOT / dir;
+
+        auto watch = [this](const std::filesystem::path& fp, const std::filesystem::path& relative)
+        {
+            const int WD = inotify_add_watch(notifyHandle, fp.c_str(), WATCH_MASK);
+            if (WD >= 0)
+            {
+                watchedDirs.insert_or_assign(WD, relative);
+            }
+            else if (errno == ENOSPC)
+            {
+                // Out of watches, go back to rescanning everything on request
+                LOG_WARN("Ran out of inotify watches, falling back to polling the asset directory");
+                close(notifyHandle);
+                notifyHandle = -1;
+                notified = false;
+                watchedDirs.clear();
+                std::scoped_lock lock{ requestMutex };
+                rootDirty = true;
+            }
+        };
+
+        watch(DIR, dir);
+        std::error_code ec;
+        auto it = std::filesystem::recursive_directory_iterator(DIR, std::filesystem::directory_options::skip_permission_denied, ec);
+        for (; notified && !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec))
+        {
+            std::error_code ecFile;
+            if (it->is_directory(ecFile))
+                watch(it->path(), it->path().lexically_relative(ROOT));
+        }
+    }
+#else
+    void AssetWatcher::waitForChanges(std::chrono::milliseconds timeout)
+    {
+        std::unique_lock lock{ requestMutex };
+        requestCondition.wait_for(lock, timeout, [this]() { return stopRequested || scanRequested || fullScanRequested; });
+    }
+#endif
+}
@@ -0,0 +1,141 @@
+/************************************************************************************//*!
+\file           AssetWatcher.h
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Contains the declaration for the AssetWatcher class, which keeps an
+                AssetIndex up to date on its own thread.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "AssetIndex.h"
+
+/****************************************************************************************
+*
+* Asset Watcher
+*
+* 1) On Linux, inotify reports which directories changed and only those are rescanned.
+* 2) Elsewhere, or when inotify cannot keep up, the whole root is rescanned on request.
+* 3) Changes are collected until the filesystem has been quiet for DEBOUNCE, so a burst
+*    such as a copy or a source control update turns into a single scan.
+* 4) Every scan that finds changes hands them to the callback, on the watcher thread.
+*
+****************************************************************************************/
+
+namespace oo
+{
+    class AssetWatcher
+    {
+    public:
+        /* --------------------------------------------------------------------------- */
+        /* Type Definitions                                                            */
+        /* --------------------------------------------------------------------------- */
+
+        using ChangeCallback = std::function<void(AssetIndex::ChangeList&&)>;
+
+        /* --------------------------------------------------------------------------- */
+        /* Constants                                                                   */
+        /* --------------------------------------------------------------------------- */
+
+        static constexpr std::chrono::milliseconds DEBOUNCE = std::chrono::milliseconds(200);
+        static constexpr std::chrono::milliseconds WAKE_INTERVAL = std::chrono::milliseconds(100);
+
+        /* --------------------------------------------------------------------------- */
+        /* Constructors and Destructors                                                */
+        /* --------------------------------------------------------------------------- */
+
+        AssetWatcher(AssetIndex& index, ChangeCallback onChanges);
+        AssetWatcher(const AssetWatcher&) = delete;
+        AssetWatcher& operator=(const AssetWatcher&) = delete;
+        ~AssetWatcher();
+
+        /* --------------------------------------------------------------------------- */
+        /* Getters                                                                     */
+        /* --------------------------------------------------------------------------- */
+
+        /// <summary>
+        /// Whether the operating system reports changes, rather than the root being rescanned on request.
+        /// </summary>
+        [[nodiscard]] bool IsNotified() const;
+
+        /* --------------------------------------------------------------------------- */
+        /* Functions                                                                   */
+        /* --------------------------------------------------------------------------- */
+
+        /// <summary>
+        /// Scans for changes as soon as possible, without waiting out the debounce.
+        /// </summary>
+        void RequestScan();
+
+        /// <summary>
+        /// Scans the whole root, reading every meta file again.
+        /// </summary>
+        void RequestFullScan();
+
+    private:
+        /* --------------------------------------------------------------------------- */
+        /* Members                                                                     */
+        /* --------------------------------------------------------------------------- */
+
+        AssetIndex& index;
+        ChangeCallback onChanges;
+
+        std::mutex requestMutex;
+        std::condition_variable requestCondition;
+        bool stopRequested = false;
+        bool scanRequested = false;
+        bool fullScanRequested = false;
+        bool rootDirty = false;
+        std::vector<std::filesystem::path> dirtyDirs;
+        std::chrono::steady_clock::time_point lastChange;
+        std::atomic<bool> notified = false;
+
+#ifdef __linux__
+        int notifyHandle = -1;
+        std::unordered_map<int, std::filesystem::path> watchedDirs;
+#endif
+
+        std::thread thread;
+
+        /* --------------------------------------------------------------------------- */
+        /* Functions                                                                   */
+        /* --------------------------------------------------------------------------- */
+
+        /// <summary>
+        /// Waits for and scans changes until stopped.
+        /// </summary>
+        void run();
+
+        /// <summary>
+        /// Waits up to a timeout for the operating system to report changes, marking what changed dirty.
+        /// Without notifications this waits for a request instead.
+        /// </summary>
+        /// <param name="timeout">The longest time to wait.</param>
+        void waitForChanges(std::chrono::milliseconds timeout);
+
+#ifdef __linux__
+        /// <summary>
+        /// Starts watching a directory and everything under it.
+        /// </summary>
+        /// <param name="dir">The directory relative to the root.</param>
+        void watchTree(const std::filesystem::path& dir);
+#endif
+    };
+}
@@ -93,6 +93,7 @@ void oo::Ordering_ActionCommand::Undo()
 	auto old = scene->FindWithInstanceID(previous);
 	auto go = scene->FindWithInstanceID(object);
 	go->GetSceneNode().lock()->move_to(old->GetSceneNode().lock(), undo_move_to_after);
+	scene->MarkHierarchyChanged(*go);
 }
 
 void oo::Ordering_ActionCommand::Redo()
@@ -101,6 +102,7 @@ void oo::Ordering_ActionCommand::Redo()
 	auto curr = scene->FindWithInstanceID(target);
 	auto go = scene->FindWithInstanceID(object);
 	go->GetSceneNode().lock()->move_to(curr->GetSceneNode().lock(), redo_move_to_after);
+	scene->MarkHierarchyChanged(*go);
 }
 
 oo::Ordering_ActionCommand::Ordering_ActionCommand(PacketHeader& header, std::string& data)
@@ -120,6 +120,14 @@ namespace oo
                 TRACY_PROFILE_SCOPE_END();
             }
 
+            {
+                // deliver events queued off the main thread during the frame
+                TRACY_PROFILE_SCOPE_N(event_dispatch_queued);
+                OPTICK_FRAME("event_dispatch_queued");
+                EventManager::DispatchQueued();
+                TRACY_PROFILE_SCOPE_END();
+            }
+
             {
                 // swap buffers at the end of frame
                 TRACY_PROFILE_SCOPE_N(windows_swap_buffer);
@@ -19,7 +19,9 @@ Technology is prohibited.
 
 #include "Timer.h"
 #include "Log.h"
+#include "WorkerPool.h"
 #include <Physics/Source/phy.h>
+#include "Ouroboros/Physics/PhysicsDispatcher.h"
 #include "Ouroboros/Audio/Audio.h"
 //#include <JobSystem/src/final/jobs.h>
 #include "Accessibility.h"
@@ -38,13 +40,28 @@ namespace oo
             log::init();
             LOG_CORE_INFO("Begin loading static lifetime objects");
             timer::init();
+            worker_pool::init();
+            // ecs parallel iteration shares the engine worker pool
+            Ecs::parallel_dispatcher = [](size_t count, void* context, Ecs::ParallelWorkFn* work)
+            {
+                worker_pool::parallel_for(count, 1, [&](size_t begin, size_t end)
+                    {
+                        for (size_t i = begin; i < end; ++i)
+                            work(context, i);
+                    });
+            };
             myPhysx::physx_system::init();
+            // physx runs its tasks on the same pool instead of its own threads
+            myPhysx::physx_system::setCpuDispatcher(&PhysicsDispatcher::Instance());
             audio::Init(2048);
         }
     
         void terminate()
         {
             timer::terminate();
+            Ecs::parallel_dispatcher = nullptr;
+            myPhysx::physx_system::setCpuDispatcher(nullptr);
+            worker_pool::terminate();
             LOG_CORE_INFO("Finish unloading static lifetime objects");
             log::shutdown();
             myPhysx::physx_system::shutdown();
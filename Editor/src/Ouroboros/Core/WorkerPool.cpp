@@ -0,0 +1,326 @@
+/************************************************************************************//*!
+\file           WorkerPool.cpp
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Defines the engine owned work-stealing worker pool.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#include "pch.h"
+#include "WorkerPool.h"
+
+#include "Ouroboros/Core/Log.h"
+
+#include <shared_mutex>
+
+#ifdef OO_PLATFORM_WINDOWS
+#include <windows.h>
+#endif
+
+namespace oo
+{
+    namespace worker_pool
+    {
+        struct queued_task
+        {
+            task work;
+            task_group* group;
+        };
+
+        struct worker_queue
+        {
+            std::mutex lock;
+            std::deque<queued_task> tasks;
+        };
+
+        std::vector<std::unique_ptr<worker_queue>> s_queues;
+        std::vector<std::thread> s_threads;
+
+        // held shared while s_queues is used from outside the workers, exclusively while init and
+        // terminate change it, so a submit racing terminate either lands before the drain or runs inline
+        std::shared_mutex s_lifetime_lock;
+        // keeps init from starting while terminate is still joining and draining
+        std::mutex s_init_lock;
+
+        std::mutex s_sleep_lock;
+        std::condition_variable s_sleep_cv;
+        std::atomic<std::size_t> s_queued{ 0 };
+        std::atomic<bool> s_running{ false };
+        std::atomic<std::size_t> s_next_queue{ 0 };
+
+        // index of the queue owned by this thread, external threads own none
+        thread_local std::size_t s_local_queue = std::numeric_limits<std::size_t>::max();
+
+        //private
+        std::size_t local_queue_index()
+        {
+            if (s_local_queue < s_threads.size())
+                return s_local_queue;
+            // external threads spread their submissions over the workers
+            return s_next_queue.fetch_add(1, std::memory_order_relaxed) % s_queues.size();
+        }
+
+        //private
+        bool try_pop(std::size_t index, queued_task& out)
+        {
+            worker_queue& queue = *s_queues[index];
+            std::scoped_lock guard{ queue.lock };
+            if (queue.tasks.empty())
+                return false;
+            // owner works LIFO for cache locality
+            out = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            return true;
+        }
+
+        //private
+        bool try_steal(std::size_t thief, queued_task& out)
+        {
+            std::size_t const count = s_queues.size();
+            for (std::size_t i = 1; i <= count; ++i)
+            {
+                worker_queue& queue = *s_queues[(thief + i) % count];
+                std::scoped_lock guard{ queue.lock };
+                if (queue.tasks.empty())
+                    continue;
+                // thieves take the oldest (usually largest) work
+                out = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+                return true;
+            }
+            return false;
+        }
+
+        //private
+        bool try_acquire(queued_task& out)
+        {
+            std::size_t const self = s_local_queue < s_queues.size() ? s_local_queue : 0;
+            if (s_local_queue < s_queues.size() && try_pop(self, out))
+                return true;
+            return try_steal(self, out);
+        }
+
+        //private
+        // only takes tasks of the group, a waiter must not pick up unrelated long running work like asset decodes
+        bool try_acquire_from(task_group& group, queued_task& out)
+        {
+            std::size_t const count = s_queues.size();
+            std::size_t const self = s_local_queue < count ? s_local_queue : 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                worker_queue& queue = *s_queues[(self + i) % count];
+                std::scoped_lock guard{ queue.lock };
+                // newest first, the group was most likely submitted just before waiting
+                auto iter = std::find_if(queue.tasks.rbegin(), queue.tasks.rend(), [&](queued_task const& item) { return item.group == &group; });
+                if (iter == queue.tasks.rend())
+                    continue;
+                out = std::move(*iter);
+                queue.tasks.erase(std::next(iter).base());
+                return true;
+            }
+            return false;
+        }
+
+        //private
+        void execute(queued_task& item)
+        {
+            s_queued.fetch_sub(1, std::memory_order_relaxed);
+            item.work();
+            item.group->pending.fetch_sub(1, std::memory_order_acq_rel);
+        }
+
+        //private
+        void worker_main(std::size_t index)
+        {
+            s_local_queue = index;
+
+            while (s_running.load(std::memory_order_acquire))
+            {
+                queued_task item;
+                if (try_acquire(item))
+                {
+                    execute(item);
+                    continue;
+                }
+
+                std::unique_lock guard{ s_sleep_lock };
+                s_sleep_cv.wait(guard, []()
+                    {
+                        return s_queued.load(std::memory_order_acquire) > 0 || s_running.load(std::memory_order_acquire) == false;
+                    });
+            }
+        }
+
+        //private
+        void pin_thread(std::thread& thread, std::size_t index, std::uint64_t affinity_mask)
+        {
+            if (affinity_mask == 0)
+                return;
+
+            std::vector<std::uint64_t> cores;
+            for (std::uint64_t bit = 0; bit < 64; ++bit)
+                if (affinity_mask & (std::uint64_t{ 1 } << bit))
+                    cores.emplace_back(std::uint64_t{ 1 } << bit);
+
+#ifdef OO_PLATFORM_WINDOWS
+            SetThreadAffinityMask(thread.native_handle(), static_cast<DWORD_PTR>(cores[index % cores.size()]));
+#endif
+        }
+
+        void init(std::size_t thread_count, std::uint64_t affinity_mask)
+        {
+            std::scoped_lock init_guard{ s_init_lock };
+            std::unique_lock lifetime{ s_lifetime_lock };
+            if (s_running)
+                return;
+
+            if (thread_count == 0)
+            {
+                std::size_t const hardware = std::thread::hardware_concurrency();
+                thread_count = hardware > 1 ? hardware - 1 : 1;
+            }
+
+            s_queues.clear();
+            for (std::size_t i = 0; i < thread_count; ++i)
+                s_queues.emplace_back(std::make_unique<worker_queue>());
+
+            s_running = true;
+            for (std::size_t i = 0; i < thread_count; ++i)
+            {
+                s_threads.emplace_back(worker_main, i);
+                pin_thread(s_threads.back(), i, affinity_mask);
+            }
+
+            LOG_CORE_INFO("Worker pool started with {0} threads", thread_count);
+        }
+
+        void terminate()
+        {
+            std::scoped_lock init_guard{ s_init_lock };
+            {
+                // once this is released every submit sees the pool stopped, nothing more is queued
+                std::unique_lock lifetime{ s_lifetime_lock };
+                if (s_running == false)
+                    return;
+
+                std::scoped_lock guard{ s_sleep_lock };
+                s_running = false;
+            }
+            s_sleep_cv.notify_all();
+
+            // not holding the lifetime lock, tasks still running may submit more and run them inline
+            for (auto& thread : s_threads)
+                thread.join();
+
+            std::vector<queued_task> remaining;
+            {
+                std::unique_lock lifetime{ s_lifetime_lock };
+                for (auto& queue : s_queues)
+                    std::move(queue->tasks.begin(), queue->tasks.end(), std::back_inserter(remaining));
+
+                s_threads.clear();
+                s_queues.clear();
+                s_queued = 0;
+            }
+
+            // tasks still queued run here, so no task group is left waiting on them forever
+            for (auto& item : remaining)
+            {
+                item.work();
+                item.group->pending.fetch_sub(1, std::memory_order_acq_rel);
+            }
+        }
+
+        bool is_initialized()
+        {
+            return s_running;
+        }
+
+        std::size_t thread_count()
+        {
+            return s_threads.size();
+        }
+
+        void submit(task_group& group, task work)
+        {
+            group.pending.fetch_add(1, std::memory_order_acq_rel);
+
+            std::shared_lock lifetime{ s_lifetime_lock };
+            if (s_running == false)
+            {
+                lifetime.unlock();
+                work();
+                group.pending.fetch_sub(1, std::memory_order_acq_rel);
+                return;
+            }
+
+            // counted before it is visible so a thief can never drive the count below zero
+            {
+                std::scoped_lock guard{ s_sleep_lock };
+                s_queued.fetch_add(1, std::memory_order_release);
+            }
+
+            {
+                worker_queue& queue = *s_queues[local_queue_index()];
+                std::scoped_lock guard{ queue.lock };
+                queue.tasks.emplace_back(queued_task{ std::move(work), &group });
+            }
+            s_sleep_cv.notify_one();
+        }
+
+        void wait(task_group& group)
+        {
+            TRACY_PROFILE_SCOPE_NC(worker_pool_wait, tracy::Color::Gray);
+
+            while (group.pending.load(std::memory_order_acquire) > 0)
+            {
+                queued_task item;
+                bool acquired = false;
+                {
+                    std::shared_lock lifetime{ s_lifetime_lock };
+                    acquired = s_running && try_acquire_from(group, item);
+                }
+                if (acquired)
+                    execute(item);
+                else
+                    std::this_thread::yield();
+            }
+
+            TRACY_PROFILE_SCOPE_END();
+        }
+
+        void parallel_for(std::size_t count, std::size_t min_batch, range_task const& work)
+        {
+            if (count == 0)
+                return;
+
+            min_batch = std::max<std::size_t>(min_batch, 1);
+
+            // aim for a few batches per thread so stealing can even out uneven work
+            std::size_t const workers = s_threads.size() + 1;
+            std::size_t const batch = std::max(min_batch, count / (workers * 4) + 1);
+
+            if (s_running == false || count <= batch)
+            {
+                work(0, count);
+                return;
+            }
+
+            task_group group;
+            for (std::size_t begin = batch; begin < count; begin += batch)
+            {
+                std::size_t const end = std::min(begin + batch, count);
+                submit(group, [&work, begin, end]() { work(begin, end); });
+            }
+            // the caller takes the first batch itself
+            work(0, batch);
+
+            wait(group);
+        }
+    }
+}
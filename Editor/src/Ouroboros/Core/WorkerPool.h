@@ -0,0 +1,56 @@
+/************************************************************************************//*!
+\file           WorkerPool.h
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Declares the engine owned work-stealing worker pool.
+                Each worker owns a task deque, pops from the back of its own deque
+                and steals from the front of the other workers' deques when idle.
+                Threads waiting on a task group help execute that group's tasks instead
+                of blocking.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <cstddef>
+#include <cstdint>
+
+namespace oo
+{
+    namespace worker_pool
+    {
+        // tracks the number of outstanding tasks submitted under it
+        struct task_group
+        {
+            std::atomic<std::size_t> pending{ 0 };
+        };
+
+        using task = std::function<void()>;
+        using range_task = std::function<void(std::size_t begin, std::size_t end)>;
+
+        // thread_count of 0 uses hardware concurrency - 1, leaving the main thread its own core.
+        // a non zero affinity_mask pins worker i to the i-th set bit of the mask, wrapping around.
+        void init(std::size_t thread_count = 0, std::uint64_t affinity_mask = 0);
+        void terminate();
+
+        bool is_initialized();
+        std::size_t thread_count();
+
+        // adds a task to the pool under the group. runs inline if the pool isn't initialized.
+        void submit(task_group& group, task work);
+        // blocks until every task in the group completes, executing the group's pending tasks meanwhile.
+        // tasks of other groups are left to the workers, so waiting never runs someone else's long task.
+        void wait(task_group& group);
+
+        // splits [0, count) into ranges of at least min_batch and runs them on the pool,
+        // returning when every range completes. The calling thread participates.
+        void parallel_for(std::size_t count, std::size_t min_batch, range_task const& work);
+    }
+}
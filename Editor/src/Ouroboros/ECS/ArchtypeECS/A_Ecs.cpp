@@ -22,8 +22,29 @@ namespace Ecs
 		return std::unordered_map<uint64_t, ComponentInfo>{};
 	}();
 
+	namespace
+	{
+		//sorted component infos for the hashes with any repeats removed
+		std::vector<ComponentInfo const*> sorted_component_infos(std::vector<uint64_t> const& component_hashes)
+		{
+			std::vector<ComponentInfo const*> componentInfos;
+			componentInfos.reserve(component_hashes.size());
+			for (auto c : component_hashes)
+				componentInfos.emplace_back(&componentInfo_map[c]);
+
+			if (componentInfos.empty() == false)
+				internal::sort_ComponentInfos(componentInfos.data(), componentInfos.size());
+			componentInfos.erase(std::unique(componentInfos.begin(), componentInfos.end()), componentInfos.end());
+			return componentInfos;
+		}
+	}
+
 	IECSWorld::~IECSWorld()
 	{
+		//queries drop their caches of this world on their next lookup
+		std::erase(internal::live_worlds, world_id);
+		++internal::destroyed_worlds;
+
 		//destuctor for all entity components
 		for (auto& entt : entities)
 		{
@@ -89,6 +110,15 @@ namespace Ecs
 		return storage.chunk->header.componentList->components.size();
 	}
 
+	bool IECSWorld::matches_query(EntityID id, IQuery const& query)
+	{
+		if (internal::is_entity_valid(this, id) == false)
+			return false;
+
+		auto const& archetypes = internal::get_matching_archetypes(this, query);
+		return std::find(archetypes.begin(), archetypes.end(), internal::get_entity_archetype(this, id)) != archetypes.end();
+	}
+
 	EntityID IECSWorld::new_entity(std::vector<uint64_t> const& component_hashes)
 	{
 		Archetype* arch = nullptr;
@@ -130,6 +160,104 @@ namespace Ecs
 		return entity;
 	}
 
+	EntityID IECSWorld::duplicate_entity(EntityID id, std::vector<uint64_t> const& extra_component_hashes)
+	{
+		assert(internal::is_entity_valid(this, id));
+		Archetype* originalArch = internal::get_entity_archetype(this, id);
+
+		//union of the original's components and the extras
+		std::vector<uint64_t> hashes = componentHashes(id);
+		hashes.insert(hashes.end(), extra_component_hashes.begin(), extra_component_hashes.end());
+		std::vector<ComponentInfo const*> componentInfos = sorted_component_infos(hashes);
+
+		Archetype* arch = originalArch;
+		if (componentInfos.size() != originalArch->componentList->components.size())
+			arch = internal::find_or_create_archetype(this, componentInfos.data(), componentInfos.size());
+
+		auto entity = internal::duplicate_entity_into_archetype(arch, id);
+
+		//only the extras the original did not have are new, broadcast in the order given
+		auto& originalList = originalArch->componentList->components;
+		std::vector<ComponentInfo const*> added;
+		for (auto c : extra_component_hashes)
+		{
+			ComponentInfo const* type = &componentInfo_map[c];
+			bool present = std::find(added.begin(), added.end(), type) != added.end()
+				|| std::find_if(originalList.begin(), originalList.end(), [type](auto const& cmp) { return cmp.type == type; }) != originalList.end();
+			if (present == false)
+			{
+				added.emplace_back(type);
+				type->broadcast_AddComponentEvent(*this, entity);
+			}
+		}
+
+		internal::broadcast_add_entity_callback(this, entity);
+		return entity;
+	}
+
+	void IECSWorld::new_entities(std::vector<uint64_t> const& component_hashes, size_t count, std::vector<EntityID>& out)
+	{
+		std::vector<ComponentInfo const*> componentInfos = sorted_component_infos(component_hashes);
+		//empty component list will use the hardcoded null archetype
+		Archetype* arch = componentInfos.empty()
+			? get_empty_archetype()
+			: internal::find_or_create_archetype(this, componentInfos.data(), componentInfos.size());
+
+		size_t first = out.size();
+		out.resize(first + count);
+		internal::create_entities_with_archetype(arch, count, out.data() + first);
+
+		internal::broadcast_new_entities(this, componentInfos, out.data() + first, count);
+	}
+
+	void IECSWorld::add_components(EntityID id, std::vector<uint64_t> const& component_hashes)
+	{
+		assert(internal::is_entity_valid(this, id));
+		auto& current = internal::get_entity_archetype(this, id)->componentList->components;
+
+		//components not on the entity yet, kept in the given order so the add
+		//callbacks fire in the same order as adding them one by one would
+		std::vector<ComponentInfo const*> added;
+		added.reserve(component_hashes.size());
+		for (auto c : component_hashes)
+		{
+			ComponentInfo const* type = &componentInfo_map[c];
+			bool present = std::find(added.begin(), added.end(), type) != added.end()
+				|| std::find_if(current.begin(), current.end(), [type](auto const& cmp) { return cmp.type == type; }) != current.end();
+			if (present == false)
+				added.emplace_back(type);
+		}
+		if (added.empty())
+			return;
+
+		internal::add_components_to_entity(this, id, added.data(), added.size());
+
+		for (auto& type : added)
+			type->broadcast_AddComponentEvent(*this, id);
+	}
+
+	void IECSWorld::destroy(std::vector<EntityID> const& eids)
+	{
+		//everything is broadcast before anything is erased so callbacks still see the whole batch
+		internal::broadcast_destroy_entities(this, eids.data(), eids.size());
+		internal::destroy_entities(this, eids.data(), eids.size());
+	}
+
+
+	EntityCommandBuffer& IECSWorld::get_command_buffer()
+	{
+		return command_buffers.local(world_id);
+	}
+
+	void IECSWorld::playback_commands()
+	{
+		command_buffers.playback(*this);
+	}
+
+	void IECSWorld::set_command_structure(internal::CommandBufferSet::CreateFn create, internal::CommandBufferSet::DestroyFn destroy)
+	{
+		command_buffers.set_structure(std::move(create), std::move(destroy));
+	}
 
 	std::vector<uint64_t> const IECSWorld::componentHashes(EntityID id)
 	{
@@ -164,16 +292,151 @@ namespace Ecs
 		return world.duplicate_entity(id);
 	}
 
+	EntityID ECSWorld::duplicate_entity(EntityID id, std::vector<uint64_t> const& extra_component_hashes)
+	{
+		return world.duplicate_entity(id, extra_component_hashes);
+	}
+
+	void ECSWorld::new_entities(std::vector<uint64_t> const& component_hashes, size_t count, std::vector<EntityID>& out)
+	{
+		world.new_entities(component_hashes, count, out);
+	}
+
+	void ECSWorld::add_components(EntityID id, std::vector<uint64_t> const& component_hashes)
+	{
+		world.add_components(id, component_hashes);
+	}
+
 	std::vector<uint64_t> const ECSWorld::componentHashes(EntityID id)
 	{
 		return world.componentHashes(id);
 	}
 
+	bool ECSWorld::matches_query(EntityID id, IQuery& query)
+	{
+		return world.matches_query(id, query);
+	}
+
 	void ECSWorld::destroy(EntityID eid)
 	{
 		world.destroy(eid);
 	}
 
+	void ECSWorld::destroy(std::vector<EntityID> const& eids)
+	{
+		world.destroy(eids);
+	}
+
+	EntityCommandBuffer& ECSWorld::get_command_buffer()
+	{
+		return world.get_command_buffer();
+	}
+
+	void ECSWorld::playback_commands()
+	{
+		world.playback_commands();
+	}
+
+	void ECSWorld::set_command_structure(internal::CommandBufferSet::CreateFn create, internal::CommandBufferSet::DestroyFn destroy)
+	{
+		world.set_command_structure(std::move(create), std::move(destroy));
+	}
+
+	void EntityCommandBuffer::destroy(uint64_t sort_key, EntityID id)
+	{
+		enqueue(sort_key, [id](IECSWorld& world)
+			{
+				if (internal::is_entity_valid(&world, id))
+					world.command_buffers.destroy_entity(world, id);
+			});
+	}
+
+	void EntityCommandBuffer::enqueue(uint64_t sort_key, Command command)
+	{
+		records.emplace_back(Record{ sort_key, internal::command_ordinal, thread, static_cast<uint32_t>(records.size()), std::move(command) });
+	}
+
+	namespace internal
+	{
+		EntityCommandBuffer& CommandBufferSet::local(uint32_t world_id)
+		{
+			//most lookups come from the same thread recording into the same world repeatedly
+			thread_local uint32_t cached_world{ 0 };
+			thread_local EntityCommandBuffer* cached_buffer{ nullptr };
+			if (cached_world == world_id && cached_buffer)
+				return *cached_buffer;
+
+			std::scoped_lock guard{ lock };
+			auto& buffer = thread_buffers[std::this_thread::get_id()];
+			if (buffer == nullptr)
+			{
+				buffers.emplace_back(std::make_unique<EntityCommandBuffer>());
+				buffer = buffers.back().get();
+				buffer->thread = static_cast<uint32_t>(buffers.size() - 1);
+			}
+
+			cached_world = world_id;
+			cached_buffer = buffer;
+			return *buffer;
+		}
+
+		void CommandBufferSet::playback(IECSWorld& world)
+		{
+			{
+				std::scoped_lock guard{ lock };
+				for (auto& buffer : buffers)
+				{
+					std::move(buffer->records.begin(), buffer->records.end(), std::back_inserter(pending));
+					buffer->records.clear();
+				}
+			}
+			if (pending.empty())
+				return;
+
+			std::sort(pending.begin(), pending.end(), [](auto const& lhs, auto const& rhs)
+				{
+					if (lhs.sort_key != rhs.sort_key)
+						return lhs.sort_key < rhs.sort_key;
+					if (lhs.ordinal != rhs.ordinal)
+						return lhs.ordinal < rhs.ordinal;
+					if (lhs.thread != rhs.thread)
+						return lhs.thread < rhs.thread;
+					return lhs.sequence < rhs.sequence;
+				});
+
+			//commands may record more commands, those are left for the next playback
+			std::vector<EntityCommandBuffer::Record> running;
+			running.swap(pending);
+			for (auto& record : running)
+				record.command(world);
+
+			//hand the storage back so the next playback doesn't reallocate
+			running.clear();
+			pending.swap(running);
+		}
+
+		void CommandBufferSet::set_structure(CreateFn create, DestroyFn destroy)
+		{
+			create_fn = std::move(create);
+			destroy_fn = std::move(destroy);
+		}
+
+		EntityID CommandBufferSet::create_entity(IECSWorld& world)
+		{
+			if (create_fn)
+				return create_fn(world);
+			return world.new_entity<>();
+		}
+
+		void CommandBufferSet::destroy_entity(IECSWorld& world, EntityID id)
+		{
+			if (destroy_fn)
+				destroy_fn(world, id);
+			else
+				world.destroy(id);
+		}
+	}
+
 	void ECSWorld::SubscribeOnAddEntity(FnPtr function)
 	{
 		world.SubscribeOnAddEntity(function);
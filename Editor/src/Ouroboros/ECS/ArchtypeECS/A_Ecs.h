@@ -24,6 +24,7 @@ Technology is prohibited.
 #include "Wrapper.h"
 
 #include <future>
+#include <atomic>
 
 //#include <JobSystem/src/final/jobs.h>
 //#include "Ouroboros/TracyProfiling/OO_TracyProfiler.h"
@@ -31,6 +32,10 @@ Technology is prohibited.
 
 namespace Ecs
 {
+	//set by the engine to route parallel iteration through its worker pool.
+	//when null, parallel iteration falls back to the standard parallel algorithms
+	inline ParallelDispatchFn* parallel_dispatcher{ nullptr };
+
 	template<typename C>
 	struct CachedRef
 	{
@@ -38,6 +43,8 @@ namespace Ecs
 
 		C* pointer;
 		EnityToChunk storage;
+		//a chunk freed and allocated again at the same address can belong to another archetype
+		Archetype* archetype{ nullptr };
 	};
 
 
@@ -45,9 +52,11 @@ namespace Ecs
 	template<typename C>
 	C* CachedRef<C>::get_from(IECSWorld* world, EntityID target)
 	{
-		if (world->entities[target.index] != storage) {
+		EnityToChunk const& current = world->entities[target.index];
+		if (current != storage || current.chunk->header.archetype != archetype) {
 			pointer = &world->get_component<C>(target);
 			storage = world->entities[target.index];
+			archetype = storage.chunk->header.archetype;
 		}
 		return pointer;
 	}
@@ -164,6 +173,7 @@ namespace Ecs::internal
 	//declarations for callback
 	inline void broadcast_add_entity_callback(IECSWorld* world, EntityID eid);
 	inline void broadcast_destroy_entity_callback(IECSWorld* world, EntityID eid);
+	inline void broadcast_new_entities(IECSWorld* world, std::vector<const ComponentInfo*> const& types, const EntityID* ids, size_t count);
 
 	template<typename C>
 	inline void broadcast_add_component_callback(IECSWorld* world, EntityID eid, C& component);
@@ -207,35 +217,48 @@ namespace Ecs::internal
 		return mt;
 	}
 
-	//reorder archetype with the fullness
-	inline void set_chunk_full(DataChunk* chunk) {
-
+	//links a chunk with free slots into the front of its archetype's partial list
+	inline void link_partial_chunk(DataChunk* chunk) {
 		Archetype* arch = chunk->header.archetype;
-		if (arch) {
-			arch->full_chunks++;
 
-			//do it properly later
-			int archsize = arch->componentList->chunkCapacity;
+		chunk->header.prev = nullptr;
+		chunk->header.next = arch->partial_chunks;
+		if (arch->partial_chunks) {
+			arch->partial_chunks->header.prev = chunk;
+		}
+		arch->partial_chunks = chunk;
+	}
+	//removes a chunk from its archetype's partial list
+	inline void unlink_partial_chunk(DataChunk* chunk) {
+		Archetype* arch = chunk->header.archetype;
 
-			std::partition(arch->chunks.begin(), arch->chunks.end(), [archsize](DataChunk* cnk) {
-				return cnk->header.last == archsize;
-				});
+		if (chunk->header.prev) {
+			chunk->header.prev->header.next = chunk->header.next;
+		}
+		else {
+			arch->partial_chunks = chunk->header.next;
+		}
+		if (chunk->header.next) {
+			chunk->header.next->header.prev = chunk->header.prev;
 		}
+		chunk->header.prev = nullptr;
+		chunk->header.next = nullptr;
+	}
 
+	//chunk has no free slots left, stop handing it out
+	inline void set_chunk_full(DataChunk* chunk) {
 
+		Archetype* arch = chunk->header.archetype;
+		if (arch) {
+			arch->full_chunks++;
+			unlink_partial_chunk(chunk);
+		}
 	}
-	//reorder archetype with the fullness
+	//chunk has a free slot again, make it available for insertion
 	inline void set_chunk_partial(DataChunk* chunk) {
 		Archetype* arch = chunk->header.archetype;
 		arch->full_chunks--;
-
-		//do it properly later
-
-		int archsize = arch->componentList->chunkCapacity;
-
-		std::partition(arch->chunks.begin(), arch->chunks.end(), [archsize](DataChunk* cnk) {
-			return cnk->header.last == archsize;
-			});
+		link_partial_chunk(chunk);
 	}
 
 	inline ComponentCombination* build_component_list(const ComponentInfo** types, size_t count) {
@@ -247,12 +270,17 @@ namespace Ecs::internal
 			compsize += types[i]->size;
 		}
 
+		//reserve the worst case alignment padding of every component array
+		size_t alignmentSlack = 0;
+		for (size_t i = 0; i < count; i++) {
+			alignmentSlack += types[i]->align;
+		}
+
 		size_t availibleStorage = sizeof(DataChunk::storage);
-		//2 less than the real count to account for sizes and give some slack
-		size_t itemCount = (availibleStorage / compsize) - 2;
+		size_t itemCount = (availibleStorage - alignmentSlack) / compsize;
 
-		uint32_t offsets = sizeof(DataChunkHeader);
-		offsets += static_cast<uint32_t>(sizeof(EntityID) * itemCount);
+		//entity ids are stored at the start of the chunk
+		uint32_t offsets = static_cast<uint32_t>(sizeof(EntityID) * itemCount);
 
 		for (size_t i = 0; i < count; i++) {
 			const ComponentInfo* type = types[i];
@@ -260,8 +288,9 @@ namespace Ecs::internal
 			if (type->align != 0) {
 				//align properly
 				size_t remainder = offsets % type->align;
-				size_t oset = type->align - remainder;
-				offsets += static_cast<uint32_t>(oset);
+				if (remainder != 0) {
+					offsets += static_cast<uint32_t>(type->align - remainder);
+				}
 			}
 
 			list->components.push_back({ type,type->hash,offsets });
@@ -272,8 +301,8 @@ namespace Ecs::internal
 
 		}
 
-		//implement proper size handling later
-		assert(offsets <= BLOCK_MEMORY_16K);
+		//component arrays must never reach into the chunk header
+		assert(offsets <= sizeof(DataChunk::storage));
 
 		list->chunkCapacity = static_cast<int16_t>(itemCount);
 
@@ -304,20 +333,26 @@ namespace Ecs::internal
 		DataChunk* chunk = build_chunk(arch->componentList);
 
 		chunk->header.archetype = arch;
+		chunk->header.archetypeIndex = static_cast<uint32_t>(arch->chunks.size());
 		arch->chunks.push_back(chunk);
+		link_partial_chunk(chunk);
 		return chunk;
 	}
 	inline void delete_chunk_from_archetype(DataChunk* chunk) {
 		Archetype* owner = chunk->header.archetype;
-		DataChunk* backChunk = owner->chunks.back();
 
-		if (backChunk != chunk) {
-			for (int i = 0; i < owner->chunks.size(); i++) {
-				if (owner->chunks[i] == chunk) {
-					owner->chunks[i] = backChunk;
-				}
-			}
+		if (chunk->header.last < owner->componentList->chunkCapacity) {
+			unlink_partial_chunk(chunk);
 		}
+		else {
+			owner->full_chunks--;
+		}
+
+		//swap with the back chunk, fixing up its stored index
+		DataChunk* backChunk = owner->chunks.back();
+		uint32_t index = chunk->header.archetypeIndex;
+		owner->chunks[index] = backChunk;
+		backChunk->header.archetypeIndex = index;
 		owner->chunks.pop_back();
 		delete chunk;
 
@@ -493,18 +528,12 @@ namespace Ecs::internal
 		deallocate_entity(world, id);
 	}
 	inline DataChunk* find_free_chunk(Archetype* arch) {
-		DataChunk* targetChunk = nullptr;
-		if (arch->chunks.size() == 0) {
-			targetChunk = create_chunk_for_archetype(arch);
-		}
-		else {
-			targetChunk = arch->chunks[arch->chunks.size() - 1];
-			//chunk is full, create a new one
-			if (targetChunk->header.last == arch->componentList->chunkCapacity) {
-				targetChunk = create_chunk_for_archetype(arch);
-			}
+		//every chunk in the partial list has at least one free slot
+		if (arch->partial_chunks) {
+			return arch->partial_chunks;
 		}
-		return targetChunk;
+		//all chunks are full, create a new one
+		return create_chunk_for_archetype(arch);
 	}
 
 
@@ -685,6 +714,108 @@ namespace Ecs::internal
 		return newID;
 	}
 
+	//bulk version of create_entity_with_archetype, fills the partial chunks first and
+	//constructs each component array of a chunk in one run instead of per entity
+	inline void create_entities_with_archetype(Archetype* arch, size_t count, EntityID* out) {
+		IECSWorld* world = arch->ownerWorld;
+		ComponentCombination* cmpList = arch->componentList;
+
+		size_t created = 0;
+		while (created < count) {
+			DataChunk* chunk = find_free_chunk(arch);
+			int16_t begin = chunk->header.last;
+			size_t run = std::min<size_t>(count - created, static_cast<size_t>(cmpList->chunkCapacity - begin));
+
+			for (auto& cmp : cmpList->components) {
+				const ComponentInfo* mtype = cmp.type;
+				if (mtype->is_empty())
+					continue;
+
+				byte* ptr = (byte*)chunk + cmp.chunkOffset + (mtype->size * (long)begin);
+				for (size_t i = 0; i < run; ++i, ptr += mtype->size)
+					mtype->constructor(ptr);
+			}
+
+			EntityID* eidptr = ((EntityID*)chunk);
+			for (size_t i = 0; i < run; ++i) {
+				EntityID newID = allocate_entity(world);
+				uint16_t index = static_cast<uint16_t>(begin + i);
+
+				eidptr[index] = newID;
+				world->entities[newID.index].chunk = chunk;
+				world->entities[newID.index].chunkIndex = index;
+				out[created + i] = newID;
+			}
+
+			chunk->header.last = static_cast<int16_t>(begin + run);
+			//if full, reorder it on archetype
+			if (chunk->header.last == cmpList->chunkCapacity) {
+				set_chunk_full(chunk);
+			}
+			created += run;
+		}
+	}
+
+	//copies every component the original has into copy, which lives in an archetype
+	//holding a superset of the original's components. the extra components are default constructed.
+	inline void copy_entity_data_across_archetypes(Archetype* arch, EntityID copy, EntityID original) {
+		IECSWorld* world = arch->ownerWorld;
+		DataChunk* originalChunk = world->entities[original.index].chunk;
+		DataChunk* copyChunk = world->entities[copy.index].chunk;
+
+		int originalindex = world->entities[original.index].chunkIndex;
+		int copyindex = world->entities[copy.index].chunkIndex;
+
+		auto& originalList = originalChunk->header.componentList->components;
+		auto& copyList = arch->componentList->components;
+
+		//both lists are sorted the same way, so walk them together
+		size_t j = 0;
+		for (auto& cmp : copyList) {
+			const ComponentInfo* mtype = cmp.type;
+			while (j < originalList.size() && compare_metatypes(originalList[j].type, mtype))
+				j++;
+
+			if (mtype->is_empty())
+				continue;
+
+			void* ptrCopy = (void*)((byte*)copyChunk + cmp.chunkOffset + (mtype->size * (long)copyindex));
+			if (j < originalList.size() && originalList[j].type == mtype) {
+				void* ptrOriginal = (void*)((byte*)originalChunk + originalList[j].chunkOffset +
+					(mtype->size * (long)originalindex));
+				mtype->copy_constructor(ptrCopy, ptrOriginal);
+			}
+			else {
+				mtype->constructor(ptrCopy);
+			}
+		}
+	}
+
+	inline EntityID duplicate_entity_into_archetype(Archetype* arch, EntityID id) {
+		EntityID newID = create_entity_with_archetype(arch, false);
+
+		copy_entity_data_across_archetypes(arch, newID, id);
+
+		return newID;
+	}
+
+	//bulk version of destroy_entity. entities are erased grouped by chunk, back to front,
+	//so entities destroyed at the tail of a chunk are popped instead of swapped in.
+	inline void destroy_entities(IECSWorld* world, const EntityID* ids, size_t count) {
+		std::vector<EntityID> sorted{ ids, ids + count };
+		std::sort(sorted.begin(), sorted.end(), [world](EntityID a, EntityID b) {
+			EnityToChunk const& lhs = world->entities[a.index];
+			EnityToChunk const& rhs = world->entities[b.index];
+			if (lhs.chunk != rhs.chunk)
+				return std::less<DataChunk*>{}(lhs.chunk, rhs.chunk);
+			return lhs.chunkIndex > rhs.chunkIndex;
+			});
+
+		for (EntityID id : sorted) {
+			destroy_entity(world, id);
+		}
+	}
+
 
 	inline Archetype* get_entity_archetype(IECSWorld* world, EntityID id)
 	{
@@ -693,6 +824,45 @@ namespace Ecs::internal
 		return world->entities[id.index].chunk->header.archetype;
 	}
 
+	//moves the entity straight into the archetype holding all the given components,
+	//returns the number of components that were not already on the entity
+	inline size_t add_components_to_entity(IECSWorld* world, EntityID id, const ComponentInfo* const* types, size_t count) {
+		const ComponentInfo* temporalComponentInfoArray[MAX_COMPONENTS];
+
+		Archetype* oldarch = get_entity_archetype(world, id);
+		ComponentCombination* oldlist = oldarch->componentList;
+		size_t length = oldlist->components.size();
+		for (size_t i = 0; i < length; i++) {
+			temporalComponentInfoArray[i] = oldlist->components[i].type;
+		}
+
+		size_t added = 0;
+		for (size_t i = 0; i < count; i++) {
+			bool typeFound = false;
+			//the pointers for metatypes are always fully stable
+			for (size_t j = 0; j < length; j++) {
+				if (temporalComponentInfoArray[j] == types[i]) {
+					typeFound = true;
+					break;
+				}
+			}
+			if (typeFound == false) {
+				assert(length < MAX_COMPONENTS);
+				temporalComponentInfoArray[length++] = types[i];
+				added++;
+			}
+		}
+
+		if (added == 0)
+			return 0;
+
+		sort_ComponentInfos(temporalComponentInfoArray, length);
+		Archetype* newArch = find_or_create_archetype(world, temporalComponentInfoArray, length);
+
+		set_entity_archetype(newArch, id);
+		return added;
+	}
+
 
 	template<typename C>
 	bool has_component(IECSWorld* world, EntityID id);
@@ -706,152 +876,136 @@ namespace Ecs::internal
 	template<typename C>
 	void remove_component_from_entity(IECSWorld* world, EntityID id);
 
-	template<typename F>
-	void iterate_matching_archetypes(IECSWorld* world, const IQuery& query, F&& function) {
-
-		for (int i = 0; i < world->archetypeSignatures.size(); i++)
-		{
-			//if there is a good match, doing an and not be 0
-			uint64_t includeTest = world->archetypeSignatures[i] & query.require_matcher;
+	inline bool archetype_matches_query(Archetype* arch, size_t signature, const IQuery& query) {
 
-			//implement later
-			uint64_t excludeTest = world->archetypeSignatures[i] & query.exclude_matcher;
+		//if there is a good match, doing an and not be 0
+		uint64_t includeTest = signature & query.require_matcher;
 
+		uint64_t excludeTest = signature & query.exclude_matcher;
 
-			if (includeTest != 0) {
+		if (includeTest == 0) 
+			return false;
 
-				auto componentList = world->archetypes[i]->componentList;
+		auto componentList = arch->componentList;
 
-				//might match an excluded component, check here
-				if (excludeTest != 0) {
+		//might match an excluded component, check here
+		if (excludeTest != 0) {
 
-					bool invalid = false;
-					//dumb algo, optimize later					
-					for (int mtA = 0; mtA < query.exclude_comps.size(); mtA++) {
+			for (int mtA = 0; mtA < query.exclude_comps.size(); mtA++) {
 
-						for (auto cmp : componentList->components) {
+				for (auto cmp : componentList->components) {
 
-							if (cmp.type->hash == query.exclude_comps[mtA]) {
-								//any check and we out
-								invalid = true;
-								break;
-							}
-						}
-						if (invalid) {
-							break;
-						}
-					}
-					if (invalid) {
-						continue;
+					if (cmp.type->hash == query.exclude_comps[mtA]) {
+						//any check and we out
+						return false;
 					}
 				}
+			}
+		}
 
-				//dumb algo, optimize later
-				int matches = 0;
-				for (int mtA = 0; mtA < query.require_comps.size(); mtA++) {
-
-					for (auto cmp : componentList->components) {
+		int matches = 0;
+		for (int mtA = 0; mtA < query.require_comps.size(); mtA++) {
 
-						if (cmp.type->hash == query.require_comps[mtA]) {
-							matches++;
-							break;
-						}
-					}
-				}
-				//all perfect
-				if (matches == query.require_comps.size()) {
+			for (auto cmp : componentList->components) {
 
-					function(world->archetypes[i]);
+				if (cmp.type->hash == query.require_comps[mtA]) {
+					matches++;
+					break;
 				}
 			}
-
 		}
+		//all perfect
+		return matches == query.require_comps.size();
 	}
 
-	template<typename F>
-	void parallel_iterate_matching_archetypes(IECSWorld* world, const IQuery& query, F&& function) {
+	//returns all archetypes in the world matching the query.
+	//only archetypes created since the last call are tested, the rest comes from the query's cache.
+	//main thread only, parallel_for_each calls this before it hands out any work
+	inline const std::vector<Archetype*>& get_matching_archetypes(IECSWorld* world, const IQuery& query) {
 
+		//a world went away since the last lookup, its cache would only pile up
+		if (query.pruned_worlds != destroyed_worlds) {
+			std::erase_if(query.match_caches, [](IQuery::MatchCache const& c) {
+				return std::binary_search(live_worlds.begin(), live_worlds.end(), c.world_id) == false;
+				});
+			query.pruned_worlds = destroyed_worlds;
+		}
 
-		std::vector<int> archetypesToIterateIndex{};
+		IQuery::MatchCache* cache = nullptr;
+		for (auto& c : query.match_caches) {
+			if (c.world_id == world->world_id) {
+				cache = &c;
+				break;
+			}
+		}
+		if (cache == nullptr) {
+			cache = &query.match_caches.emplace_back();
+			cache->world_id = world->world_id;
+		}
 
-		for (int i = 0; i < world->archetypeSignatures.size(); i++)
+		for (size_t i = cache->scanned_archetypes; i < world->archetypeSignatures.size(); i++)
 		{
-			//if there is a good match, doing an and not be 0
-			uint64_t includeTest = world->archetypeSignatures[i] & query.require_matcher;
-
-			//implement later
-			uint64_t excludeTest = world->archetypeSignatures[i] & query.exclude_matcher;
-
-
-			if (includeTest != 0) {
-
-				auto componentList = world->archetypes[i]->componentList;
-
-				//might match an excluded component, check here
-				if (excludeTest != 0) {
+			if (archetype_matches_query(world->archetypes[i], world->archetypeSignatures[i], query)) {
+				cache->archetypes.emplace_back(world->archetypes[i]);
+			}
+		}
+		cache->scanned_archetypes = world->archetypeSignatures.size();
 
-					bool invalid = false;
-					//dumb algo, optimize later					
-					for (int mtA = 0; mtA < query.exclude_comps.size(); mtA++) {
+		return cache->archetypes;
+	}
 
-						for (auto cmp : componentList->components) {
+	template<typename F>
+	void iterate_matching_archetypes(IECSWorld* world, const IQuery& query, F&& function) {
 
-							if (cmp.type->hash == query.exclude_comps[mtA]) {
-								//any check and we out
-								invalid = true;
-								break;
-							}
-						}
-						if (invalid) {
-							break;
-						}
-					}
-					if (invalid) {
-						continue;
-					}
-				}
+		//by index and fetched again every step, the function may create archetypes or run lookups of its own,
+		//either of which can grow the cached list or move the cache itself. archetypes created meanwhile are visited too
+		for (size_t i = 0; ; i++)
+		{
+			const std::vector<Archetype*>& archetypes = get_matching_archetypes(world, query);
+			if (i >= archetypes.size())
+				break;
+			function(archetypes[i]);
+		}
+	}
 
-				//dumb algo, optimize later
-				int matches = 0;
-				for (int mtA = 0; mtA < query.require_comps.size(); mtA++) {
+	//a contiguous range of entities inside a single chunk
+	struct ChunkRange {
+		DataChunk* chunk;
+		int16_t begin;
+		int16_t end;
+	};
 
-					for (auto cmp : componentList->components) {
+	//splits the chunks of the archetypes into batches of at least min_batch entities.
+	//big chunks are cut into several ranges while small chunks are grouped together,
+	//so work is balanced by entity count rather than archetype count.
+	//batch i covers ranges [batch_starts[i], batch_starts[i + 1])
+	inline void build_parallel_batches(const std::vector<Archetype*>& archetypes, size_t min_batch,
+		std::vector<ChunkRange>& ranges, std::vector<size_t>& batch_starts)
+	{
+		size_t batch_size = 0;
+		for (Archetype* arch : archetypes)
+		{
+			for (DataChunk* chunk : arch->chunks)
+			{
+				int16_t const last = chunk->header.last;
+				int16_t begin = 0;
+				while (begin < last)
+				{
+					if (batch_size == 0)
+						batch_starts.emplace_back(ranges.size());
 
-						if (cmp.type->hash == query.require_comps[mtA]) {
-							matches++;
-							break;
-						}
-					}
-				}
-				//all perfect
-				if (matches == query.require_comps.size()) {
+					int16_t const take = static_cast<int16_t>(std::min<size_t>(last - begin, min_batch - batch_size));
+					ranges.emplace_back(ChunkRange{ chunk, begin, static_cast<int16_t>(begin + take) });
 
-					//function(world->archetypes[i]);
-					archetypesToIterateIndex.emplace_back(i);
+					begin += take;
+					batch_size += take;
+					if (batch_size >= min_batch)
+						batch_size = 0;
 				}
 			}
-
 		}
-
-		/*for (auto index : archetypesToIterateIndex)
-		{
-			function(world->archetypes[index]);
-		}*/
-
-		TRACY_PROFILE_SCOPE_NC(ecs_parallel_for, tracy::Color::AliceBlue);
-
-		//parallelize here
-		//iterate all matched archetypes
-		std::for_each(std::execution::par_unseq, std::begin(archetypesToIterateIndex), std::end(archetypesToIterateIndex), [&](auto const& idx)
-			//for (auto idx : archetypesToIterateIndex)
-			{
-				TRACY_PROFILE_SCOPE_NC(singular_piece_of_parallel_work, tracy::Color::Beige);
-				function(world->archetypes[idx]);
-				TRACY_PROFILE_SCOPE_END();
-			}
-		);
-
-		TRACY_PROFILE_SCOPE_END();
+		//sentinel so the last batch has an end
+		batch_starts.emplace_back(ranges.size());
 	}
 
 
@@ -1015,18 +1169,17 @@ namespace Ecs::internal
 	}
 
 	template<typename... Args, typename Func>
-	void parallel_entity_chunk_iterate(DataChunk* chnk, Func&& function) {
+	void entity_chunk_range_iterate(ChunkRange const& range, Func&& function) {
+		DataChunk* chnk = range.chunk;
 		auto tup = std::make_tuple(get_chunk_array<Args>(chnk)...);
 #ifndef NDEBUG
 		//function arguements are incorrect, check if you are using ComponentType&
 		(assert(std::get<decltype(get_chunk_array<Args>(chnk))>(tup).chunkOwner == chnk), ...);
 #endif
 			
-		for (int i = chnk->header.last - 1; i >= 0; i--) {
+		for (int i = range.end - 1; i >= range.begin; i--) {
 			function(std::get<decltype(get_chunk_array<Args>(chnk))>(tup)[i]...);
 		}
-
-
 	}
 
 	
@@ -1063,9 +1216,9 @@ namespace Ecs::internal
 	}
 
 	template<typename ...Args, typename Func>
-	void parallel_unpack_chunk(type_list<Args...> types, DataChunk* chunk, Func&& function) {
+	void unpack_chunk_range(type_list<Args...> types, ChunkRange const& range, Func&& function) {
 		(void)types;
-		parallel_entity_chunk_iterate<Args...>(chunk, function);
+		entity_chunk_range_iterate<Args...>(range, function);
 	}
 
 	template<typename Func>
@@ -1163,14 +1316,15 @@ namespace Ecs::internal
 		EntityID* eidptr = ((EntityID*)chunk);
 		eidptr[index] = EntityID{};
 
-		//if chunk empty, free up this chunk
-		if (chunk->header.last == 0) {
-			delete_chunk_from_archetype(chunk);
-		}
 		//if chunk used to be full, its not anymore so tell the archetype
-		else if (bWasFull) {
+		if (bWasFull) {
 			set_chunk_partial(chunk);
 		}
+		//if chunk empty, free up this chunk.
+		//the last chunk is kept so spawning after a full despawn doesn't reallocate
+		if (chunk->header.last == 0 && chunk->header.archetype->chunks.size() > 1) {
+			delete_chunk_from_archetype(chunk);
+		}
 		//if we shifted last index's component to deleted component's slot
 		if (bPop) {
 			//last index's component's entity's chunk index is set to the deleted one's index
@@ -1240,6 +1394,63 @@ namespace Ecs::internal
 		type->broadcast_RemoveComponentEvent(*world, eid);
 	}
 
+	//used by the bulk operations to skip broadcasting events nobody listens to
+	inline bool has_add_component_subscribers(IECSWorld* world, size_t const hash)
+	{
+		auto iter = world->onAddComponent_Callbacks.find(hash);
+		return iter != world->onAddComponent_Callbacks.end() && iter->second.HasSubscribers();
+	}
+
+	inline bool has_remove_component_subscribers(IECSWorld* world, size_t const hash)
+	{
+		auto iter = world->onRemoveComponent_Callbacks.find(hash);
+		return iter != world->onRemoveComponent_Callbacks.end() && iter->second.HasSubscribers();
+	}
+
+	//same events as new_entity for every id, in the same order per entity
+	inline void broadcast_new_entities(IECSWorld* world, std::vector<const ComponentInfo*> const& types, const EntityID* ids, size_t count)
+	{
+		std::vector<const ComponentInfo*> listened;
+		for (auto& type : types) {
+			if (has_add_component_subscribers(world, type->hash.name_hash))
+				listened.push_back(type);
+		}
+		bool const entityListened = world->onAddEntity_callbacks.HasSubscribers();
+		if (listened.empty() && entityListened == false)
+			return;
+
+		for (size_t i = 0; i < count; ++i) {
+			for (auto& type : listened)
+				type->broadcast_AddComponentEvent(*world, ids[i]);
+			if (entityListened)
+				broadcast_add_entity_callback(world, ids[i]);
+		}
+	}
+
+	//same events as destroy for every id, all broadcast before anything is erased
+	inline void broadcast_destroy_entities(IECSWorld* world, const EntityID* ids, size_t count)
+	{
+		bool const entityListened = world->onDestroyEntity_callbacks.HasSubscribers();
+		Archetype* lastArch = nullptr;
+		std::vector<size_t> listened;
+		for (size_t i = 0; i < count; ++i) {
+			Archetype* arch = world->entities[ids[i].index].chunk->header.archetype;
+			//entities from the same batch usually share the archetype
+			if (arch != lastArch) {
+				lastArch = arch;
+				listened.clear();
+				for (auto& compIdentifier : arch->componentList->components) {
+					if (has_remove_component_subscribers(world, compIdentifier.hash.name_hash))
+						listened.push_back(compIdentifier.hash.name_hash);
+				}
+			}
+			for (auto hash : listened)
+				broadcast_remove_component_callback(world, ids[i], hash);
+			if (entityListened)
+				broadcast_destroy_entity_callback(world, ids[i]);
+		}
+	}
+
 	template<typename C>
 	inline void subscribe_on_add_component(IECSWorld* world, IECSWorld::CompEventFnPtr<C> function)
 	{
@@ -1294,6 +1505,11 @@ namespace Ecs
 {
 	inline IECSWorld::IECSWorld()
 	{
+		static std::atomic<uint32_t> world_counter{ 0 };
+		world_id = ++world_counter;
+		//ids only grow, so this stays sorted
+		internal::live_worlds.emplace_back(world_id);
+
 		Archetype* nullArch = new Archetype();
 
 		nullArch->full_chunks = 0;
@@ -1339,29 +1555,6 @@ namespace Ecs
 		internal::destroy_entity(this, eid);
 	}
 
-	//template<typename Func>
-	//inline void IECSWorld::parallel_for_each(IQuery& query, Func&& function)
-	//{
-	//	TRACY_PROFILE_SCOPE_NC(ecs_parallel_for_each, tracy::Color::OrangeRed2);
-
-	//	using params = decltype(internal::args(&Func::operator()));
-
-
-	//	internal::parallel_iterate_matching_archetypes(this, query, [&](Archetype* arch) {
-	//		//jobsystem::job iterate;
-
-	//		for (auto chnk : arch->chunks) {
-	//			internal::unpack_chunk(params{}, chnk, function);
-	//			//jobsystem::submit_and_launch(iterate, [&]() {internal::unpack_chunk(params{}, chnk, function); });
-	//		}
-
-	//		//jobsystem::wait(iterate);
-	//	});
-
-	//	
-	//	TRACY_PROFILE_SCOPE_END();
-	//}
-
 	template<typename Func>
 	inline void IECSWorld::for_each(IQuery& query, Func&& function)
 	{
@@ -1383,22 +1576,55 @@ namespace Ecs
 	template<typename Func>
 	void IECSWorld::parallel_for_each(IQuery& query, Func&& function)
 	{
-		TRACY_PROFILE_SCOPE_NC(ecs_for_each, tracy::Color::OrangeRed1);
+		parallel_for_each(query, parallel_min_batch, std::forward<Func>(function));
+	}
+
+	template<typename Func>
+	void IECSWorld::parallel_for_each(IQuery& query, size_t min_batch, Func&& function)
+	{
+		TRACY_PROFILE_SCOPE_NC(ecs_parallel_for_each, tracy::Color::OrangeRed1);
 
 		using params = decltype(internal::args(&Func::operator()));
 
-		internal::parallel_iterate_matching_archetypes(this, query, [&](Archetype* arch) 
+		std::vector<internal::ChunkRange> ranges;
+		std::vector<size_t> batch_starts;
+		internal::build_parallel_batches(internal::get_matching_archetypes(this, query), std::max<size_t>(min_batch, 1), ranges, batch_starts);
+
+		size_t const batch_count = batch_starts.size() - 1;
+
+		auto run_batch = [&](size_t batch)
+		{
+			TRACY_PROFILE_SCOPE_NC(singular_piece_of_parallel_work, tracy::Color::Beige);
+			//commands recorded by this batch play back in batch order, whichever thread runs it
+			uint32_t const outer_ordinal = internal::command_ordinal;
+			internal::command_ordinal = static_cast<uint32_t>(batch + 1);
+			for (size_t r = batch_starts[batch]; r < batch_starts[batch + 1]; ++r)
+			{
+				internal::unpack_chunk_range(params{}, ranges[r], function);
+			}
+			internal::command_ordinal = outer_ordinal;
+			TRACY_PROFILE_SCOPE_END();
+		};
+		using RunBatch = decltype(run_batch);
+
+		if (batch_count == 1)
+		{
+			run_batch(0);
+		}
+		else if (parallel_dispatcher != nullptr)
 		{
-			//for (auto chnk : arch->chunks) {
-			TRACY_PROFILE_SCOPE_NC(ecs_parallel_for_per_chunk, tracy::Color::AliceBlue);
-			std::for_each(std::execution::par_unseq, std::begin(arch->chunks), std::end(arch->chunks), [&](auto&& chnk)
+			parallel_dispatcher(batch_count, &run_batch, [](void* context, size_t batch)
 				{
-					TRACY_PROFILE_SCOPE_NC(singular_piece_of_parallel_work, tracy::Color::Beige);
-					internal::parallel_unpack_chunk(params{}, chnk, function);
-					TRACY_PROFILE_SCOPE_END();
+					(*static_cast<RunBatch*>(context))(batch);
 				});
-			TRACY_PROFILE_SCOPE_END();
-		});
+		}
+		else
+		{
+			std::for_each(std::execution::par_unseq, batch_starts.begin(), batch_starts.end() - 1, [&](size_t const& start)
+				{
+					run_batch(static_cast<size_t>(&start - batch_starts.data()));
+				});
+		}
 
 		TRACY_PROFILE_SCOPE_END();
 	}
@@ -1560,7 +1786,65 @@ namespace Ecs
 		return entity;
 	}
 
-	
+	template<typename ...Comps>
+	inline void IECSWorld::new_entities(size_t count, std::vector<EntityID>& out)
+	{
+		Archetype* arch = nullptr;
+		//empty component list will use the hardcoded null archetype
+		static std::vector< const ComponentInfo*> types = { internal::get_ComponentInfo<Comps>()... };
+		if constexpr (sizeof...(Comps) != 0) {
+			constexpr size_t num = sizeof...(Comps);
+
+			internal::sort_ComponentInfos(&types.front(), num);
+			arch = internal::find_or_create_archetype(this, &types.front(), num);
+		}
+		else {
+			arch = get_empty_archetype();
+		}
+
+		size_t first = out.size();
+		out.resize(first + count);
+		internal::create_entities_with_archetype(arch, count, out.data() + first);
+
+		internal::broadcast_new_entities(this, types, out.data() + first, count);
+	}
+
+	template<typename C>
+	inline void EntityCommandBuffer::add_component(uint64_t sort_key, EntityID id, C component)
+	{
+		enqueue(sort_key, [id, component = std::move(component)](IECSWorld& world) mutable
+			{
+				if (internal::is_entity_valid(&world, id))
+					world.add_component<C>(id, component);
+			});
+	}
+
+	template<typename C>
+	inline void EntityCommandBuffer::remove_component(uint64_t sort_key, EntityID id)
+	{
+		enqueue(sort_key, [id](IECSWorld& world)
+			{
+				if (internal::is_entity_valid(&world, id) && world.has_component<C>(id))
+					world.remove_component<C>(id);
+			});
+	}
+
+	template<typename ...Comps>
+	inline void EntityCommandBuffer::create(uint64_t sort_key, CreatedFn on_created)
+	{
+		static std::vector<uint64_t> const hashes = { internal::get_ComponentInfo<Comps>()->hash.name_hash... };
+
+		enqueue(sort_key, [on_created = std::move(on_created)](IECSWorld& world)
+			{
+				//the owner of the world creates it, so its own bookkeeping knows about the entity
+				EntityID entity = world.command_buffers.create_entity(world);
+				//components the owner did not already add go on with one archetype move
+				if constexpr (sizeof...(Comps) != 0)
+					world.add_components(entity, hashes);
+				if (on_created)
+					on_created(world, entity);
+			});
+	}
 
 	template<typename S>
 	inline S* IECSWorld::Add_System()
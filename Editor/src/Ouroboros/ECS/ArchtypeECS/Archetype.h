@@ -24,8 +24,10 @@ namespace Ecs
 		struct IECSWorld* ownerWorld{ nullptr };
 		size_t componentHash{0ul}; //archetype signature computed from all the components
 		int full_chunks{0};
-		//full chunks allways on the start of the array
+		//chunks are swap-removed, each chunk stores its own index in DataChunkHeader::archetypeIndex
 		std::vector<DataChunk*> chunks{};
+		//intrusive list of chunks with free slots, linked through DataChunkHeader::prev/next
+		DataChunk* partial_chunks{ nullptr };
 		EventCallback addition_callbacks;
 		EventCallback deletion_callbacks;
 	};
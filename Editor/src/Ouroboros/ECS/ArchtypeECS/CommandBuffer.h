@@ -0,0 +1,109 @@
+/************************************************************************************//*!
+\file           CommandBuffer.h
+\project        ECS
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief
+Records structural changes (create, destroy, add and remove component) so they can
+be made from worker threads and applied later on the main thread.
+Each recording thread gets its own buffer, so recording never takes a lock.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#pragma once
+#include "EcsUtils.h"
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Ecs
+{
+	namespace internal
+	{
+		class CommandBufferSet;
+
+		//1 + the parallel_for_each batch the calling thread is running, 0 outside of one.
+		//batches are fixed by the query, so this is the same every run whichever thread takes them
+		inline thread_local uint32_t command_ordinal{ 0 };
+	}
+
+	//commands are applied ordered by sort key, then by the parallel_for_each batch they were
+	//recorded from, then by the thread that recorded them, then by the order they were recorded in.
+	//use something stable such as the entity's index as the key when recording from
+	//parallel_for_each, so the playback order doesn't depend on which thread ran what.
+	class EntityCommandBuffer
+	{
+	public:
+		using Command = std::function<void(IECSWorld&)>;
+		using CreatedFn = std::function<void(IECSWorld&, EntityID)>;
+
+		template<typename C>
+		void add_component(uint64_t sort_key, EntityID id, C component = C{});
+		template<typename C>
+		void remove_component(uint64_t sort_key, EntityID id);
+
+		//create and destroy go through the world's structure hooks, see IECSWorld::set_command_structure.
+		//on_created runs during playback with the new entity
+		template<typename ... Comps>
+		void create(uint64_t sort_key, CreatedFn on_created = {});
+		void destroy(uint64_t sort_key, EntityID id);
+
+		//any other work that has to happen on the main thread at playback
+		void enqueue(uint64_t sort_key, Command command);
+
+		bool empty() const { return records.empty(); }
+		size_t size() const { return records.size(); }
+
+	private:
+		friend class internal::CommandBufferSet;
+
+		struct Record
+		{
+			uint64_t sort_key;
+			uint32_t ordinal;
+			uint32_t thread;
+			uint32_t sequence;
+			Command command;
+		};
+		std::vector<Record> records{};
+		//order this buffer's thread first recorded into the world
+		uint32_t thread{ 0 };
+	};
+
+	namespace internal
+	{
+		//owns one command buffer per thread that recorded into a world
+		class CommandBufferSet
+		{
+		public:
+			using CreateFn = std::function<EntityID(IECSWorld&)>;
+			using DestroyFn = std::function<void(IECSWorld&, EntityID)>;
+
+			EntityCommandBuffer& local(uint32_t world_id);
+			//runs every recorded command, commands recorded while playing back wait for the next playback
+			void playback(IECSWorld& world);
+
+			void set_structure(CreateFn create, DestroyFn destroy);
+			//used by recorded creates and destroys, falls back to the world itself when no owner is set
+			EntityID create_entity(IECSWorld& world);
+			void destroy_entity(IECSWorld& world, EntityID id);
+
+		private:
+			std::mutex lock{};
+			std::unordered_map<std::thread::id, EntityCommandBuffer*> thread_buffers{};
+			//in the order their threads first recorded, so playback never depends on hash order
+			std::vector<std::unique_ptr<EntityCommandBuffer>> buffers{};
+			std::vector<EntityCommandBuffer::Record> pending{};
+			CreateFn create_fn{};
+			DestroyFn destroy_fn{};
+		};
+	}
+}
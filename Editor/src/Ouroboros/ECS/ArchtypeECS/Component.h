@@ -162,8 +162,9 @@ namespace Ecs
 	struct DataChunkHeader {
 		struct ComponentCombination* componentList{nullptr}; //pointer to the signature for this block
 		struct Archetype* archetype{ nullptr };	//what archtype this data chunk contains
-		struct DataChunk* prev{ nullptr };
-		struct DataChunk* next{ nullptr };
+		struct DataChunk* prev{ nullptr };	//previous chunk in the archetype's partial list
+		struct DataChunk* next{ nullptr };	//next chunk in the archetype's partial list
+		uint32_t archetypeIndex{ 0 };		//index of this chunk in Archetype::chunks
 		int16_t last{ 0 }; //one after the last entity added
 	};
 	// header | entityID | component 1 data | component 2 data |...
@@ -25,6 +25,9 @@ namespace Ecs
 	
 	constexpr size_t MAX_COMPONENTS = 32ull;
 
+	//default minimum number of entities handed to a single parallel task
+	constexpr size_t DEFAULT_PARALLEL_BATCH = 64ull;
+
 	using byte = unsigned char;
 
 	struct TypeHash;		
@@ -42,6 +45,10 @@ namespace Ecs
 
 	using GetCompFn = void*(IECSWorld& world, EntityID id);
 
+	//runs work(context, i) for every i in [0, count) in parallel, returning when all are done
+	using ParallelWorkFn = void(void* context, size_t index);
+	using ParallelDispatchFn = void(size_t count, void* context, ParallelWorkFn* work);
+
 	inline constexpr uint64_t hash_64_fnv1a(const char* key, const uint64_t len) {
 
 		uint64_t hash = 14695981039346656037ull;
@@ -67,6 +67,19 @@ namespace Ecs
                 functions->Execute(event);
         }
         /*********************************************************************************//*!
+        \brief Checks if any callback is registered, lets bulk operations skip
+               building events nobody listens to
+        *//**********************************************************************************/
+        bool HasSubscribers() const
+        {
+            for (auto& [type, function_container] : m_subscribers)
+            {
+                if (function_container.empty() == false)
+                    return true;
+            }
+            return false;
+        }
+        /*********************************************************************************//*!
         \brief Registers a member function as a callback
         \param instance instance to object on which to invoke the member function on
         \param memberFunction pointer to member function
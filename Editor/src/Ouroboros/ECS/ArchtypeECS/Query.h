@@ -22,7 +22,23 @@ Technology is prohibited.
 #include <algorithm>
 namespace Ecs
 {
+	namespace internal
+	{
+		//ids of the worlds alive right now in creation order, and how many worlds have been destroyed.
+		//worlds are only created and destroyed on the main thread
+		inline std::vector<uint32_t> live_worlds{};
+		inline uint32_t destroyed_worlds{ 0 };
+	}
+
 	struct IQuery {
+		//archetypes of a single world already known to match this query.
+		//archetypes are never destroyed, so only newly created ones need to be tested
+		struct MatchCache {
+			uint32_t world_id{ 0 };
+			size_t scanned_archetypes{ 0 }; //number of world archetypes already tested
+			std::vector<Archetype*> archetypes{};
+		};
+
 		std::vector<TypeHash> require_comps;
 		std::vector<TypeHash> exclude_comps;
 
@@ -30,6 +46,12 @@ namespace Ecs
 		size_t require_matcher{ 0 };
 		size_t exclude_matcher{ 0 };
 
+		//queries are usually static and shared between scenes, so keep one cache per world.
+		//caches of destroyed worlds are dropped on the next lookup, so this stays as short as the
+		//number of live worlds. filled lazily from const queries, so main thread only
+		mutable std::vector<MatchCache> match_caches{};
+		//internal::destroyed_worlds when match_caches was last pruned
+		mutable uint32_t pruned_worlds{ 0 };
 
 		bool built{ false };
 
@@ -73,6 +95,8 @@ namespace Ecs
 
 			require_matcher = build_matcher(require_comps);
 			exclude_matcher = build_matcher(exclude_comps);
+			//filters changed, previously matched archetypes are no longer valid
+			match_caches.clear();
 			built = true;
 			return *this;
 		}
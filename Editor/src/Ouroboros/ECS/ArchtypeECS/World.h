@@ -17,6 +17,7 @@ Technology is prohibited.
 #include "EcsUtils.h"
 #include "Archetype.h"
 #include "System.h"
+#include "CommandBuffer.h"
 
 #include <vector>
 #include <unordered_map>
@@ -34,6 +35,9 @@ namespace Ecs
 		template<typename T>
 		using MemberFnPtr = typename internal::EventMemberFunction<T, EntityEvent>::MemberFunctionPointer;
 
+		//unique per world instance, used to key per-world caches held by queries
+		uint32_t world_id{ 0 };
+
 		std::vector<EnityToChunk> entities;
 		std::vector<EntityID::index_type> deletedEntities;
 
@@ -52,6 +56,9 @@ namespace Ecs
 
 		std::unordered_map<size_t, internal::LoadedSystem> system_map{};
 
+		//minimum entities per task used by parallel_for_each when none is given
+		size_t parallel_min_batch{ DEFAULT_PARALLEL_BATCH };
+
 		int live_entities{ 0 }; //tracks number of active entity IDs
 		int dead_entities{ 0 }; //tracks number of dead entity IDs
 
@@ -64,6 +71,9 @@ namespace Ecs
 		std::unordered_map<std::size_t, EventCallback> onAddComponent_Callbacks;
 		std::unordered_map<std::size_t, EventCallback> onRemoveComponent_Callbacks;
 
+		//deferred structural changes, one buffer per recording thread
+		internal::CommandBufferSet command_buffers{};
+
 		inline IECSWorld();
 		~IECSWorld();
 
@@ -77,6 +87,10 @@ namespace Ecs
 		template<typename Func>
 		void parallel_for_each(IQuery& query, Func&& function);
 
+		//splits the work into chunk ranges of at least min_batch entities
+		template<typename Func>
+		void parallel_for_each(IQuery& query, size_t min_batch, Func&& function);
+
 		template<typename Func>
 		void for_each_entity(IQuery& query, Func&& function);
 
@@ -115,6 +129,8 @@ namespace Ecs
 
 
 		size_t get_num_components(EntityID id);
+		//true if the entity is alive and would be visited by the query
+		bool matches_query(EntityID id, IQuery const& query);
 
 		template<typename C>
 		C* set_singleton();
@@ -129,10 +145,30 @@ namespace Ecs
 
 		EntityID new_entity(std::vector<uint64_t>const& component_hashes);
 		EntityID duplicate_entity(EntityID id);
+		//duplicate that also gains the extra components, resolving the archetype once
+		EntityID duplicate_entity(EntityID id, std::vector<uint64_t>const& extra_component_hashes);
+
+		//creates count entities with the same components, appending them to out.
+		//the archetype is resolved once and chunk slots are filled in runs
+		template<typename ... Comps>
+		inline void new_entities(size_t count, std::vector<EntityID>& out);
+		void new_entities(std::vector<uint64_t>const& component_hashes, size_t count, std::vector<EntityID>& out);
+
+		//adds every missing component with a single archetype move
+		void add_components(EntityID id, std::vector<uint64_t>const& component_hashes);
 
 		std::vector<uint64_t> const componentHashes(EntityID id);
 
 		inline void destroy(EntityID eid);
+		void destroy(std::vector<EntityID>const& eids);
+
+		//the calling thread's command buffer, safe to record into from parallel_for_each
+		EntityCommandBuffer& get_command_buffer();
+		//applies everything recorded into the command buffers. main thread only
+		void playback_commands();
+		//lets the owner of the world (the scene) create and destroy the entities recorded into the
+		//command buffers, so its lookup tables and destroy callbacks see them too
+		void set_command_structure(internal::CommandBufferSet::CreateFn create, internal::CommandBufferSet::DestroyFn destroy);
 
 		Archetype* get_empty_archetype() { return archetypes[0]; };
 
@@ -40,7 +40,8 @@ namespace Ecs
 		operator IQuery&() { return query; }
 	};
 
-
+	template<typename C>
+	struct CachedRef;
 
 	class ECSWorld : private IECSWorld
 	{
@@ -111,6 +112,13 @@ namespace Ecs
 		{
 			return world.get_component<C>(id);
 		}
+		//same as get_component, but skips the lookup while the entity stays in the chunk slot
+		//the cache last saw it in
+		template<typename C>
+		C& get_component(EntityID id, CachedRef<C>& cache)
+		{
+			return *cache.get_from(&world, id);
+		}
 		//gets the name hash of the component to be used for ecs functions that use
 		//component hash
 		template<typename C>
@@ -137,6 +145,9 @@ namespace Ecs
 		{
 			return world.get_num_components(id);
 		}
+		//checks if the entity is alive and would be visited by the query,
+		//for going through a list of entities instead of the entire query
+		bool matches_query(EntityID id, IQuery& query);
 
 		template<typename C>
 		C* set_singleton()
@@ -163,10 +174,25 @@ namespace Ecs
 
 		EntityID new_entity(std::vector<uint64_t>const& component_hashes);
 		EntityID duplicate_entity(EntityID id);
+		EntityID duplicate_entity(EntityID id, std::vector<uint64_t>const& extra_component_hashes);
+
+		template<typename ... Comps>
+		inline void new_entities(size_t count, std::vector<EntityID>& out)
+		{
+			world.new_entities<Comps...>(count, out);
+		}
+		void new_entities(std::vector<uint64_t>const& component_hashes, size_t count, std::vector<EntityID>& out);
+
+		void add_components(EntityID id, std::vector<uint64_t>const& component_hashes);
 
 		std::vector<uint64_t> const componentHashes(EntityID id);
 
 		void destroy(EntityID eid);
+		void destroy(std::vector<EntityID>const& eids);
+
+		EntityCommandBuffer& get_command_buffer();
+		void playback_commands();
+		void set_command_structure(internal::CommandBufferSet::CreateFn create, internal::CommandBufferSet::DestroyFn destroy);
 		
 		/*template<typename S>
 		S* Add_System()
@@ -28,6 +28,30 @@ Technology is prohibited.
 
 namespace oo
 {
+    namespace
+    {
+        template<typename... Components>
+        struct StartingComponents
+        {
+            static Ecs::EntityID Create(Ecs::ECSWorld& world)
+            {
+                return world.new_entity<Components...>();
+            }
+
+            static void Create(Ecs::ECSWorld& world, std::size_t count, std::vector<Ecs::EntityID>& out)
+            {
+                world.new_entities<Components...>(count, out);
+            }
+        };
+
+        // the debug component is part of the starting set so SetupGo never has to move the entity
+#if not defined OO_PRODUCTION
+        using GameObjectStartingComponents = StartingComponents<GameObjectComponent, TransformComponent, ScriptComponent, JustCreatedComponent, GameObjectDebugComponent>;
+#else
+        using GameObjectStartingComponents = StartingComponents<GameObjectComponent, TransformComponent, ScriptComponent, JustCreatedComponent>;
+#endif
+    }
+
     /*---------------------------------------------------------------------------------*/
     /* Static Functions                                                                */
     /*---------------------------------------------------------------------------------*/
@@ -43,26 +67,37 @@ namespace oo
     {
     }
 
+    // we ensure the object we duplicate has the just created component and
+    // mark item as duplicated. duplicated items will be ignored for the first frame to get it properly set up.
+    // both are added as part of the duplication so the copy is only placed once.
     GameObject::GameObject(Scene& scene, GameObject& target)
         : m_scene{ &scene }
-        , m_entity{ scene.GetWorld().duplicate_entity(target.m_entity) }
+        , m_entity{ scene.GetWorld().duplicate_entity(target.m_entity,
+            { Ecs::ECSWorld::get_component_hash<oo::JustCreatedComponent>(), Ecs::ECSWorld::get_component_hash<oo::DuplicatedComponent>() }) }
     {
         oo::UUID new_uuid {};
-        // we ensure the object we duplicate has the just created component
-        if (m_scene->GetWorld().has_component<oo::JustCreatedComponent>(m_entity) == false)
-            m_scene->GetWorld().add_component<oo::JustCreatedComponent>(m_entity);
         SetupGo(new_uuid, m_entity);
-        // mark item as duplicated. duplicated items will be ignored for the first frame to get it properly set up
-        m_scene->GetWorld().add_component<oo::DuplicatedComponent>(m_entity);
     }
 
     GameObject::GameObject(oo::UUID uuid, Scene& scene)
         : m_scene { &scene }
-        , m_entity{ scene.GetWorld().new_entity<GameObjectComponent, TransformComponent, ScriptComponent, JustCreatedComponent>() }
+        , m_entity{ GameObjectStartingComponents::Create(scene.GetWorld()) }
+    {
+        SetupGo(uuid, m_entity);
+    }
+
+    GameObject::GameObject(oo::UUID uuid, Entity entt, Scene& scene)
+        : m_scene{ &scene }
+        , m_entity{ entt }
     {
         SetupGo(uuid, m_entity);
     }
 
+    void GameObject::CreateEntities(Scene& scene, std::size_t count, std::vector<Entity>& out)
+    {
+        GameObjectStartingComponents::Create(scene.GetWorld(), count, out);
+    }
+
     //Conversion from entt to gameobject
     GameObject::GameObject(Entity entt, Scene& scene)
         : m_scene{ &scene }
@@ -87,7 +122,8 @@ namespace oo
         if (parentNode && childNode && parentNode->add_child(childNode))
         {
             // notify child node that its parent has changed.
-            child_tf.GlobalMatrixDirty = true;
+            child_tf.MarkGlobalDirty();
+            m_scene->MarkHierarchyChanged(child);
 
             if (preserveTransforms)
             {
@@ -147,7 +183,7 @@ namespace oo
     {
         oo::UUID parent_uuid = GetParentUUID();
         ASSERT_MSG(parent_uuid == scenenode::NOTFOUND, "this should never happen except for the root node");
-        return *m_scene->FindWithInstanceID(parent_uuid);
+        return *m_scene->FindRawWithInstanceID(parent_uuid);
     }
 
     std::vector<GameObject> GameObject::GetDirectChilds(bool includeItself) const
@@ -155,7 +191,7 @@ namespace oo
         std::vector<GameObject> gos;
         
         for (auto& go : GetDirectChildsUUID(includeItself))
-            gos.emplace_back(*m_scene->FindWithInstanceID(go));
+            gos.emplace_back(*m_scene->FindRawWithInstanceID(go));
         
         return gos;
     }
@@ -165,7 +201,7 @@ namespace oo
         std::vector<GameObject> gos;
 
         for (auto& go : GetChildrenUUID(includeItself))
-            gos.emplace_back(*m_scene->FindWithInstanceID(go));
+            gos.emplace_back(*m_scene->FindRawWithInstanceID(go));
 
         return gos;
     }
@@ -299,6 +335,13 @@ namespace oo
         GetComponent<GameObjectComponent>().IsPrefab = isprefab;
     }
 
+    void GameObject::EnsureComponents(std::vector<std::uint64_t> const& component_hashes) const
+    {
+        ASSERT_MSG(m_scene == nullptr, " scene shouldn't be null! Likely created gameobject wrongly");
+        ASSERT_MSG(m_scene->IsValid(*this) == false, " gameobject does not belong to this scene, how did you create this gameobject??");
+        m_scene->GetWorld().add_components(m_entity, component_hashes);
+    }
+
     void GameObject::SetupGo(oo::UUID uuid, Ecs::EntityID entt)
     {
         // add debugging component
@@ -97,6 +97,13 @@ namespace oo
         // Traditional Construct GameObject Based on UUID
         GameObject(UUID uuid, Scene& scene);
 
+        // Construct GameObject Based on UUID using an entity made by CreateEntities
+        GameObject(UUID uuid, Entity entt, Scene& scene);
+
+        // Creates count entities that already hold every component a new gameobject starts with,
+        // so constructing the gameobjects afterwards does not move them between archetypes.
+        static void CreateEntities(Scene& scene, std::size_t count, std::vector<Entity>& out);
+
         // Non-Traditional Copy Construct GameObject Based on Entity
         GameObject(Entity entt, Scene& scene);
 
@@ -172,6 +179,10 @@ namespace oo
         template<typename Component, typename...Args>
         Component& EnsureComponent(Args...args) const;
 
+        // Adds every listed component the gameobject doesn't have yet in a single step.
+        // Takes the ECS component hashes.
+        void EnsureComponents(std::vector<std::uint64_t> const& component_hashes) const;
+
     private:
         void SetupGo(UUID uuid, Ecs::EntityID entt);
 
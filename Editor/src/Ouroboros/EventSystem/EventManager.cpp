@@ -41,4 +41,9 @@ namespace oo
 	EventManager::~EventManager()
 	{
 	}
+	void EventManager::DispatchQueued()
+	{
+		EventManager* manager = GetInstance();
+		manager->m_eventQueue.Dispatch(manager->m_eventSystem);
+	}
 }
\ No newline at end of file
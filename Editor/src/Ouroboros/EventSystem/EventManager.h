@@ -13,6 +13,7 @@ Technology is prohibited.
 *//*************************************************************************************/
 #pragma once
 #include "Ouroboros/EventSystem/EventSystem.h"
+#include "Ouroboros/EventSystem/EventQueue.h"
 namespace oo
 {
 	class EventManager : public EventSystem
@@ -21,6 +22,7 @@ namespace oo
 		static EventManager* instance;
 
 		EventSystem m_eventSystem;
+		EventQueue m_eventQueue;
 	public:
         using FunctionContainer = EventSystem::FunctionContainer;
         using SubscriberContainer = EventSystem::SubscriberContainer;
@@ -33,6 +35,21 @@ namespace oo
             GetInstance()->m_eventSystem.Broadcast<EventType>(event);
         }
         /*********************************************************************************//*!
+        \brief Queues a copy of event to be broadcast at the next DispatchQueued.
+               Unlike Broadcast this is safe to call from any thread.
+        \param event the event to broadcast later
+        *//**********************************************************************************/
+        template<typename EventType>
+        static void Enqueue(EventType event)
+        {
+            GetInstance()->m_eventQueue.Enqueue<EventType>(std::move(event));
+        }
+        /*********************************************************************************//*!
+        \brief Broadcasts every queued event in the order they were queued.
+               Main thread only, called once a frame by the application.
+        *//**********************************************************************************/
+        static void DispatchQueued();
+        /*********************************************************************************//*!
         \brief Registers a member function as a callback
         \param instance instance to object on which to invoke the member function on
         \param memberFunction pointer to member function
@@ -0,0 +1,193 @@
+/************************************************************************************//*!
+\file           EventQueue.cpp
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Deferred events that any thread can raise and one thread delivers.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#include "pch.h"
+#include "EventQueue.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace oo
+{
+    namespace
+    {
+        // ids are never reused, so a thread's cached ring of a destroyed queue can never be picked up again
+        std::atomic<std::uint64_t> s_nextQueueID{ 0 };
+    }
+
+    struct EventQueue::ThreadRings
+    {
+        struct Entry
+        {
+            std::uint64_t QueueID = 0;
+            Ring* Target = nullptr;
+            std::weak_ptr<Ring> Owner;  // the queue may be gone by the time the thread exits
+        };
+        std::vector<Entry> Entries;
+
+        ~ThreadRings()
+        {
+            // everything this thread wrote is published by the release, the next producer acquires it
+            for (Entry& entry : Entries)
+            {
+                if (auto ring = entry.Owner.lock())
+                    ring->Retired.store(true, std::memory_order_release);
+            }
+        }
+    };
+
+    EventQueue::EventQueue()
+        : m_id{ s_nextQueueID.fetch_add(1, std::memory_order_relaxed) }
+    {
+    }
+
+    EventQueue::~EventQueue()
+    {
+        // destroy whatever never got delivered
+        for (auto& ring : m_rings)
+        {
+            std::size_t const tail = ring->Tail.load(std::memory_order_acquire);
+            for (std::size_t head = ring->Head.load(std::memory_order_relaxed); head != tail; ++head)
+            {
+                QueuedEvent& queued = ring->Slots[head & (RingCapacity - 1)];
+                queued.Deliver(nullptr, queued.Storage);
+            }
+
+            for (QueuedEvent& queued : ring->Overflow)
+                queued.Deliver(nullptr, queued.Storage);
+        }
+    }
+
+    EventQueue::Ring& EventQueue::GetThreadRing()
+    {
+        // a thread rarely enqueues into more than one queue, so a short list beats a map
+        thread_local ThreadRings t_rings;
+
+        for (auto const& entry : t_rings.Entries)
+        {
+            if (entry.QueueID == m_id)
+                return *entry.Target;
+        }
+
+        std::shared_ptr<Ring> ring;
+        {
+            std::scoped_lock lock{ m_ringsMutex };
+
+            // take over the ring of a thread that exited, events it left behind are still delivered in order
+            // since every sequence handed out after the retire is bigger
+            auto retired = std::find_if(m_rings.begin(), m_rings.end(), [](auto const& candidate)
+            {
+                return candidate->Retired.load(std::memory_order_acquire);
+            });
+
+            if (retired != m_rings.end())
+            {
+                ring = *retired;
+                ring->Retired.store(false, std::memory_order_relaxed);
+            }
+            else
+            {
+                ring = m_rings.emplace_back(std::make_shared<Ring>());
+            }
+        }
+
+        // entries of destroyed queues are never looked up again
+        std::erase_if(t_rings.Entries, [](auto const& entry) { return entry.Owner.expired(); });
+        t_rings.Entries.push_back({ m_id, ring.get(), ring });
+        return *ring;
+    }
+
+    void EventQueue::Dispatch(EventSystem& system)
+    {
+        // a callback dispatching again would deliver events out from under the outer dispatch
+        if (m_dispatching)
+            return;
+        m_dispatching = true;
+
+        // take what every ring holds right now. the tail is read before the overflow, so any
+        // spilled event older than something in the ring is already visible
+        m_sources.clear();
+        {
+            std::scoped_lock lock{ m_ringsMutex };
+            for (auto& ring : m_rings)
+            {
+                Source source;
+                source.Owner = ring.get();
+                source.Head = ring->Head.load(std::memory_order_relaxed);
+                source.Tail = ring->Tail.load(std::memory_order_acquire);
+
+                if (ring->HasOverflow.load(std::memory_order_acquire))
+                {
+                    std::scoped_lock overflow_lock{ ring->OverflowMutex };
+                    source.Overflow.swap(ring->Overflow);
+                    ring->HasOverflow.store(false, std::memory_order_relaxed);
+                }
+
+                if (source.Head != source.Tail || source.Overflow.empty() == false)
+                    m_sources.emplace_back(std::move(source));
+            }
+        }
+
+        // every source is already in order, so repeatedly taking the oldest head delivers everything in order
+        while (true)
+        {
+            Source* oldest = nullptr;
+            bool from_overflow = false;
+            std::uint64_t oldest_sequence = std::numeric_limits<std::uint64_t>::max();
+
+            for (Source& source : m_sources)
+            {
+                if (source.Head != source.Tail)
+                {
+                    std::uint64_t const sequence = source.Owner->Slots[source.Head & (RingCapacity - 1)].Sequence;
+                    if (sequence < oldest_sequence)
+                    {
+                        oldest = &source;
+                        from_overflow = false;
+                        oldest_sequence = sequence;
+                    }
+                }
+                if (source.OverflowNext < source.Overflow.size())
+                {
+                    std::uint64_t const sequence = source.Overflow[source.OverflowNext].Sequence;
+                    if (sequence < oldest_sequence)
+                    {
+                        oldest = &source;
+                        from_overflow = true;
+                        oldest_sequence = sequence;
+                    }
+                }
+            }
+
+            if (oldest == nullptr)
+                break;
+
+            if (from_overflow)
+            {
+                QueuedEvent& queued = oldest->Overflow[oldest->OverflowNext++];
+                queued.Deliver(&system, queued.Storage);
+            }
+            else
+            {
+                QueuedEvent& queued = oldest->Owner->Slots[oldest->Head & (RingCapacity - 1)];
+                queued.Deliver(&system, queued.Storage);
+                // hand the slot back right away so callbacks enqueueing on this thread have room
+                oldest->Owner->Head.store(++oldest->Head, std::memory_order_release);
+            }
+        }
+
+        m_sources.clear();
+        m_dispatching = false;
+    }
+}
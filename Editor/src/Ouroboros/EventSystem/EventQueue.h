@@ -0,0 +1,155 @@
+/************************************************************************************//*!
+\file           EventQueue.h
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Deferred events that any thread can raise and one thread delivers.
+
+                Every thread that enqueues gets its own single producer ring buffer,
+                so enqueueing takes no locks. The ring of a thread that exits is taken
+                over by the next thread to enqueue, so short lived threads do not
+                pile up rings. Events carry a global sequence number
+                and Dispatch merges the rings by it, which delivers them in the order
+                they were queued.
+                ...
+                m_world->parallel_for_each(query, [&](Health& health)
+                {
+                    if (health.Value <= 0)
+                        queue.Enqueue(DeathEvent{ health.Owner });
+                });
+                ...
+                queue.Dispatch(eventSystem); // broadcasts every DeathEvent on this thread
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#pragma once
+#include "EventSystem.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace oo
+{
+    class EventQueue
+    {
+    public:
+        // slots per thread, a full ring spills into a locked overflow until the next dispatch
+        static constexpr std::size_t RingCapacity = 512;
+        // events are stored in place, bigger ones have to be broadcast or slimmed down
+        static constexpr std::size_t MaxEventSize = 112;
+
+        EventQueue();
+        ~EventQueue();
+        EventQueue(EventQueue const&) = delete;
+        EventQueue& operator=(EventQueue const&) = delete;
+
+        /*********************************************************************************//*!
+        \brief Queues a copy of event for the next Dispatch. Safe to call from any thread.
+        \param event the event to broadcast later
+        *//**********************************************************************************/
+        template<typename EventType>
+        void Enqueue(EventType event)
+        {
+            static_assert(std::is_base_of_v<Event, EventType>, "queued events must derive from oo::Event");
+            static_assert(sizeof(EventType) <= MaxEventSize && alignof(EventType) <= alignof(std::max_align_t),
+                "event is too big to be queued, broadcast it instead");
+
+            Ring& ring = GetThreadRing();
+            std::uint64_t const sequence = m_nextSequence.fetch_add(1, std::memory_order_relaxed);
+
+            std::size_t const tail = ring.Tail.load(std::memory_order_relaxed);
+            if (tail - ring.Head.load(std::memory_order_acquire) < RingCapacity)
+            {
+                Store(ring.Slots[tail & (RingCapacity - 1)], sequence, std::move(event));
+                ring.Tail.store(tail + 1, std::memory_order_release);
+            }
+            else
+            {
+                // nothing dispatched for a while, spill rather than make the producer wait
+                std::scoped_lock lock{ ring.OverflowMutex };
+                Store(ring.Overflow.emplace_back(), sequence, std::move(event));
+                ring.HasOverflow.store(true, std::memory_order_release);
+            }
+        }
+
+        /*********************************************************************************//*!
+        \brief Broadcasts every event queued so far through system, oldest first.
+               One thread at a time. Events queued by the callbacks wait for the next call.
+        \param system the event system whose subscribers receive the events
+        *//**********************************************************************************/
+        void Dispatch(EventSystem& system);
+
+    private:
+        struct QueuedEvent
+        {
+            std::uint64_t Sequence = 0;
+            // broadcasts the stored event when given a system, then destroys it
+            void (*Deliver)(EventSystem* system, void* storage) = nullptr;
+            alignas(std::max_align_t) std::byte Storage[MaxEventSize];
+        };
+
+        struct Ring
+        {
+            std::unique_ptr<QueuedEvent[]> Slots = std::make_unique<QueuedEvent[]>(RingCapacity);
+            alignas(64) std::atomic<std::size_t> Head{ 0 };   // next slot to deliver, written by the dispatcher
+            alignas(64) std::atomic<std::size_t> Tail{ 0 };   // next slot to fill, written by the owning thread
+
+            std::mutex OverflowMutex;
+            std::deque<QueuedEvent> Overflow;
+            std::atomic<bool> HasOverflow{ false };
+
+            // set when the owning thread exits, the next thread without a ring becomes its producer
+            std::atomic<bool> Retired{ false };
+        };
+
+        // the rings a thread produces into, retired when the thread exits
+        struct ThreadRings;
+
+        // what one dispatch takes out of a ring
+        struct Source
+        {
+            Ring* Owner = nullptr;
+            std::size_t Head = 0;
+            std::size_t Tail = 0;
+            std::deque<QueuedEvent> Overflow;
+            std::size_t OverflowNext = 0;
+        };
+
+        template<typename EventType>
+        static void Store(QueuedEvent& slot, std::uint64_t sequence, EventType&& event)
+        {
+            slot.Sequence = sequence;
+            ::new (static_cast<void*>(slot.Storage)) EventType(std::move(event));
+            slot.Deliver = [](EventSystem* system, void* storage)
+            {
+                EventType* queued = std::launder(static_cast<EventType*>(storage));
+                if (system)
+                    system->Broadcast<EventType>(queued);
+                queued->~EventType();
+            };
+        }
+
+        Ring& GetThreadRing();
+
+        std::uint64_t const m_id;
+        std::atomic<std::uint64_t> m_nextSequence{ 0 };
+
+        std::mutex m_ringsMutex;
+        std::vector<std::shared_ptr<Ring>> m_rings;
+
+        // only touched by the dispatching thread
+        std::vector<Source> m_sources;
+        bool m_dispatching = false;
+    };
+}
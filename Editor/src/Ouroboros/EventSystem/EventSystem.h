@@ -68,6 +68,10 @@
                 * are created on the stack and the *note above applies here as well.
                 * Depending on the usage, there are many ways you can use this fact to pass around information
 
+                Subscribers are found through a small index every event type gets the first
+                time it is used (GetEventTypeID), so broadcasting does not hash anything.
+                Broadcast is not thread safe, see EventQueue for raising events off the main thread.
+
 Copyright (C) 2022 DigiPen Institute of Technology.
 Reproduction or disclosure of this file or its contents
 without the prior written consent of DigiPen Institute of
@@ -78,39 +82,51 @@ Technology is prohibited.
 #include "EventFunction.h"
 #include <vector>
 #include <memory>
-#include <unordered_map>
-#include <typeindex>
+#include <deque>
+#include <atomic>
 namespace oo
 {
+    namespace internal
+    {
+        inline std::size_t NextEventTypeID()
+        {
+            static std::atomic<std::size_t> next_id{ 0 };
+            return next_id.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // dense index of an event type, handed out the first time the type is used
+    template<typename EventType>
+    std::size_t GetEventTypeID()
+    {
+        static std::size_t const id = internal::NextEventTypeID();
+        return id;
+    }
+
     class EventSystem 
     {
     public:
         using FunctionContainer = std::vector<std::unique_ptr<EventFunctionBase>>;
-        using SubscriberContainer = std::unordered_map<std::type_index, FunctionContainer>;
+        // indexed by GetEventTypeID, a deque so containers stay put while callbacks subscribe new types
+        using SubscriberContainer = std::deque<FunctionContainer>;
     protected:
         SubscriberContainer m_subscribers;
     private:
         template<typename T>
-        inline std::type_index GetTypeIndex()
-        {
-            return typeid(T);
-        }
-
-        template<typename T>
-        SubscriberContainer::mapped_type& GetFunctionContainer()
+        FunctionContainer& GetFunctionContainer()
         {
-            if (m_subscribers.find(GetTypeIndex<T>()) == m_subscribers.end())
-                m_subscribers.emplace(GetTypeIndex<T>(), SubscriberContainer::mapped_type{});
+            std::size_t const id = GetEventTypeID<T>();
+            if (id >= m_subscribers.size())
+                m_subscribers.resize(id + 1);
 
-            return m_subscribers[GetTypeIndex<T>()];
+            return m_subscribers[id];
         }
 
         template<typename T>
-        void RemoveFunctionContainer()
+        FunctionContainer* FindFunctionContainer()
         {
-            if (m_subscribers.find(GetTypeIndex<T>()) == m_subscribers.end())
-                return;
-            m_subscribers.erase(m_subscribers.find(GetTypeIndex<T>()));
+            std::size_t const id = GetEventTypeID<T>();
+            return id < m_subscribers.size() ? &m_subscribers[id] : nullptr;
         }
     public:
         EventSystem() = default;
@@ -121,11 +137,11 @@ namespace oo
         template<typename EventType>
         void Broadcast(EventType* event) 
         {
-            auto& function_container = GetFunctionContainer<EventType>();
+            auto* function_container = FindFunctionContainer<EventType>();
 
-            if (function_container.empty()) return;
+            if (function_container == nullptr || function_container->empty()) return;
 
-            for (auto& functions : function_container) 
+            for (auto& functions : *function_container) 
                 functions->Execute(event);
         }
         /*********************************************************************************//*!
@@ -136,9 +152,6 @@ namespace oo
         template<class T, class EventType>
         void Subscribe(T* instance, typename EventMemberFunction<T, EventType>::MemberFunctionPointer memberFunction)
         {
-            if (m_subscribers.find(GetTypeIndex<EventType>()) == m_subscribers.end())
-                m_subscribers.emplace(GetTypeIndex<EventType>(), SubscriberContainer::mapped_type{});
-
             auto& function_container = GetFunctionContainer<EventType>();
             function_container.emplace_back(std::make_unique<EventMemberFunction<T, EventType>>(instance, memberFunction));
         }
@@ -149,9 +162,6 @@ namespace oo
         template<class EventType>
         void Subscribe(typename EventFunction<EventType>::FunctionPointer function)
         {
-            if (m_subscribers.find(GetTypeIndex<EventType>()) == m_subscribers.end())
-                m_subscribers.emplace(GetTypeIndex<EventType>(), SubscriberContainer::mapped_type{});
-
             auto& function_container = GetFunctionContainer<EventType>();
             function_container.emplace_back(std::make_unique<EventFunction<EventType>>(function));
         }
@@ -163,10 +173,11 @@ namespace oo
         template<class T, class EventType>
         void Unsubscribe(T* instance, typename EventMemberFunction<T, EventType>::MemberFunctionPointer memberFunction)
         {
-            if (m_subscribers.find(GetTypeIndex<EventType>()) == m_subscribers.end())
+            auto* found_container = FindFunctionContainer<EventType>();
+            if (found_container == nullptr)
                 return;
 
-            auto& function_container = GetFunctionContainer<EventType>();
+            auto& function_container = *found_container;
 
             EventMemberFunction<T, EventType> callback{ instance, memberFunction };
             std::size_t index = 0;
@@ -179,10 +190,6 @@ namespace oo
                 }
                 ++index;
             }
-            if (function_container.empty())
-            {
-                RemoveFunctionContainer<EventType>();
-            }
         }
         /*********************************************************************************//*!
         \brief Removes a static/non-member function aka callback
@@ -191,10 +198,11 @@ namespace oo
         template<class EventType>
         void Unsubscribe(typename EventFunction<EventType>::FunctionPointer function)
         {
-            if (m_subscribers.find(GetTypeIndex<EventType>()) == m_subscribers.end())
+            auto* found_container = FindFunctionContainer<EventType>();
+            if (found_container == nullptr)
                 return;
 
-            auto& function_container = GetFunctionContainer<EventType>();
+            auto& function_container = *found_container;
 
             EventFunction<EventType> callback{ function };
             std::size_t index = 0;
@@ -207,10 +215,6 @@ namespace oo
                 }
                 ++index;
             }
-            if (function_container.empty())
-            {
-                RemoveFunctionContainer<EventType>();
-            }
         }
     };
 }
@@ -87,6 +87,9 @@ namespace oo
         bool Reset = false;
         //std::vector<glm::vec3> Vertices;
         std::vector<glm::vec3> WorldSpaceVertices;
+        // world space vertices are rebuilt when something reads them, see UpdateConvexWorldVertices
+        bool WorldSpaceVerticesDirty = true;
+        glm::mat4 WorldSpaceVerticesMatrix{ 0.f };
         RTTR_ENABLE();
     };
 
@@ -0,0 +1,69 @@
+/************************************************************************************//*!
+\file           ConvexVertexTransform.cpp
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Kernel that brings the vertices of a cooked convex hull into world
+                space, one vertex per 4 wide multiply add.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#include "pch.h"
+#include "ConvexVertexTransform.h"
+#include "ColliderComponents.h"
+#include "RigidbodyComponent.h"
+
+#include <xmmintrin.h>
+
+namespace oo
+{
+    static_assert(sizeof(glm::vec3) == 3 * sizeof(float));
+    static_assert(sizeof(physx::PxVec3) == 3 * sizeof(float));
+
+    void TransformConvexVertices(glm::vec3* dst, physx::PxVec3 const* src, std::size_t count, glm::mat4 const& matrix)
+    {
+        if (count == 0)
+            return;
+
+        // glm matrices are column major, so each column loads straight into a register
+        __m128 const c0 = _mm_loadu_ps(&matrix[0].x);
+        __m128 const c1 = _mm_loadu_ps(&matrix[1].x);
+        __m128 const c2 = _mm_loadu_ps(&matrix[2].x);
+        __m128 const c3 = _mm_loadu_ps(&matrix[3].x);
+
+        auto const transform = [&](physx::PxVec3 const& v)
+        {
+            __m128 const xy = _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(v.x)), _mm_mul_ps(c1, _mm_set1_ps(v.y)));
+            __m128 const zw = _mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(v.z)), c3);
+            return _mm_add_ps(xy, zw);
+        };
+
+        float* const out = reinterpret_cast<float*>(dst);
+
+        // each store writes 4 floats, the spare lane lands on the next vertex which overwrites it right after
+        std::size_t i = 0;
+        for (; i + 1 < count; ++i)
+            _mm_storeu_ps(out + i * 3, transform(src[i]));
+
+        // the last vertex has nothing after it to spill into
+        alignas(16) float last[4];
+        _mm_store_ps(last, transform(src[i]));
+        dst[i] = glm::vec3{ last[0], last[1], last[2] };
+    }
+
+    void UpdateConvexWorldVertices(ConvexColliderComponent& mc, RigidbodyComponent const& rb, glm::mat4 const& globalMatrix)
+    {
+        if (mc.WorldSpaceVerticesDirty == false && mc.WorldSpaceVerticesMatrix == globalMatrix)
+            return;
+
+        auto const& hull = rb.underlying_object.meshVertices;
+        mc.WorldSpaceVertices.resize(hull.size());
+        TransformConvexVertices(mc.WorldSpaceVertices.data(), hull.data(), hull.size(), globalMatrix);
+        mc.WorldSpaceVerticesMatrix = globalMatrix;
+        mc.WorldSpaceVerticesDirty = false;
+    }
+}
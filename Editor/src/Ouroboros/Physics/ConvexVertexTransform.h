@@ -0,0 +1,33 @@
+/************************************************************************************//*!
+\file           ConvexVertexTransform.h
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Kernel that brings the vertices of a cooked convex hull into world
+                space, one vertex per 4 wide multiply add.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#pragma once
+
+#include <cstddef>
+
+#include <glm/glm.hpp>
+#include <foundation/PxVec3.h>
+
+namespace oo
+{
+    struct ConvexColliderComponent;
+    class RigidbodyComponent;
+
+    // dst[i] = matrix * vec4{ src[i], 1 } for count vertices. dst must not alias src
+    void TransformConvexVertices(glm::vec3* dst, physx::PxVec3 const* src, std::size_t count, glm::mat4 const& matrix);
+
+    // Rebuilds the collider's world space vertices from the rigidbody's hull,
+    // only if the hull changed or the object moved since they were last built
+    void UpdateConvexWorldVertices(ConvexColliderComponent& mc, RigidbodyComponent const& rb, glm::mat4 const& globalMatrix);
+}
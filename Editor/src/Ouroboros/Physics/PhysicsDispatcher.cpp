@@ -0,0 +1,59 @@
+/************************************************************************************//*!
+\file           PhysicsDispatcher.cpp
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Defines the PhysX cpu dispatcher that runs PhysX tasks on the engine
+                worker pool.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#include "pch.h"
+#include "PhysicsDispatcher.h"
+
+#include "Ouroboros/TracyProfiling/OO_TracyProfiler.h"
+
+namespace oo
+{
+    PhysicsDispatcher& PhysicsDispatcher::Instance()
+    {
+        static PhysicsDispatcher dispatcher;
+        return dispatcher;
+    }
+
+    void PhysicsDispatcher::submitTask(physx::PxBaseTask& task)
+    {
+        // PhysX only needs the task run and released, nobody waits on the group.
+        // fetchResults is the sync point for the whole step.
+        worker_pool::submit(m_tasks, [&task]()
+            {
+                TRACY_PROFILE_SCOPE_NC(physx_task, tracy::Color::Brown);
+                task.run();
+                task.release();
+                TRACY_PROFILE_SCOPE_END();
+            });
+    }
+
+    uint32_t PhysicsDispatcher::getWorkerCount() const
+    {
+        // PhysX decides how finely to split its islands and broadphase from this
+        std::size_t workers = std::max<std::size_t>(worker_pool::thread_count(), 1);
+        if (m_maxWorkers != 0)
+            workers = std::min(workers, m_maxWorkers);
+        return static_cast<uint32_t>(workers);
+    }
+
+    void PhysicsDispatcher::SetMaxWorkers(std::size_t count)
+    {
+        m_maxWorkers = count;
+    }
+
+    std::size_t PhysicsDispatcher::GetMaxWorkers() const
+    {
+        return m_maxWorkers;
+    }
+}
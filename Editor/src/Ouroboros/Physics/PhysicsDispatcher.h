@@ -0,0 +1,41 @@
+/************************************************************************************//*!
+\file           PhysicsDispatcher.h
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Declares the PhysX cpu dispatcher that runs PhysX tasks on the engine
+                worker pool, so physics shares threads with the ECS instead of
+                spinning up its own.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#pragma once
+
+#include <Physics/Source/phy.h>
+
+#include "Ouroboros/Core/WorkerPool.h"
+
+namespace oo
+{
+    class PhysicsDispatcher final : public physx::PxCpuDispatcher
+    {
+    public:
+        static PhysicsDispatcher& Instance();
+
+        virtual void submitTask(physx::PxBaseTask& task) override;
+        virtual uint32_t getWorkerCount() const override;
+
+        // caps the number of workers PhysX splits its work for, 0 uses the whole pool.
+        // the tasks themselves still run on whichever worker picks them up.
+        void SetMaxWorkers(std::size_t count);
+        std::size_t GetMaxWorkers() const;
+
+    private:
+        worker_pool::task_group m_tasks;
+        std::size_t m_maxWorkers = 0;
+    };
+}
@@ -26,6 +26,8 @@ Technology is prohibited.
 
 #include "Ouroboros/Transform/TransformComponent.h"
 #include "Ouroboros/Transform/TransformSystem.h"
+#include "Ouroboros/Core/WorkerPool.h"
+#include "Ouroboros/Physics/ConvexVertexTransform.h"
 
 #include "OO_Vulkan/src/DebugDraw.h"
 #include "Ouroboros/ECS/ECS.h"
@@ -123,29 +125,8 @@ namespace oo
                 // we can confirm because anything that has convex-collider wants to use its vertices!
                 if (rb.underlying_object.meshVertices.empty() || mc.Reset == true)
                 {
-                    //mc.Vertices.clear();
-                    //mc.WorldSpaceVertices.clear();
-
-                    if (mr.MeshInformation.mesh_handle.GetID() != oo::Asset::ID_NULL)
-                    {
-                        auto& vertices = mr.MeshInformation.mesh_handle.GetData<ModelFileResource*>()->vertices;
-
-                        auto new_vertices = std::vector<physx::PxVec3>();
-                        new_vertices.reserve(vertices.size());
-                        std::for_each(vertices.begin(), vertices.end(), [&](auto&& vertex) {
-                            new_vertices.emplace_back(physx::PxVec3{ vertex.pos.x, vertex.pos.y, vertex.pos.z });
-                            });
-
-                        // we submit our desired vertices to let the physics engine decide
-                        rb.UploadVertices(new_vertices);
-
-                        //auto generated_vertices = rb.StoreMesh(new_vertices);
-
-                        //std::vector<oo::vec3> temp(generated_vertices.begin(), generated_vertices.end());
-                        //std::vector<glm::vec3> actual(temp.begin(), temp.end());
-                        //mc.WorldSpaceVertices = mc.Vertices = actual;
-                    }
-
+                    // objects sharing a model share its hull, only a reset cooks it again
+                    UploadConvexMesh(rb, mr, mc.Reset);
                     mc.Reset = false;
                 }
 
@@ -173,6 +154,7 @@ namespace oo
         // we run update dynamics once
         TRACY_PROFILE_SCOPE_NC(start_of_frame_retrieve_physics_properties, tracy::Color::VioletRed1);
         UpdateDynamics(FixedDeltaTime);
+        SyncSimulation();
         TRACY_PROFILE_SCOPE_END();
 
         TRACY_PROFILE_SCOPE_END();
@@ -190,6 +172,9 @@ namespace oo
         {
             TRACY_PROFILE_SCOPE_NC(physics_fixed_update, tracy::Color::PeachPuff1);
 
+            // steps are sequential, the previous one has to land before anyone looks at the scene again
+            SyncSimulation();
+
             {
                 TRACY_PROFILE_SCOPE_NC(physics_fixed_dt_broadcast, tracy::Color::PeachPuff2);
                 PhysicsTickEvent e;
@@ -214,6 +199,10 @@ namespace oo
             TRACY_PROFILE_SCOPE_END();
         }
 
+        // the last step is left running while the rest of the frame updates, unless pipelining is off
+        if (PipelinedStepping == false)
+            SyncSimulation();
+
         {
             TRACY_PROFILE_SCOPE_NC(physics_post_update, tracy::Color::PeachPuff);
             PostUpdate();
@@ -227,6 +216,9 @@ namespace oo
     {
         TRACY_PROFILE_SCOPE_NC(physics_update_editor, tracy::Color::PeachPuff);
 
+        // a paused runtime scene may still have a step in flight
+        SyncSimulation();
+
         // Update Duplicated Objects
         UpdateDuplicatedObjects();
 
@@ -262,11 +254,31 @@ namespace oo
         SubmitScriptCommands();
 
         // than we tell physics engine to update!
+        // the step runs on physx's worker threads, its results are applied in SyncSimulation.
         TRACY_PROFILE_SCOPE_NC(physX_backend_simulate, tracy::Color::Brown)
             // update the physics world using fixed dt.
-            m_physicsWorld.updateScene(static_cast<float>(FixedDeltaTime));
+            m_physicsWorld.beginUpdateScene(static_cast<float>(FixedDeltaTime), SplitSimulationStages);
+        TRACY_PROFILE_SCOPE_END();
+    }
+
+    void PhysicsSystem::SyncSimulation()
+    {
+        if (m_physicsWorld.isSimulating() == false)
+            return;
+
+        TRACY_PROFILE_SCOPE_NC(physics_sync_simulation, tracy::Color::Brown);
+
+        TRACY_PROFILE_SCOPE_NC(physX_backend_fetch_results, tracy::Color::Brown)
+            m_physicsWorld.endUpdateScene();
+        TRACY_PROFILE_SCOPE_END();
+
+        ApplySimulationResults();
+
         TRACY_PROFILE_SCOPE_END();
+    }
 
+    void PhysicsSystem::ApplySimulationResults()
+    {
         // Finally we retrieve the newly updated information from physics world 
         // and update our affected data.
         RetrieveUpdatedObjects();
@@ -359,6 +371,16 @@ namespace oo
                 InitializeMeshCollider(rbComp);
             });
 
+        // the duplicate starts without a hull, it picks the model's one up from the cache instead of cooking again
+        static Ecs::Query duplicated_mesh_renderer_query = Ecs::make_raw_query<RigidbodyComponent, ConvexColliderComponent, MeshRendererComponent, TransformComponent, DuplicatedComponent>();
+        m_world->parallel_for_each(duplicated_mesh_renderer_query, [&](RigidbodyComponent& rbComp, ConvexColliderComponent& mcComp, MeshRendererComponent& mrComp, TransformComponent& transformComp, DuplicatedComponent& dupComp)
+            {
+                UploadConvexMesh(rbComp, mrComp, false);
+                auto scale = transformComp.GetGlobalScale();
+                rbComp.SetMeshScale({ scale.x, scale.y, scale.z });
+                mcComp.WorldSpaceVerticesDirty = true;
+            });
+
         TRACY_PROFILE_SCOPE_END();
     }
 
@@ -374,10 +396,23 @@ namespace oo
         //std::mutex m;
         // Update physics World's objects position and Orientation
         static Ecs::Query rb_query = Ecs::make_query<TransformComponent, RigidbodyComponent>();
+
+        // rigidbodies whose transform moved, triggers are always updated below
+        for (Ecs::EntityID entity : m_world->Get_System<TransformSystem>()->GetChangedThisFrame())
+        {
+            if (m_world->matches_query(entity, rb_query) == false)
+                continue;
+
+            auto& tf = m_world->get_component<TransformComponent>(entity);
+            auto& rb = m_world->get_component<RigidbodyComponent>(entity);
+            if (rb.IsTrigger() == false)
+                rb.SetPosOrientation(tf.GetGlobalPosition() + rb.Offset, tf.GetGlobalRotationQuat());
+        }
+
         m_world->parallel_for_each(rb_query, [&](TransformComponent& tf, RigidbodyComponent& rb)
             {
                 TRACY_PROFILE_SCOPE_NC(submit_update_rigidbodies, tracy::Color::PeachPuff2);
-                if(tf.HasChangedThisFrame || rb.IsTrigger())
+                if(rb.IsTrigger())
                 {
                     TRACY_PROFILE_SCOPE_NC(rigidbody_set_pos_orientation, tracy::Color::PeachPuff4);
                     oo::vec3 pos = tf.GetGlobalPosition();
@@ -474,35 +509,17 @@ namespace oo
             TRACY_PROFILE_SCOPE_NC(physics_update_mesh_collider_bounds, tracy::Color::PeachPuff);
             //Updating mesh collider's bounds 
             static Ecs::Query meshColliderQuery = Ecs::make_query<TransformComponent, RigidbodyComponent, ConvexColliderComponent, MeshRendererComponent>();
-            m_world->for_each(meshColliderQuery, [&](TransformComponent& tf, RigidbodyComponent& rb, ConvexColliderComponent& mc, MeshRendererComponent& mr)
+            m_world->parallel_for_each(meshColliderQuery, [&](TransformComponent& tf, RigidbodyComponent& rb, ConvexColliderComponent& mc, MeshRendererComponent& mr)
                 {
                     //bool justEdited = false;
 
                     if (mc.Reset == true)
                     {
-                        //mc.Vertices.clear();
                         mc.WorldSpaceVertices.clear();
-                        
+                        mc.WorldSpaceVerticesDirty = true;
 
-                        if (mr.MeshInformation.mesh_handle.GetID() != oo::Asset::ID_NULL)
-                        {
-                            auto const vertices = mr.MeshInformation.mesh_handle.GetData<ModelFileResource*>()->vertices;
-
-                            auto new_vertices = std::vector<physx::PxVec3>();
-                            new_vertices.reserve(vertices.size());
-                            std::for_each(vertices.begin(), vertices.end(), [&](auto&& vertex) {
-                                new_vertices.emplace_back(physx::PxVec3{ vertex.pos.x, vertex.pos.y, vertex.pos.z });
-                                });
-
-                            //auto generated_vertices = rb.StoreMesh(new_vertices);
-
-                            // we submit our desired vertices to let the physics engine decide
-                            rb.UploadVertices(new_vertices);
-
-                            /*std::vector<oo::vec3> temp{ generated_vertices.begin(), generated_vertices.end() };
-                            std::vector<glm::vec3> final_result{temp.begin(), temp.end() };
-                            mc.WorldSpaceVertices = mc.Vertices = final_result;*/
-                        }
+                        // the model may have changed underneath us, so cook it again
+                        UploadConvexMesh(rb, mr, true);
 
                         mc.Reset = false;
                         //justEdited = true;
@@ -517,17 +534,8 @@ namespace oo
 
                     if (rb.VerticesChanged())
                     {
-                        auto gen_vertices = rb.underlying_object.meshVertices;
-                        std::vector<oo::vec3> temp{ gen_vertices.begin(), gen_vertices.end() };
-                        std::vector<glm::vec3> final_result{ temp.begin(), temp.end() };
-                        mc.WorldSpaceVertices = final_result;
-                        auto vertices = final_result.begin();
-                        auto globalMat = tf.GetGlobalMatrix();
-                        std::for_each(/*std::execution::par_unseq,*/ mc.WorldSpaceVertices.begin(), mc.WorldSpaceVertices.end(), [&](auto&& v)
-                            {
-                                v = globalMat * glm::vec4{ static_cast<glm::vec3>(*vertices++), 1 };
-                            });
-
+                        // whoever reads them next rebuilds them from the new hull
+                        mc.WorldSpaceVerticesDirty = true;
                         rb.ForceDirty();
                     }
 
@@ -567,25 +575,26 @@ namespace oo
         TRACY_PROFILE_SCOPE_NC(physics_submit_updates_to_physX_world, tracy::Color::VioletRed1);
 
         {
-            TRACY_PROFILE_SCOPE_NC(compiling_objects_that_requires_update, tracy::Color::VioletRed2);
-
-            needsUpdating.clear();
-            needsUpdating.reserve(1024);
+            TRACY_PROFILE_SCOPE_NC(physX_internal_updating, tracy::Color::VioletRed2);
+            // only dirty objects are submitted, and physx reads them straight out of the component
             static Ecs::Query rb_query = Ecs::make_raw_query<TransformComponent, RigidbodyComponent>();
             m_world->for_each(rb_query, [&](TransformComponent& tf, RigidbodyComponent& rb)
                 {
-                    if (rb.IsDirty)
-                        needsUpdating.emplace_back(rb.desired_object);
+                    if (rb.IsDirty == false)
+                        return;
 
                     rb.IsDirty = false;
-                });
-            TRACY_PROFILE_SCOPE_END();
-        }
+                    m_physicsWorld.submitUpdatedObject(rb.desired_object);
 
-        {
-            TRACY_PROFILE_SCOPE_NC(physX_internal_updating, tracy::Color::VioletRed2);
-            // submit to update
-            m_physicsWorld.submitUpdatedObjects(std::move(needsUpdating));
+                    // uploaded vertices are cooked once, they must not be sent again
+                    rb.desired_object.uploadVertices.clear();
+                    rb.underlying_object.material = rb.desired_object.material;
+
+                    // the cooked hull only crosses over when it was regenerated
+                    rb.desired_object.changeVertices = m_physicsWorld.verticesChanged(rb.underlying_object);
+                    if (rb.desired_object.changeVertices)
+                        rb.underlying_object.meshVertices = m_physicsWorld.getMeshVertices(rb.underlying_object);
+                });
             TRACY_PROFILE_SCOPE_END();
         }
 
@@ -609,15 +618,20 @@ namespace oo
 
     void PhysicsSystem::RetrieveUpdatedObjects()
     {
-        TRACY_PROFILE_SCOPE_NC(physics_retrieve_updated_objects, tracy::Color::Brown)
-            auto const& updatedPhysicsObjects = m_physicsWorld.retrieveCurrentObjects();
-        TRACY_PROFILE_SCOPE_END();
-
         TRACY_PROFILE_SCOPE_NC(physics_update_physics_properties, tracy::Color::Brown)
-            static Ecs::Query rb_query = Ecs::make_raw_query<TransformComponent, RigidbodyComponent>();
+        // read the published state in place, only slots that changed since the last step are copied
+        myPhysx::PhysicsState const& state = m_physicsWorld.getState();
+        static Ecs::Query rb_query = Ecs::make_raw_query<TransformComponent, RigidbodyComponent>();
         m_world->parallel_for_each(rb_query, [&](TransformComponent& tf, RigidbodyComponent& rb)
             {
-                rb.desired_object = rb.underlying_object = updatedPhysicsObjects.at(rb.underlying_object.id);
+                std::uint32_t const slot = rb.underlying_object.slot;
+                if (slot >= state.changedStep.size() || state.changed(slot) == false)
+                    return;
+
+                rb.desired_object.position = rb.underlying_object.position = state.position[slot];
+                rb.desired_object.orientation = rb.underlying_object.orientation = state.orientation[slot];
+                rb.desired_object.linearVel = rb.underlying_object.linearVel = state.linearVel[slot];
+                rb.desired_object.angularVel = rb.underlying_object.angularVel = state.angularVel[slot];
             });
         TRACY_PROFILE_SCOPE_END();
     }
@@ -625,12 +639,11 @@ namespace oo
     void PhysicsSystem::UpdateCallbacks()
     {
         TRACY_PROFILE_SCOPE_NC(physics_trigger_resoltion, tracy::Color::PeachPuff);
-        auto trigger_queue = m_physicsWorld.getTriggerData();
+        auto trigger_buffer = m_physicsWorld.getTriggerData();
         PhysicsTriggersEvent ptse;
-        ptse.TriggerEvents.reserve(trigger_queue->size());
-        while (!trigger_queue->empty())
+        ptse.TriggerEvents.reserve(trigger_buffer->size());
+        for (myPhysx::TriggerManifold const& trigger_manifold : *trigger_buffer)
         {
-            myPhysx::TriggerManifold trigger_manifold = trigger_queue->front();
 
             // if either objects are already removed, we skip them
             if (m_physicsToGameObjectLookup.contains(trigger_manifold.triggerID) == false
@@ -639,7 +652,6 @@ namespace oo
                 if (DebugMessages)
                     LOG_WARN("Skipped Trigger Callback because one of these pair of (Physics)UUID died ({0}), ({1}) ", trigger_manifold.triggerID, trigger_manifold.otherID);
 
-                trigger_queue->pop();
                 continue;
             }
 
@@ -681,8 +693,6 @@ namespace oo
             /*TRACY_PROFILE_SCOPE_NC(broadcast_physics_trigger_event, tracy::Color::PeachPuff);
             EventManager::Broadcast(&pte);
             TRACY_PROFILE_SCOPE_END();*/
-
-            trigger_queue->pop();
         }
         m_physicsWorld.clearTriggerData();
 
@@ -693,12 +703,11 @@ namespace oo
         
         //jobsystem::job collision_resolution;
 
-        auto collision_queue = m_physicsWorld.getCollisionData();
+        auto collision_buffer = m_physicsWorld.getCollisionData();
         PhysicsCollisionsEvent pcse;
-        pcse.CollisionEvents.reserve(collision_queue->size());
-        while (!collision_queue->empty())
+        pcse.CollisionEvents.reserve(collision_buffer->size());
+        for (myPhysx::ContactManifold const& contact_manifold : *collision_buffer)
         {
-            myPhysx::ContactManifold contact_manifold = collision_queue->front();
 
             // if either objects are already removed, we skip them
             if (m_physicsToGameObjectLookup.contains(contact_manifold.shape1_ID) == false
@@ -707,7 +716,6 @@ namespace oo
                 if (DebugMessages)
                     LOG_WARN("Skipped Physics Collision Callback because one of these pair of (Physics)UUID died ({0}), ({1}) ", contact_manifold.shape1_ID, contact_manifold.shape2_ID);
 
-                collision_queue->pop();
                 continue;
             }
             //ASSERT_MSG(m_physicsToGameObjectLookup.contains(contact_manifold.shape1_ID) == false, "This should never happen");
@@ -722,6 +730,7 @@ namespace oo
             pce.Collider1 = collider1_go_id;
             pce.Collider2 = collider2_go_id;
             pce.ContactCount = contact_manifold.contactCount;
+            pce.ContactPoints.reserve(contact_manifold.m_contactPoint.size());
             for(auto& elem : contact_manifold.m_contactPoint)
                 pce.ContactPoints.emplace_back(oo::ContactPoint{ {elem.normal.x,elem.normal.y, elem.normal.z} , {elem.point.x, elem.point.y, elem.point.z} , {elem.impulse.x, elem.impulse.y, elem.impulse.z} });
 
@@ -744,7 +753,7 @@ namespace oo
                 break;
             }
             
-            pcse.CollisionEvents.emplace_back(pce);
+            pcse.CollisionEvents.emplace_back(std::move(pce));
 
             /*jobsystem::submit(collision_resolution, [&]()
             {*/
@@ -752,8 +761,6 @@ namespace oo
                 EventManager::Broadcast(&pce);
                 TRACY_PROFILE_SCOPE_END();*/
             //});
-
-            collision_queue->pop();
         }
         m_physicsWorld.clearCollisionData();
 
@@ -866,6 +873,8 @@ namespace oo
         static Ecs::Query meshColliderQuery = Ecs::make_query<TransformComponent, RigidbodyComponent, ConvexColliderComponent>();
         m_world->for_each(meshColliderQuery, [&](TransformComponent& tf, RigidbodyComponent& rb, ConvexColliderComponent& mc)
             {
+                UpdateConvexWorldVertices(mc, rb, tf.GetGlobalMatrix());
+
                 /*
                 * TODO : FIGURE OUT WHY DAHELL THERES A DIFFERENCE, TOP DOESNT CRASH, BOTTOM DOES!
                 for (auto& i : mc.WorldSpaceVertices)
@@ -1023,6 +1032,145 @@ namespace oo
             { result.normal.x, result.normal.y, result.normal.z }, result.distance };
     }
 
+    namespace
+    {
+        // queries are cheap, so each worker takes at least this many
+        constexpr std::size_t QueryMinBatchSize = 32;
+
+        myPhysx::ShapeQuery ToPhysxQuery(ShapeQuery const& query)
+        {
+            myPhysx::ShapeQuery result;
+
+            PxQuat orientation{ query.Orientation.x, query.Orientation.y, query.Orientation.z, query.Orientation.w };
+            switch (query.Shape)
+            {
+            case QueryShape::Box:
+                result.geometry.storeAny(PxBoxGeometry{ query.HalfExtents.x, query.HalfExtents.y, query.HalfExtents.z });
+                break;
+            case QueryShape::Sphere:
+                result.geometry.storeAny(PxSphereGeometry{ query.Radius });
+                break;
+            case QueryShape::Capsule:
+                result.geometry.storeAny(PxCapsuleGeometry{ query.Radius, query.HalfHeight });
+                // physx capsules lie along x, turn it upright the same way the capsule collider does
+                orientation = orientation * PxQuat{ PxHalfPi, PxVec3{ 0, 0, 1 } };
+                break;
+            }
+            result.pose = PxTransform{ PxVec3{ query.Position.x, query.Position.y, query.Position.z }, orientation.getNormalized() };
+
+            glm::vec3 const direction = glm::length(query.Direction) > 0.f ? glm::normalize(query.Direction) : glm::vec3{ 0, -1, 0 };
+            result.direction = PxVec3{ direction.x, direction.y, direction.z };
+            result.distance = std::max(query.Distance, 0.f);
+            result.filter = static_cast<std::uint32_t>(query.Filter);
+            return result;
+        }
+    }
+
+    RaycastResult PhysicsSystem::ToRaycastResult(myPhysx::RaycastHit const& hit) const
+    {
+        if (hit.intersect == false)
+            return {};
+
+        auto iter = m_physicsToGameObjectLookup.find(hit.object_ID);
+        if (iter == m_physicsToGameObjectLookup.end())
+            return {};
+
+        return { true, iter->second, { hit.position.x, hit.position.y, hit.position.z },
+            { hit.normal.x, hit.normal.y, hit.normal.z }, hit.distance };
+    }
+
+    void PhysicsSystem::RaycastBatch(std::span<RaycastQuery const> queries, std::span<RaycastResult> results)
+    {
+        TRACY_PROFILE_SCOPE_NC(physics_raycast_batch, tracy::Color::PeachPuff4);
+
+        ASSERT_MSG(results.size() < queries.size(), "Every query of a raycast batch needs a result");
+        std::size_t const count = std::min(queries.size(), results.size());
+
+        m_rayQueryBuffer.resize(count);
+        m_queryHitBuffer.resize(count);
+
+        worker_pool::parallel_for(count, QueryMinBatchSize, [&](std::size_t first, std::size_t last)
+        {
+            for (std::size_t i = first; i < last; ++i)
+            {
+                RaycastQuery const& query = queries[i];
+                glm::vec3 const direction = glm::length(query.ray.Direction) > 0.f ? glm::normalize(query.ray.Direction) : glm::vec3{ 0, -1, 0 };
+                m_rayQueryBuffer[i] = { { query.ray.Position.x, query.ray.Position.y, query.ray.Position.z }
+                    , { direction.x, direction.y, direction.z }
+                    , query.Distance
+                    , static_cast<std::uint32_t>(query.Filter) };
+            }
+
+            m_physicsWorld.raycastBatch(m_rayQueryBuffer.data() + first, m_queryHitBuffer.data() + first, static_cast<PxU32>(last - first));
+
+            for (std::size_t i = first; i < last; ++i)
+                results[i] = ToRaycastResult(m_queryHitBuffer[i]);
+        });
+
+        TRACY_PROFILE_SCOPE_END();
+    }
+
+    void PhysicsSystem::SweepBatch(std::span<ShapeQuery const> queries, std::span<RaycastResult> results)
+    {
+        TRACY_PROFILE_SCOPE_NC(physics_sweep_batch, tracy::Color::PeachPuff4);
+
+        ASSERT_MSG(results.size() < queries.size(), "Every query of a sweep batch needs a result");
+        std::size_t const count = std::min(queries.size(), results.size());
+
+        m_shapeQueryBuffer.resize(count);
+        m_queryHitBuffer.resize(count);
+
+        worker_pool::parallel_for(count, QueryMinBatchSize, [&](std::size_t first, std::size_t last)
+        {
+            for (std::size_t i = first; i < last; ++i)
+                m_shapeQueryBuffer[i] = ToPhysxQuery(queries[i]);
+
+            m_physicsWorld.sweepBatch(m_shapeQueryBuffer.data() + first, m_queryHitBuffer.data() + first, static_cast<PxU32>(last - first));
+
+            for (std::size_t i = first; i < last; ++i)
+                results[i] = ToRaycastResult(m_queryHitBuffer[i]);
+        });
+
+        TRACY_PROFILE_SCOPE_END();
+    }
+
+    void PhysicsSystem::OverlapBatch(std::span<ShapeQuery const> queries, std::span<UUID> hits, std::size_t maxHitsPerQuery, std::span<std::uint32_t> hitCounts)
+    {
+        TRACY_PROFILE_SCOPE_NC(physics_overlap_batch, tracy::Color::PeachPuff4);
+
+        ASSERT_MSG(hitCounts.size() < queries.size() || hits.size() < queries.size() * maxHitsPerQuery, "Every query of an overlap batch needs a hit count and maxHitsPerQuery hits");
+        std::size_t count = std::min(queries.size(), hitCounts.size());
+        if (maxHitsPerQuery > 0)
+            count = std::min(count, hits.size() / maxHitsPerQuery);
+
+        m_shapeQueryBuffer.resize(count);
+        m_overlapHitBuffer.resize(count * maxHitsPerQuery);
+
+        worker_pool::parallel_for(count, QueryMinBatchSize, [&](std::size_t first, std::size_t last)
+        {
+            for (std::size_t i = first; i < last; ++i)
+                m_shapeQueryBuffer[i] = ToPhysxQuery(queries[i]);
+
+            m_physicsWorld.overlapBatch(m_shapeQueryBuffer.data() + first, m_overlapHitBuffer.data() + first * maxHitsPerQuery
+                , static_cast<PxU32>(maxHitsPerQuery), hitCounts.data() + first, static_cast<PxU32>(last - first));
+
+            // keep the hits on gameobjects we know about, packed at the front of each query's range
+            for (std::size_t i = first; i < last; ++i)
+            {
+                std::uint32_t written = 0;
+                for (std::uint32_t h = 0; h < hitCounts[i]; ++h)
+                {
+                    auto iter = m_physicsToGameObjectLookup.find(m_overlapHitBuffer[i * maxHitsPerQuery + h]);
+                    if (iter != m_physicsToGameObjectLookup.end())
+                        hits[i * maxHitsPerQuery + written++] = iter->second;
+                }
+                hitCounts[i] = written;
+            }
+        });
+
+        TRACY_PROFILE_SCOPE_END();
+    }
+
     void PhysicsSystem::OnRigidbodyAdd(Ecs::ComponentEvent<RigidbodyComponent>* rb)
     {
         InitializeRigidbody(rb->component);
@@ -1208,6 +1356,35 @@ namespace oo
         rb.desired_object.shape_type = myPhysx::shape::convex;
     }
 
+    void PhysicsSystem::UploadConvexMesh(RigidbodyComponent& rb, MeshRendererComponent const& mr, bool forceCook)
+    {
+        auto const meshID = mr.MeshInformation.mesh_handle.GetID();
+        if (meshID == oo::Asset::ID_NULL)
+            return;
+
+        // already cooked for another object, the key alone is enough
+        std::uint64_t const meshKey = static_cast<std::uint64_t>(meshID);
+        if (forceCook)
+        {
+            myPhysx::physx_system::releaseConvexMesh(meshKey);
+        }
+        else if (myPhysx::physx_system::hasConvexMesh(meshKey))
+        {
+            rb.UploadVertices({}, meshKey);
+            return;
+        }
+
+        auto const& vertices = mr.MeshInformation.mesh_handle.GetData<ModelFileResource*>()->vertices;
+
+        auto new_vertices = std::vector<physx::PxVec3>();
+        new_vertices.reserve(vertices.size());
+        for (auto const& vertex : vertices)
+            new_vertices.emplace_back(physx::PxVec3{ vertex.pos.x, vertex.pos.y, vertex.pos.z });
+
+        // we submit our desired vertices to let the physics engine decide
+        rb.UploadVertices(std::move(new_vertices), meshKey);
+    }
+
     void PhysicsSystem::DuplicateRigidbody(RigidbodyComponent& rb)
     {
         // we duplicate instead if this is an existing object
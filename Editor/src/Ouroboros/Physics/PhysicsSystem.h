@@ -21,6 +21,7 @@ Technology is prohibited.
 #include "Ouroboros/Core/Timer.h"
 #include <Physics/Source/phy.h>
 #include <bitset>
+#include <span>
 #include "Ouroboros/ECS/GameObjectComponent.h"
 #include "Ouroboros/Scene/Scene.h"
 
@@ -30,6 +31,7 @@ Technology is prohibited.
 namespace oo
 {
     class Scene;
+    struct MeshRendererComponent;
 
     class PhysicsSystem final : public Ecs::System
     {
@@ -43,6 +45,9 @@ namespace oo
         void Init(Scene* m_scene);
         void PostLoadSceneInit();
         void RuntimeUpdate(Timestep deltaTime);
+        // waits for the step RuntimeUpdate left running and applies its results to the scene.
+        // does nothing if no step is in flight.
+        void SyncSimulation();
         void EditorUpdate(Timestep deltaTime);
         void RenderDebugColliders();
 
@@ -51,6 +56,10 @@ namespace oo
         
         inline static bool ColliderDebugDraw = true;
         inline static bool DebugMessages = false;
+        // the last fixed step of a frame keeps simulating until SyncSimulation is called
+        inline static bool PipelinedStepping = true;
+        // run collide and advance separately instead of simulate
+        inline static bool SplitSimulationStages = false;
 
         // Layers  related functions
         inline static std::vector<std::string> LayerNames = { "Default", "Environment","Player","Enemy","Layer Five","Layer Six","Layer Seven","Layer Eight" };
@@ -66,6 +75,14 @@ namespace oo
         std::vector<RaycastResult> RaycastAll(Ray ray , float distance = std::numeric_limits<float>::max(), LayerType collisionFilter = std::numeric_limits<LayerType>::max());
         RaycastResult Sweepcast(phy_uuid::UUID uuid, vec3 direction, float distance = PX_MAX_SWEEP_DISTANCE);
 
+        // Batched queries. Results go to the caller's buffers, one entry per query (results must be at least as
+        // long as queries), and the queries are split across the worker pool. They see the last finished step.
+        void RaycastBatch(std::span<RaycastQuery const> queries, std::span<RaycastResult> results);
+        void SweepBatch(std::span<ShapeQuery const> queries, std::span<RaycastResult> results);
+        // query i writes up to maxHitsPerQuery gameobject ids starting at hits[i * maxHitsPerQuery]
+        // and the number it wrote to hitCounts[i]
+        void OverlapBatch(std::span<ShapeQuery const> queries, std::span<UUID> hits, std::size_t maxHitsPerQuery, std::span<std::uint32_t> hitCounts);
+
     private:
 
         inline static Timestep FixedDeltaTimeBase = 1.0/60.0;               // physics updates at 60 fps
@@ -75,6 +92,7 @@ namespace oo
         inline static Timestep MaxFrameTime = FixedDeltaTime * MaxFrameRateMultiplier;
 
         void UpdateDynamics(Timestep deltaTime);
+        void ApplySimulationResults();
         void UpdatePhysicsResolution(Timestep deltaTime);
         
         void UpdateJustCreated();
@@ -88,17 +106,23 @@ namespace oo
         void UpdateCallbacks();
         void PostUpdate();
 
+        // maps a backend hit to the gameobject it belongs to, hits on objects not in the lookup are dropped
+        RaycastResult ToRaycastResult(myPhysx::RaycastHit const& hit) const;
+
         Scene* m_scene = nullptr;
 
         // need a way to track physics uuids to gameobject uuids
         std::map<phy_uuid::UUID, UUID> m_physicsToGameObjectLookup = {};
 
+        // conversion buffers for the batched queries, kept to reuse their memory
+        std::vector<myPhysx::RaycastQuery> m_rayQueryBuffer;
+        std::vector<myPhysx::ShapeQuery> m_shapeQueryBuffer;
+        std::vector<myPhysx::RaycastHit> m_queryHitBuffer;
+        std::vector<phy_uuid::UUID> m_overlapHitBuffer;
+
         //underlying physics world
         myPhysx::PhysxWorld m_physicsWorld{ { Gravity.x, Gravity.y, Gravity.z} };
 
-        // stores all the physics objects that needs to be updated.
-        std::vector<myPhysx::PhysicsObject> needsUpdating;
-
         //time accumulator
         double m_accumulator = 0.0;
 
@@ -125,6 +149,10 @@ namespace oo
 
         void DuplicateRigidbody(RigidbodyComponent& rb);
 
+        // points rb at the convex hull of mr's model. every object using a model shares one cooked hull,
+        // forceCook cooks it again from the model's vertices
+        void UploadConvexMesh(RigidbodyComponent& rb, MeshRendererComponent const& mr, bool forceCook);
+
 
         void AddToLookUp(RigidbodyComponent& rb, GameObjectComponent& goc);
 
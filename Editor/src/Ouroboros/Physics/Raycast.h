@@ -1,5 +1,6 @@
 #pragma once
 #include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
 #include "Utility/UUID.h"
 #include "Ouroboros/EventSystem/Event.h"
 
@@ -14,6 +15,38 @@ namespace oo
         float Distance = 0;
     };
 
+    // one ray of PhysicsSystem::RaycastBatch
+    struct RaycastQuery
+    {
+        Ray ray;
+        float Distance = std::numeric_limits<float>::max();
+        std::uint32_t Filter = std::numeric_limits<std::uint32_t>::max();
+    };
+
+    enum class QueryShape : std::int32_t
+    {
+        Box,
+        Sphere,
+        Capsule,    // upright along its local y axis, same as the capsule collider
+    };
+
+    // one shape of PhysicsSystem::SweepBatch or PhysicsSystem::OverlapBatch.
+    // Box uses HalfExtents, Sphere uses Radius, Capsule uses Radius and HalfHeight.
+    // Overlaps ignore Direction and Distance.
+    struct ShapeQuery
+    {
+        QueryShape Shape = QueryShape::Sphere;
+        glm::vec3 Position = glm::vec3{ 0 };
+        glm::quat Orientation = glm::quat{ 1, 0, 0, 0 };
+        glm::vec3 HalfExtents = glm::vec3{ 0.5f };
+        float Radius = 0.5f;
+        float HalfHeight = 0.5f;
+
+        glm::vec3 Direction = glm::vec3{ 0 };
+        float Distance = 0;
+        std::uint32_t Filter = std::numeric_limits<std::uint32_t>::max();
+    };
+
     struct RaycastAllEvent : public oo::Event
     {
         Ray ray;
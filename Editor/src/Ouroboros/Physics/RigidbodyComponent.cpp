@@ -471,9 +471,10 @@ namespace oo
         external_commands.emplace_back(cmd);
     }
 
-    void oo::RigidbodyComponent::UploadVertices(std::vector<PxVec3> newVertices)
+    void oo::RigidbodyComponent::UploadVertices(std::vector<PxVec3> newVertices, std::uint64_t meshKey)
     {
-        desired_object.uploadVertices = newVertices;
+        desired_object.uploadVertices = std::move(newVertices);
+        desired_object.meshKey = meshKey;
         IsDirty = true;
     }
 
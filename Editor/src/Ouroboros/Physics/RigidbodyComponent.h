@@ -146,7 +146,8 @@ namespace oo
         void AddForce(vec3 force, ForceMode type = ForceMode::FORCE);
         void AddTorque(vec3 force, ForceMode type = ForceMode::FORCE);
 
-        void UploadVertices(std::vector<PxVec3> newVertices);
+        // meshKey lets objects using the same mesh share one cooked hull, 0 cooks a hull just for this object
+        void UploadVertices(std::vector<PxVec3> newVertices, std::uint64_t meshKey = 0);
         void SetMeshScale(PxVec3 newScale);
         
         void ForceDirty();
@@ -0,0 +1,187 @@
+/************************************************************************************//*!
+\file           GameObjectTable.cpp
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Defines the table the scene uses to look up gameobjects by uuid.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#include "pch.h"
+#include "GameObjectTable.h"
+
+namespace oo
+{
+    namespace
+    {
+        // uuids are random but cheap to mix anyway, guards against sequential ids clustering
+        std::size_t mix(std::uint64_t key)
+        {
+            key ^= key >> 33;
+            key *= 0xff51afd7ed558ccdull;
+            key ^= key >> 33;
+            key *= 0xc4ceb9fe1a85ec53ull;
+            key ^= key >> 33;
+            return static_cast<std::size_t>(key);
+        }
+    }
+
+    GameObjectTable::Handle GameObjectTable::Insert(UUID uuid, value_type object)
+    {
+        // keep the load factor at or below half so probe sequences stay short
+        if ((m_count + 1) * 2 > m_buckets.size())
+            Rehash(std::max(MinimumBuckets, m_buckets.size() * 2));
+
+        std::size_t const bucket = Probe(uuid);
+        if (m_buckets[bucket].Slot != EmptyBucket)
+        {
+            std::uint32_t const index = m_buckets[bucket].Slot;
+            return Handle{ index, m_slots[index].Generation };
+        }
+
+        std::uint32_t index;
+        if (m_freeSlots.empty() == false)
+        {
+            index = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else
+        {
+            index = static_cast<std::uint32_t>(m_slots.size());
+            m_slots.emplace_back();
+        }
+
+        Slot& slot = m_slots[index];
+        slot.Object = std::move(object);
+        slot.Key = uuid;
+
+        m_buckets[bucket] = Bucket{ uuid, index };
+        ++m_count;
+
+        return Handle{ index, slot.Generation };
+    }
+
+    bool GameObjectTable::Erase(UUID uuid)
+    {
+        if (m_count == 0)
+            return false;
+
+        std::size_t bucket = Probe(uuid);
+        if (m_buckets[bucket].Slot == EmptyBucket)
+            return false;
+
+        // release the slot, bumping the generation invalidates outstanding handles
+        Slot& slot = m_slots[m_buckets[bucket].Slot];
+        slot.Object = nullptr;
+        slot.Key = UUID::Invalid;
+        ++slot.Generation;
+        m_freeSlots.emplace_back(m_buckets[bucket].Slot);
+
+        // backward shift deletion, no tombstones left behind
+        std::size_t const mask = m_buckets.size() - 1;
+        std::size_t next = (bucket + 1) & mask;
+        while (m_buckets[next].Slot != EmptyBucket)
+        {
+            std::size_t const ideal = mix(m_buckets[next].Key) & mask;
+            // move the entry back if the hole lies between its ideal bucket and where it sits
+            if (((next - ideal) & mask) >= ((next - bucket) & mask))
+            {
+                m_buckets[bucket] = m_buckets[next];
+                bucket = next;
+            }
+            next = (next + 1) & mask;
+        }
+        m_buckets[bucket] = Bucket{};
+
+        --m_count;
+        return true;
+    }
+
+    void GameObjectTable::Clear()
+    {
+        // the slots stay so their generations keep counting, a handle from before can't match whatever reuses its slot
+        m_freeSlots.clear();
+        for (std::uint32_t index = static_cast<std::uint32_t>(m_slots.size()); index-- > 0;)
+        {
+            Slot& slot = m_slots[index];
+            if (slot.Key != UUID::Invalid)
+            {
+                slot.Object = nullptr;
+                slot.Key = UUID::Invalid;
+                ++slot.Generation;
+            }
+            m_freeSlots.emplace_back(index);
+        }
+        m_buckets.clear();
+        m_count = 0;
+    }
+
+    bool GameObjectTable::Contains(UUID uuid) const
+    {
+        return m_count != 0 && m_buckets[Probe(uuid)].Slot != EmptyBucket;
+    }
+
+    GameObjectTable::Handle GameObjectTable::GetHandle(UUID uuid) const
+    {
+        if (m_count == 0)
+            return Handle{};
+
+        std::uint32_t const index = m_buckets[Probe(uuid)].Slot;
+        if (index == EmptyBucket)
+            return Handle{};
+
+        return Handle{ index, m_slots[index].Generation };
+    }
+
+    GameObject* GameObjectTable::Get(Handle handle) const
+    {
+        if (handle.Index >= m_slots.size())
+            return nullptr;
+
+        Slot const& slot = m_slots[handle.Index];
+        return slot.Generation == handle.Generation ? slot.Object.get() : nullptr;
+    }
+
+    GameObjectTable::value_type GameObjectTable::Find(UUID uuid) const
+    {
+        if (m_count == 0)
+            return nullptr;
+
+        std::uint32_t const index = m_buckets[Probe(uuid)].Slot;
+        return index == EmptyBucket ? nullptr : m_slots[index].Object;
+    }
+
+    GameObject* GameObjectTable::FindRaw(UUID uuid) const
+    {
+        if (m_count == 0)
+            return nullptr;
+
+        std::uint32_t const index = m_buckets[Probe(uuid)].Slot;
+        return index == EmptyBucket ? nullptr : m_slots[index].Object.get();
+    }
+
+    std::size_t GameObjectTable::Probe(UUID::value_type key) const
+    {
+        std::size_t const mask = m_buckets.size() - 1;
+        std::size_t bucket = mix(key) & mask;
+        while (m_buckets[bucket].Slot != EmptyBucket && m_buckets[bucket].Key != key)
+            bucket = (bucket + 1) & mask;
+        return bucket;
+    }
+
+    void GameObjectTable::Rehash(std::size_t bucket_count)
+    {
+        std::vector<Bucket> old_buckets = std::move(m_buckets);
+        m_buckets.assign(bucket_count, Bucket{});
+
+        for (Bucket const& bucket : old_buckets)
+        {
+            if (bucket.Slot != EmptyBucket)
+                m_buckets[Probe(bucket.Key)] = bucket;
+        }
+    }
+}
@@ -0,0 +1,94 @@
+/************************************************************************************//*!
+\file           GameObjectTable.h
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Declares the table the scene uses to look up gameobjects by uuid.
+                Gameobjects live in a dense array of slots and an open addressing
+                hash map points uuids at their slot. A handle (slot index + generation)
+                can be kept around to skip the hash lookup entirely, and goes stale
+                on its own once the gameobject is removed.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "Utility/UUID.h"
+
+namespace oo
+{
+    //forward declare
+    class GameObject;
+
+    class GameObjectTable final
+    {
+    public:
+        using value_type = std::shared_ptr<GameObject>;
+
+        struct Handle
+        {
+            static constexpr std::uint32_t InvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+            std::uint32_t Index = InvalidIndex;
+            std::uint32_t Generation = 0;
+
+            bool IsValid() const { return Index != InvalidIndex; }
+            bool operator==(Handle const& other) const = default;
+        };
+
+    public:
+        // Does nothing if the uuid is already in the table, returns the handle of whatever is stored.
+        Handle Insert(UUID uuid, value_type object);
+        // returns false if the uuid wasn't in the table.
+        bool Erase(UUID uuid);
+        // erases everything, handles taken before stay stale even once their slots are reused.
+        void Clear();
+
+        bool Contains(UUID uuid) const;
+        std::size_t Size() const { return m_count; }
+
+        // returns an invalid handle if the uuid isn't in the table.
+        Handle GetHandle(UUID uuid) const;
+        // returns nullptr if the handle is stale.
+        GameObject* Get(Handle handle) const;
+
+        // returns nullptr if the uuid isn't in the table.
+        value_type Find(UUID uuid) const;
+        GameObject* FindRaw(UUID uuid) const;
+
+    private:
+        static constexpr std::uint32_t EmptyBucket = std::numeric_limits<std::uint32_t>::max();
+        static constexpr std::size_t MinimumBuckets = 64;
+
+        struct Slot
+        {
+            value_type Object = nullptr;
+            UUID::value_type Key = UUID::Invalid;
+            std::uint32_t Generation = 1;
+        };
+
+        struct Bucket
+        {
+            UUID::value_type Key = UUID::Invalid;
+            std::uint32_t Slot = EmptyBucket;
+        };
+
+        // returns the bucket holding the uuid or the empty bucket that ends its probe sequence
+        std::size_t Probe(UUID::value_type key) const;
+        void Rehash(std::size_t bucket_count);
+
+        std::vector<Slot> m_slots;
+        std::vector<std::uint32_t> m_freeSlots;
+        std::vector<Bucket> m_buckets;
+        std::size_t m_count = 0;
+    };
+}
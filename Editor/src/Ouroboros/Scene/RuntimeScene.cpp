@@ -120,22 +120,28 @@ namespace oo
             GetWorld().Get_System<ScriptSystem>()->InvokeForAllEnabled("TickCoroutines");
             TRACY_PROFILE_SCOPE_END();
         //    });
+
+        // scripts only mark transforms dirty, carry their changes through once before anything else reads them
+        TRACY_PROFILE_SCOPE(transform_post_scripts_update);
+        GetWorld().Get_System<oo::TransformSystem>()->UpdateEntireTree();
+        TRACY_PROFILE_SCOPE_END();
         //
         //jobsystem::launch_and_wait(phase_two);
 
-        //jobsystem::submit(phase_three, [&]() {
-            TRACY_PROFILE_SCOPE(animation_update);
-            GetWorld().Run_System<oo::Anim::AnimationSystem>();
-            TRACY_PROFILE_SCOPE_END();
-        //    });
-
         //jobsystem::job phase_three{};
         //
+        // physics kicks off its last step here and simulates while animation and audio update.
         //jobsystem::submit(phase_three, [&]() {
           TRACY_PROFILE_SCOPE(physics_runtime_update);
           GetWorld().Get_System<PhysicsSystem>()->RuntimeUpdate(timer::dt());
           TRACY_PROFILE_SCOPE_END();
         //    });
+
+        //jobsystem::submit(phase_three, [&]() {
+            TRACY_PROFILE_SCOPE(animation_update);
+            GetWorld().Run_System<oo::Anim::AnimationSystem>();
+            TRACY_PROFILE_SCOPE_END();
+        //    });
         
         //jobsystem::submit(phase_three, [&]() {
           TRACY_PROFILE_SCOPE(audio_update);
@@ -151,9 +157,20 @@ namespace oo
         
         //jobsystem::launch_and_wait(phase_three);
 
+        // sync point : physics results land before anything that can call into scripts, ui button events
+        // run scripts right away and those may write to the physics scene.
+        TRACY_PROFILE_SCOPE(physics_sync_simulation);
+        GetWorld().Get_System<PhysicsSystem>()->SyncSimulation();
+        TRACY_PROFILE_SCOPE_END();
+
         TRACY_PROFILE_SCOPE(UI_runtime_update);
         GetWorld().Get_System<oo::UISystem>()->RuntimeUpdate();
         TRACY_PROFILE_SCOPE_END();
+
+        // physics callbacks and ui button events run scripts too, carry what they moved through
+        TRACY_PROFILE_SCOPE(transform_post_physics_ui_update);
+        GetWorld().Get_System<oo::TransformSystem>()->UpdateEntireTree();
+        TRACY_PROFILE_SCOPE_END();
             
         TRACY_PROFILE_SCOPE_END();
 
@@ -173,6 +190,12 @@ namespace oo
 
             TRACY_PROFILE_SCOPE_END();
         }
+        {
+            // late update scripts (camera follow and the like) only mark transforms dirty, render reads the globals
+            TRACY_PROFILE_SCOPE(transform_post_late_update);
+            GetWorld().Get_System<oo::TransformSystem>()->UpdateEntireTree();
+            TRACY_PROFILE_SCOPE_END();
+        }
         {
             TRACY_PROFILE_SCOPE(inputsystem_late_update);
             GetWorld().Get_System<InputSystem>()->LateUpdate();
@@ -32,6 +32,7 @@ Technology is prohibited.
 #include "Ouroboros/ECS/JustCreatedSystem.h"
 
 #include "Ouroboros/Scripting/ScriptSystem.h"
+#include "Ouroboros/Scripting/ScriptComponentCache.h"
 
 #include "Ouroboros/Core/Application.h"
 #include "Ouroboros/Vulkan/VulkanContext.h"
@@ -73,6 +74,8 @@ namespace oo
     {
         EventManager::Unsubscribe<Scene, GameObjectComponent::OnEnableEvent>(this, &Scene::OnEnableGameObject);
         EventManager::Unsubscribe<Scene, GameObjectComponent::OnDisableEvent>(this, &Scene::OnDisableGameObject);
+        // the world goes with the scene
+        ScriptComponentCaches::ClearScene(GetID());
     }
 
     void Scene::Init()
@@ -156,11 +159,16 @@ namespace oo
         //}
         //m_createList.clear();
         
+        // apply structural changes recorded during the frame, this may queue more removals below.
+        m_ecsWorld->playback_commands();
+
         m_ecsWorld->Get_System<oo::DuplicatedSystem>()->Run(m_ecsWorld.get());
         m_ecsWorld->Get_System<oo::DeferredSystem>()->Run(m_ecsWorld.get());
         m_ecsWorld->Get_System<oo::JustCreatedSystem>()->Run(m_ecsWorld.get());
 
         // go through all things to remove at the end of frame and do so.
+        std::vector<go_ptr> removed;
+        removed.reserve(m_removeList.size());
         for (auto& uuid : m_removeList)
         {
             auto go_ptr = FindWithInstanceID(uuid);
@@ -170,9 +178,10 @@ namespace oo
                 "Attempting to delete an object that's already been removed"
             );
 
-            // Actual Deletion
-            RemoveGameObject(go_ptr);
+            removed.emplace_back(go_ptr);
         }
+        // Actual Deletion
+        RemoveGameObjects(removed);
         m_removeList.clear();
 
         TRACY_PROFILE_SCOPE_END();
@@ -199,9 +208,29 @@ namespace oo
             
         //m_createList.clear();
         m_removeList.clear();
-        m_lookupTable.clear();
+        m_lookupTable.Clear();
         m_gameObjects.clear();
         m_ecsWorld = std::make_unique<Ecs::ECSWorld>();
+        m_worldGeneration = ++s_worldGenerations;
+        // entities created and destroyed through command buffers become proper gameobjects,
+        // with their lookup table entry, scenegraph node and destroy callbacks
+        m_ecsWorld->set_command_structure(
+            [this](Ecs::IECSWorld&)
+            {
+                return CreateGameObjectImmediate()->GetEntity();
+            },
+            [this](Ecs::IECSWorld& world, Ecs::EntityID entity)
+            {
+                if (world.has_component<GameObjectComponent>(entity))
+                {
+                    if (auto go = FindWithInstanceID(world.get_component<GameObjectComponent>(entity).Id))
+                    {
+                        DestroyGameObject(*go);
+                        return;
+                    }
+                }
+                world.destroy(entity);
+            });
         m_graphicsWorld = std::make_unique<GraphicsWorld>();
         m_scenegraph = std::make_unique<scenegraph>("scenegraph");
         m_rootGo = nullptr;
@@ -218,6 +247,7 @@ namespace oo
             m_rootGo->GetComponent<GameObjectComponent>().Node = m_scenegraph->get_root();
                 
             ASSERT_MSG((!IsValid(*m_rootGo)), "Sanity check, root created should be from this scene.");
+            MarkHierarchyChanged();
         }
 
         // TODO: Solution To tie graphics world to rendering context for now!
@@ -247,11 +277,13 @@ namespace oo
         // kill the graphics world
         Application::Get().GetWindow().GetVulkanContext()->getRenderer()->DestroyWorld(m_graphicsWorld.get());
 
-        m_lookupTable.clear();
+        m_lookupTable.Clear();
         m_gameObjects.clear();
         m_rootGo.reset();
         m_scenegraph.reset();
         m_ecsWorld.reset();
+        m_worldGeneration = ++s_worldGenerations;
+        ScriptComponentCaches::ClearScene(GetID());
         m_graphicsWorld.reset();
         
 
@@ -312,19 +344,58 @@ namespace oo
         return CreateGameObjectImmediate(newObjectPtr);
     }
 
+    std::vector<Scene::go_ptr> Scene::CreateGameObjectsImmediate(std::vector<oo::UUID> const& uuids)
+    {
+        TRACY_PROFILE_SCOPE_NC(create_gameobjects_immediate, tracy::Color::Seashell4);
+
+        std::vector<GameObject::Entity> entities;
+        entities.reserve(uuids.size());
+        GameObject::CreateEntities(*this, uuids.size(), entities);
+
+        std::vector<Scene::go_ptr> newObjects;
+        newObjects.reserve(uuids.size());
+        for (std::size_t i = 0; i < uuids.size(); ++i)
+        {
+            Scene::go_ptr newObjectPtr = std::make_shared<GameObject>(uuids[i], entities[i], *this);
+            newObjects.emplace_back(CreateGameObjectImmediate(newObjectPtr));
+        }
+
+        TRACY_PROFILE_SCOPE_END();
+
+        return newObjects;
+    }
+
+    std::vector<Scene::go_ptr> Scene::CreateGameObjectsImmediate(std::size_t count)
+    {
+        std::vector<oo::UUID> uuids(count);
+        return CreateGameObjectsImmediate(uuids);
+    }
+
     Scene::go_ptr Scene::FindWithInstanceID(oo::UUID uuid) const
     {
         //LOG_INFO("Finding gameobject of instance ID {0}", uuid);
 
-        if (m_lookupTable.contains(uuid))
-            return m_lookupTable.at(uuid);
+        return m_lookupTable.Find(uuid);
+    }
+
+    GameObject* Scene::FindRawWithInstanceID(oo::UUID uuid) const
+    {
+        return m_lookupTable.FindRaw(uuid);
+    }
 
-        return nullptr;
+    Scene::Handle Scene::GetHandle(oo::UUID uuid) const
+    {
+        return m_lookupTable.GetHandle(uuid);
+    }
+
+    GameObject* Scene::FindWithHandle(Handle handle) const
+    {
+        return m_lookupTable.Get(handle);
     }
 
     bool Scene::IsValid(oo::UUID uuid) const
     {
-        return m_lookupTable.contains(uuid);
+        return m_lookupTable.Contains(uuid);
     }
 
     bool Scene::IsValid(GameObject go) const
@@ -497,6 +568,7 @@ namespace oo
         //auto name = "Just a fake default name for now until ecs is fixed";
         auto shared_ptr = m_scenegraph->create_new_child(name, GetInstanceID(*newObjectPtr));
         newObjectPtr->GetComponent<GameObjectComponent>().Node = shared_ptr;
+        MarkHierarchyChanged(*newObjectPtr);
 
         ASSERT_MSG(IsValid(*newObjectPtr) == false, "Sanity check, object created should comply");
 
@@ -508,7 +580,7 @@ namespace oo
     void Scene::InsertGameObject(Scene::go_ptr go_ptr)
     {
         m_gameObjects.emplace(go_ptr);
-        m_lookupTable.emplace(GetInstanceID(*go_ptr), go_ptr);
+        m_lookupTable.Insert(GetInstanceID(*go_ptr), go_ptr);
     }
 
     void Scene::RemoveGameObject(Scene::go_ptr go_ptr)
@@ -517,6 +589,38 @@ namespace oo
         
         TRACY_PROFILE_SCOPE_NC(remove_gameobject, tracy::Color::Seashell4);
 
+        DetachGameObject(go_ptr);
+
+        // actual deletion : Immediate.
+        m_ecsWorld->destroy(go_ptr->GetEntity());
+
+        TRACY_PROFILE_SCOPE_END();
+    }
+
+    void Scene::RemoveGameObjects(std::vector<Scene::go_ptr> const& go_ptrs)
+    {
+        if (go_ptrs.empty())
+            return;
+
+        TRACY_PROFILE_SCOPE_NC(remove_gameobjects, tracy::Color::Seashell4);
+
+        std::vector<Ecs::EntityID> entities;
+        entities.reserve(go_ptrs.size());
+        for (auto& go_ptr : go_ptrs)
+        {
+            ASSERT(go_ptr == nullptr);
+            DetachGameObject(go_ptr);
+            entities.emplace_back(go_ptr->GetEntity());
+        }
+
+        // actual deletion : Immediate, done as one batch so chunks are only compacted once.
+        m_ecsWorld->destroy(entities);
+
+        TRACY_PROFILE_SCOPE_END();
+    }
+
+    void Scene::DetachGameObject(Scene::go_ptr go_ptr)
+    {
         // one final broadcast to cleanup anything you need to
         GameObject::OnDestroy e;
         e.go = go_ptr.get();
@@ -526,15 +630,11 @@ namespace oo
         if (auto scenegraph_go = go_ptr->GetSceneNode().lock())
         {
             scenegraph_go->detach();
+            MarkHierarchyChanged(*go_ptr);
         }
 
-        m_lookupTable.erase(GetInstanceID(*go_ptr));
+        m_lookupTable.Erase(GetInstanceID(*go_ptr));
         m_gameObjects.erase(go_ptr);
-
-        // actual deletion : Immediate.
-        m_ecsWorld->destroy(go_ptr->GetEntity());
-
-        TRACY_PROFILE_SCOPE_END();
     }
 
     oo::UUID Scene::GetInstanceID(GameObject const& go) const
@@ -657,6 +757,27 @@ namespace oo
         return *m_scenegraph;
     }
 
+    void Scene::MarkHierarchyChanged()
+    {
+        ++m_hierarchyVersion;
+        // nothing recorded so far leads up to this version anymore
+        m_hierarchyChanges.clear();
+        m_hierarchyChangesBegin = m_hierarchyVersion;
+    }
+
+    void Scene::MarkHierarchyChanged(GameObject const& go)
+    {
+        // whoever is this far behind is better off rebuilding than replaying all of it
+        if (m_hierarchyChanges.size() >= MaxHierarchyChanges)
+        {
+            MarkHierarchyChanged();
+            return;
+        }
+
+        m_hierarchyChanges.emplace_back(HierarchyChange{ GetInstanceID(go), go.GetEntity() });
+        ++m_hierarchyVersion;
+    }
+
     Scene::go_ptr Scene::GetRoot() const
     {
         return m_rootGo;
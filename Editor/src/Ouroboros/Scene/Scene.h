@@ -30,6 +30,7 @@ Technology is prohibited.
 #include <Scripting/ComponentDatabase.h>
 
 #include "Ouroboros/ECS/GameObjectComponent.h"
+#include "GameObjectTable.h"
 
 namespace oo
 {
@@ -41,6 +42,7 @@ namespace oo
     {
     public:
         using go_ptr = std::shared_ptr<oo::GameObject>;
+        using Handle = GameObjectTable::Handle;
         //using go_on_create_callback = std::function<void(go_ptr)>;
         
         // Events
@@ -73,6 +75,10 @@ namespace oo
 
         go_ptr CreateGameObjectDeferred(oo::UUID uuid = {});
         go_ptr CreateGameObjectImmediate(oo::UUID uuid = {});
+        // Creates a gameobject for each uuid in one batch.
+        // The entities are created together so large prefabs and scenes don't pay for each one separately.
+        std::vector<go_ptr> CreateGameObjectsImmediate(std::vector<oo::UUID> const& uuids);
+        std::vector<go_ptr> CreateGameObjectsImmediate(std::size_t count);
         void DestroyGameObject(GameObject go);
         void DestroyGameObjectImmediate(GameObject go);
         
@@ -83,6 +89,14 @@ namespace oo
         // returns the gameobject if it does
         // else returns nullptr.
         go_ptr FindWithInstanceID(oo::UUID uuid) const;
+        // Same as FindWithInstanceID without copying the shared pointer.
+        // The pointer stays valid until the gameobject is removed.
+        GameObject* FindRawWithInstanceID(oo::UUID uuid) const;
+        // Handles skip the uuid lookup entirely, hot code can resolve one once and keep it.
+        // returns an invalid handle if the uuid isn't in the scene.
+        Handle GetHandle(oo::UUID uuid) const;
+        // returns nullptr once the gameobject the handle refers to has been removed.
+        GameObject* FindWithHandle(Handle handle) const;
         bool IsValid(oo::UUID uuid) const;
         bool IsValid(GameObject go) const;
 
@@ -92,6 +106,25 @@ namespace oo
 
         Ecs::ECSWorld& GetWorld();
         scenegraph const GetGraph() const;
+        // Bumped whenever gameobjects are created, destroyed or moved around the scenegraph.
+        // Anything caching the hierarchy compares against it to know when to rebuild.
+        std::size_t GetHierarchyVersion() const { return m_hierarchyVersion; }
+        // Anything could have changed, caches of the hierarchy have to rebuild.
+        void MarkHierarchyChanged();
+        // Only this gameobject was created, destroyed or moved, caches of the hierarchy can patch just its subtree.
+        void MarkHierarchyChanged(GameObject const& go);
+        // One change per version after GetHierarchyChangesBegin, anything older has to be rebuilt from the scenegraph.
+        // Only so many are kept, a cache that falls that far behind rebuilds.
+        struct HierarchyChange
+        {
+            UUID Id;
+            Ecs::EntityID Entity;
+        };
+        std::vector<HierarchyChange> const& GetHierarchyChanges() const { return m_hierarchyChanges; }
+        std::size_t GetHierarchyChangesBegin() const { return m_hierarchyChangesBegin; }
+        // Unique across every scene, changes whenever this scene's world is created or destroyed.
+        // Anything caching pointers into the world compares against it, the scene address and id can be reused.
+        std::uint64_t GetWorldGeneration() const { return m_worldGeneration; }
         go_ptr GetRoot() const;
         GraphicsWorld* GetGraphicsWorld() const;
         go_ptr GetMainCameraObject() const;
@@ -114,6 +147,9 @@ namespace oo
         go_ptr CreateGameObjectImmediate(go_ptr new_go);
         void InsertGameObject(go_ptr go_ptr);
         void RemoveGameObject(go_ptr go_ptr);
+        void RemoveGameObjects(std::vector<go_ptr> const& go_ptrs);
+        // removes the gameobject from the scene without destroying its entity
+        void DetachGameObject(go_ptr go_ptr);
 
         // Old method [ keeping just to verify if something goes wrong one day ]
         //void RecusriveLinkScenegraph(GameObject original_parent_go, std::queue<Scene::go_ptr> new_objects);
@@ -134,7 +170,7 @@ namespace oo
         // set of ids to Remove 
         std::set<oo::UUID> m_removeList;
         // one copy of a lookup table for all gameobjects.
-        std::map<oo::UUID, std::shared_ptr<oo::GameObject>> m_lookupTable;
+        GameObjectTable m_lookupTable;
         // direct copy of all gameobjects in the scene
         std::set<std::shared_ptr<oo::GameObject>> m_gameObjects;
 
@@ -146,6 +182,12 @@ namespace oo
         inline static std::unique_ptr<GraphicsWorld> m_graphicsWorld;
         std::unique_ptr<Ecs::ECSWorld> m_ecsWorld;
         std::unique_ptr<scenegraph> m_scenegraph;
+        std::size_t m_hierarchyVersion = 0;
+        std::vector<HierarchyChange> m_hierarchyChanges;
+        std::size_t m_hierarchyChangesBegin = 0;
+        static constexpr std::size_t MaxHierarchyChanges = 4096;
+        std::uint64_t m_worldGeneration = 0;
+        inline static std::uint64_t s_worldGenerations = 0;
         go_ptr m_rootGo;
 
         go_ptr m_mainCamera;
@@ -15,6 +15,7 @@ Technology is prohibited.
 #pragma once
 
 #include "Ouroboros/Scripting/ScriptManager.h"
+#include "Ouroboros/Scripting/ScriptComponentCache.h"
 #include "Ouroboros/Scripting/ScriptValue.h"
 
 /*-----------------------------------------------------------------------------*/
@@ -31,6 +32,8 @@ SCRIPT_API { Return Type } { Function Name }(Scene::ID_type sceneID, UUID uuid,
 // ScriptManager::GetScene
 // ScriptManager::GetObjectFromScene
 // They are special wrapper functions that will throw a C# null reference if the scene/GameObject does not exist
+// Functions that get called every frame should use ScriptComponentCache<{ Component }>::Get instead,
+// it does the same checks but skips the lookups while the GameObject stays alive
 
 // Even using helper macros, you'll need to write the C# code on your own. Just copy paste this in the corresponding C# class
 // Replace any bracketed { stuff } with the same name as the C++ code
@@ -57,8 +60,7 @@ const char* -> string
 #define SCRIPT_API_FUNCTION(Component, Function) \
 SCRIPT_API void Component##_##Function(Scene::ID_type sceneID, UUID uuid) \
 { \
-    std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid); \
-    obj->GetComponent<Component>().Function(); \
+    ScriptComponentCache<Component>::GetComponent(sceneID, uuid).Function(); \
 }
 
 // C# DLLImport code for Getting a variable (replace text in { })
@@ -73,24 +75,21 @@ SCRIPT_API void Component##_##Function(Scene::ID_type sceneID, UUID uuid) \
 #define SCRIPT_API_GET(Component, Name, Type, Variable) \
 SCRIPT_API Type Component##_##Name(Scene::ID_type sceneID, UUID uuid) \
 { \
-    std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid); \
-    Component& component = obj->GetComponent<Component>(); \
+    Component& component = ScriptComponentCache<Component>::GetComponent(sceneID, uuid); \
     return component.Variable; \
 }
 
 #define SCRIPT_API_SET(Component, Name, Type, Variable) \
 SCRIPT_API void Component##_##Name(Scene::ID_type sceneID, UUID uuid, Type value) \
 { \
-    std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid); \
-    Component& component = obj->GetComponent<Component>(); \
+    Component& component = ScriptComponentCache<Component>::GetComponent(sceneID, uuid); \
     component.Variable = value; \
 }
 
 #define SCRIPT_API_SET_A(Component, Name, Type, SetFunction, Additional) \
 SCRIPT_API void Component##_##Name(Scene::ID_type sceneID, UUID uuid, Type value) \
 { \
-    std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid); \
-    Component& component = obj->GetComponent<Component>(); \
+    Component& component = ScriptComponentCache<Component>::GetComponent(sceneID, uuid); \
     component.Variable = value; \
     Additional \
 }
@@ -106,24 +105,21 @@ SCRIPT_API_SET_A(Component, Set##Name, Type, Variable, Additional)
 #define SCRIPT_API_GET_FUNC(Component, Name, Type, GetFunction) \
 SCRIPT_API Type Component##_##Name(Scene::ID_type sceneID, UUID uuid) \
 { \
-    std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid); \
-    Component& component = obj->GetComponent<Component>(); \
+    Component& component = ScriptComponentCache<Component>::GetComponent(sceneID, uuid); \
     return component.GetFunction(); \
 }
 
 #define SCRIPT_API_SET_FUNC(Component, Name, Type, SetFunction) \
 SCRIPT_API void Component##_##Name(Scene::ID_type sceneID, UUID uuid, Type value) \
 { \
-    std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid); \
-    Component& component = obj->GetComponent<Component>(); \
+    Component& component = ScriptComponentCache<Component>::GetComponent(sceneID, uuid); \
     component.SetFunction(value); \
 }
 
 #define SCRIPT_API_SET_FUNC_A(Component, Name, Type, SetFunction, Additional) \
 SCRIPT_API void Component##_##Name(Scene::ID_type sceneID, UUID uuid, Type value) \
 { \
-    std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid); \
-    Component& component = obj->GetComponent<Component>(); \
+    Component& component = ScriptComponentCache<Component>::GetComponent(sceneID, uuid); \
     component.SetFunction(value); \
     Additional \
 }
@@ -152,16 +148,14 @@ SCRIPT_API_SET_FUNC_A(Component, Set##Name, Type, SetFunction, Additional)
 #define SCRIPT_API_GET_VECTOR3(Component, Name, Variable) \
 SCRIPT_API ScriptValue::vec3_type Component##_##Name(Scene::ID_type sceneID, UUID uuid) \
 { \
-    std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid); \
-    Component& component = obj->GetComponent<Component>(); \
+    Component& component = ScriptComponentCache<Component>::GetComponent(sceneID, uuid); \
     return ScriptValue::vec3_type{ component.Variable.x, component.Variable.y, component.Variable.z };\
 }
 
 #define SCRIPT_API_SET_VECTOR3(Component, Name, Variable) \
 SCRIPT_API void Component##_##Name(Scene::ID_type sceneID, UUID uuid, ScriptValue::vec3_type value) \
 { \
-    std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid); \
-    Component& component = obj->GetComponent<Component>(); \
+    Component& component = ScriptComponentCache<Component>::GetComponent(sceneID, uuid); \
     component.Variable = { value.x, value.y, value.z }; \
 }
 
@@ -172,8 +166,7 @@ SCRIPT_API_SET_VECTOR3(Component, Set##Name, Variable)
 #define SCRIPT_API_GET_FUNC_VECTOR3(Component, Name, GetFunction) \
 SCRIPT_API ScriptValue::vec3_type Component##_##Name(Scene::ID_type sceneID, UUID uuid) \
 { \
-    std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid); \
-    Component& component = obj->GetComponent<Component>(); \
+    Component& component = ScriptComponentCache<Component>::GetComponent(sceneID, uuid); \
     glm::vec3 vec = component.GetFunction();\
     return ScriptValue::vec3_type{ vec.x, vec.y, vec.z };\
 }
@@ -181,8 +174,7 @@ SCRIPT_API ScriptValue::vec3_type Component##_##Name(Scene::ID_type sceneID, UUI
 #define SCRIPT_API_SET_FUNC_VECTOR3(Component, Name, SetFunction) \
 SCRIPT_API void Component##_##Name(Scene::ID_type sceneID, UUID uuid, ScriptValue::vec3_type value) \
 { \
-    std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid); \
-    Component& component = obj->GetComponent<Component>(); \
+    Component& component = ScriptComponentCache<Component>::GetComponent(sceneID, uuid); \
     component.SetFunction({ value.x, value.y, value.z }); \
 }
 
@@ -206,16 +198,14 @@ SCRIPT_API_SET_FUNC_VECTOR3(Component, Set##Name, SetFunction)
 #define SCRIPT_API_GET_VECTOR2(Component, Name, Variable) \
 SCRIPT_API ScriptValue::vec2_type Component##_##Name(Scene::ID_type sceneID, UUID uuid) \
 { \
-    std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid); \
-    Component& component = obj->GetComponent<Component>(); \
+    Component& component = ScriptComponentCache<Component>::GetComponent(sceneID, uuid); \
     return ScriptValue::vec2_type{ component.Variable.x, component.Variable.y };\
 }
 
 #define SCRIPT_API_SET_VECTOR2(Component, Name, Variable) \
 SCRIPT_API void Component##_##Name(Scene::ID_type sceneID, UUID uuid, ScriptValue::vec2_type value) \
 { \
-    std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid); \
-    Component& component = obj->GetComponent<Component>(); \
+    Component& component = ScriptComponentCache<Component>::GetComponent(sceneID, uuid); \
     component.Variable = { value.x, value.y }; \
 }
 
@@ -226,8 +216,7 @@ SCRIPT_API_SET_VECTOR2(Component, Set##Name, Variable)
 #define SCRIPT_API_GET_FUNC_VECTOR2(Component, Name, GetFunction) \
 SCRIPT_API ScriptValue::vec2_type Component##_##Name(Scene::ID_type sceneID, UUID uuid) \
 { \
-    std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid); \
-    Component& component = obj->GetComponent<Component>(); \
+    Component& component = ScriptComponentCache<Component>::GetComponent(sceneID, uuid); \
     glm::vec2 vec = component.GetFunction();\
     return ScriptValue::vec2_type{ vec.x, vec.y };\
 }
@@ -235,8 +224,7 @@ SCRIPT_API ScriptValue::vec2_type Component##_##Name(Scene::ID_type sceneID, UUI
 #define SCRIPT_API_SET_FUNC_VECTOR2(Component, Name, SetFunction) \
 SCRIPT_API void Component##_##Name(Scene::ID_type sceneID, UUID uuid, ScriptValue::vec2_type value) \
 { \
-    std::shared_ptr<GameObject> obj = ScriptManager::GetObjectFromScene(sceneID, uuid); \
-    Component& component = obj->GetComponent<Component>(); \
+    Component& component = ScriptComponentCache<Component>::GetComponent(sceneID, uuid); \
     component.SetFunction({ value.x, value.y }); \
 }
 
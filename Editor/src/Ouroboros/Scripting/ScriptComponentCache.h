@@ -0,0 +1,132 @@
+/************************************************************************************//*!
+\file           ScriptComponentCache.h
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Declares the cache the exported C++ functions use to get from the
+                (scene id, instance id) pair C# scripts pass in to the component they
+                want. Each entry holds a generation checked gameobject handle and a
+                cached component pointer, so a script poking the same components
+                every frame skips the scene, uuid and component lookups entirely.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "Ouroboros/Scripting/ScriptManager.h"
+#include "Ouroboros/ECS/GameObject.h"
+
+namespace oo
+{
+    // Every ScriptComponentCache registers itself on first use, so a scene can clear its entries out of all
+    // of them when its world is unloaded or destroyed. Main thread only, same as the script calls using them.
+    class ScriptComponentCaches final
+    {
+    public:
+        // entries of other scenes are left alone, the editor scene keeps its cache while a runtime scene goes away
+        static void ClearScene(Scene::ID_type sceneID)
+        {
+            for (auto clear : s_clearFunctions)
+                clear(sceneID);
+        }
+
+        static void Register(void(*clear)(Scene::ID_type))
+        {
+            s_clearFunctions.emplace_back(clear);
+        }
+
+    private:
+        static inline std::vector<void(*)(Scene::ID_type)> s_clearFunctions;
+    };
+
+    // One direct mapped table per component type, indexed by the low bits of the instance id.
+    // Entries are keyed on the scene id and its world generation, and every use still checks
+    // the handle is alive and the component has not moved, so a cleared or reused slot is never trusted.
+    template<typename Component>
+    class ScriptComponentCache final
+    {
+    public:
+        struct Result
+        {
+            GameObject& Object;
+            Component& Value;
+        };
+
+        /*********************************************************************************//*!
+        \brief      Gets the GameObject and the component requested by a C# script.
+                    Throws a C# null exception if the scene or GameObject does not exist,
+                    same as ScriptManager::GetObjectFromScene
+
+        \param      sceneID
+                the id of the scene that the requested GameObject belongs to
+        \param      uuid
+                the id of the requested GameObject
+
+        \return     the GameObject and its component, only valid until the scene changes
+        *//**********************************************************************************/
+        static inline Result Get(Scene::ID_type sceneID, oo::UUID uuid)
+        {
+            static bool const registered = (ScriptComponentCaches::Register(&Clear), true);
+            (void)registered;
+
+            Scene& scene = ScriptManager::GetSceneRef(sceneID);
+            Entry& entry = s_entries[static_cast<std::size_t>(uuid.GetUUID()) & (EntryCount - 1)];
+
+            GameObject* obj = nullptr;
+            if (entry.SceneID == sceneID && entry.WorldGeneration == scene.GetWorldGeneration() && entry.Key == uuid.GetUUID())
+                obj = scene.FindWithHandle(entry.Object);
+
+            // handle went stale or the slot belongs to another gameobject, look it up properly
+            if (obj == nullptr || obj->GetInstanceID() != uuid)
+            {
+                entry = Entry{};
+                Scene::Handle handle = scene.GetHandle(uuid);
+                obj = scene.FindWithHandle(handle);
+                if (obj == nullptr)
+                {
+                    ScriptEngine::ThrowNullException();
+                }
+                entry.SceneID = sceneID;
+                entry.WorldGeneration = scene.GetWorldGeneration();
+                entry.Key = uuid.GetUUID();
+                entry.Object = handle;
+            }
+            return Result{ *obj, scene.GetWorld().get_component<Component>(obj->GetEntity(), entry.Value) };
+        }
+
+        static inline Component& GetComponent(Scene::ID_type sceneID, oo::UUID uuid)
+        {
+            return Get(sceneID, uuid).Value;
+        }
+
+        static inline void Clear(Scene::ID_type sceneID)
+        {
+            for (Entry& entry : s_entries)
+            {
+                if (entry.SceneID == sceneID)
+                    entry = Entry{};
+            }
+        }
+
+    private:
+        static constexpr std::size_t EntryCount = 256;
+
+        struct Entry
+        {
+            Scene::ID_type SceneID{};
+            std::uint64_t WorldGeneration = 0; // 0 is never handed out, so empty entries match nothing
+            UUID::value_type Key = UUID::Invalid;
+            Scene::Handle Object{};
+            Ecs::CachedRef<Component> Value{ nullptr, {} };
+        };
+
+        static inline std::array<Entry, EntryCount> s_entries{};
+    };
+}
@@ -34,6 +34,10 @@ namespace oo
 
     std::vector<std::pair<ScriptDatabase::IntPtr, AssetManager::LoadProgressPtr>> ScriptManager::s_sceneLoadingTrackers;
 
+    Scene::ID_type ScriptManager::s_CachedSceneID{};
+    std::weak_ptr<IScene> ScriptManager::s_CachedScene{};
+    Scene* ScriptManager::s_CachedScenePtr = nullptr;
+
     void ScriptManager::LoadProject(std::string const& buildPath, std::string const& projectPath)
     {
         s_BuildPath = buildPath;
@@ -40,6 +40,11 @@ namespace oo
 
         static std::vector<std::pair<ScriptDatabase::IntPtr, AssetManager::LoadProgressPtr>> s_sceneLoadingTrackers;
 
+        // the scene scripts last asked for, they almost always keep asking for the same one
+        static Scene::ID_type s_CachedSceneID;
+        static std::weak_ptr<IScene> s_CachedScene;
+        static Scene* s_CachedScenePtr;
+
     public:
         /*********************************************************************************//*!
         \brief      Used to set up all the required C# related variables to run scripting
@@ -99,6 +104,32 @@ namespace oo
             return std::dynamic_pointer_cast<Scene>(scene_weak.lock());
         }
 
+        /*********************************************************************************//*!
+        \brief      Same as GetScene, but skips the lookup and cast while scripts keep asking
+                    for the scene they asked for last and it is still alive. Meant for the
+                    C++ functions C# scripts call many times a frame.
+
+        \param      sceneID
+                the id of the requested scene
+        \return     a reference to the requested scene, if it is found
+        *//**********************************************************************************/
+        static inline Scene& GetSceneRef(Scene::ID_type sceneID)
+        {
+            if (sceneID != s_CachedSceneID || s_CachedScene.expired())
+            {
+                std::weak_ptr<IScene> scene_weak = s_SceneManager->GetScene(sceneID);
+                if (scene_weak.expired())
+                {
+                    LOG_ERROR("scene with id ({0}) does not exist", sceneID);
+                    ScriptEngine::ThrowNullException();
+                }
+                s_CachedSceneID = sceneID;
+                s_CachedScene = scene_weak;
+                s_CachedScenePtr = dynamic_cast<Scene*>(scene_weak.lock().get());
+            }
+            return *s_CachedScenePtr;
+        }
+
         /*********************************************************************************//*!
         \brief      Helper function used to get a scene by its name. This is mainly done
                     in C++ functions meant for C# scripts to call, and has the added feature
@@ -143,6 +174,27 @@ namespace oo
             return obj;
         }
 
+        /*********************************************************************************//*!
+        \brief      Same as GetObjectFromScene, but goes through GetSceneRef and returns
+                    the GameObject without copying a shared_ptr to it.
+
+        \param      sceneID
+                the id of the scene that the requested GameObject belongs to
+        \param      uuid
+                the id of the requested GameObject
+
+        \return     a reference to the requested GameObject, if it is found
+        *//**********************************************************************************/
+        static inline GameObject& GetObjectRefFromScene(Scene::ID_type sceneID, oo::UUID uuid)
+        {
+            GameObject* obj = GetSceneRef(sceneID).FindRawWithInstanceID(uuid);
+            if (obj == nullptr)
+            {
+                ScriptEngine::ThrowNullException();
+            }
+            return *obj;
+        }
+
         static inline std::vector<ScriptClassInfo> const& GetScriptList()
         {
             return s_ScriptList;
@@ -231,7 +231,9 @@ namespace oo
         MonoObject* script = scriptDatabase.TryRetrieveObject(uuid, name_space, name);
         if (script == nullptr)
             return;
-        ScriptEngine::InvokeFunction(script, "OnDestroy");
+        ScriptDatabase::Method* method = scriptDatabase.FindMethod(name_space, name, "OnDestroy", 0);
+        if (method != nullptr)
+            ScriptDatabase::Invoke(script, *method);
         //scriptDatabase.Delete(uuid, name_space, name);
         scriptDatabase.DeleteDelayed(uuid, name_space, name);
     }
@@ -244,10 +246,9 @@ namespace oo
         if (!gameObject->ActiveInHierarchy())
             return;
         MonoObject* obj = scriptDatabase.RetrieveObject(uuid, name_space, name);
-        if(isEnabled)
-            ScriptEngine::InvokeFunction(obj, "OnEnable");
-        else
-            ScriptEngine::InvokeFunction(obj, "OnDisable");
+        ScriptDatabase::Method* method = scriptDatabase.FindMethod(name_space, name, isEnabled ? "OnEnable" : "OnDisable", 0);
+        if (method != nullptr)
+            ScriptDatabase::Invoke(obj, *method);
     }
     bool ScriptSystem::CheckScriptEnabled(ScriptDatabase::UUID uuid, const char* name_space, const char* name)
     {
@@ -292,11 +293,11 @@ namespace oo
             return;
         if (!isPlaying)
             return;
-        scriptDatabase.ForEach(uuid, [&functionName, &params, &paramCount](MonoObject* object)
+        scriptDatabase.ForEachMethod(uuid, functionName, paramCount, [&params](MonoObject* object, ScriptDatabase::Method& method)
             {
                 try
                 {
-                    ScriptEngine::InvokeFunction(object, functionName, params, paramCount);
+                    ScriptDatabase::Invoke(object, method, params);
                 }
                 catch (std::exception const& e)
                 {
@@ -310,11 +311,11 @@ namespace oo
             return;
         if (!isPlaying)
             return;
-        scriptDatabase.ForEachEnabled(uuid, [&functionName, &params, &paramCount](MonoObject* object)
+        scriptDatabase.ForEachEnabledMethod(uuid, functionName, paramCount, [&params](MonoObject* object, ScriptDatabase::Method& method)
             {
                 try
                 {
-                    ScriptEngine::InvokeFunction(object, functionName, params, paramCount);
+                    ScriptDatabase::Invoke(object, method, params);
                 }
                 catch (std::exception const& e)
                 {
@@ -322,7 +323,7 @@ namespace oo
                 }
             }, [this](ScriptDatabase::UUID uuid)
             {
-                std::shared_ptr<GameObject> object = scene.FindWithInstanceID(uuid);
+                GameObject* object = scene.FindRawWithInstanceID(uuid);
                 return object->ActiveInHierarchy();
             });
     }
@@ -333,11 +334,11 @@ namespace oo
             return;
         if (!isPlaying)
             return;
-        scriptDatabase.ForEach(name_space, name, [&functionName, &params, &paramCount](MonoObject* object)
+        scriptDatabase.ForEachMethod(name_space, name, functionName, paramCount, [&params](MonoObject* object, ScriptDatabase::Method& method)
             {
                 try
                 {
-                    ScriptEngine::InvokeFunction(object, functionName, params, paramCount);
+                    ScriptDatabase::Invoke(object, method, params);
                 }
                 catch (std::exception const& e)
                 {
@@ -351,11 +352,11 @@ namespace oo
             return;
         if (!isPlaying)
             return;
-        scriptDatabase.ForEach(name_space, name, [&functionName, &params, &paramCount](MonoObject* object)
+        scriptDatabase.ForEachMethod(name_space, name, functionName, paramCount, [&params](MonoObject* object, ScriptDatabase::Method& method)
             {
                 try
                 {
-                    ScriptEngine::InvokeFunction(object, functionName, params, paramCount);
+                    ScriptDatabase::Invoke(object, method, params);
                 }
                 catch (std::exception const& e)
                 {
@@ -363,7 +364,7 @@ namespace oo
                 }
             }, [this](ScriptDatabase::UUID uuid)
             {
-                std::shared_ptr<GameObject> object = scene.FindWithInstanceID(uuid);
+                GameObject* object = scene.FindRawWithInstanceID(uuid);
                 return object->ActiveInHierarchy();
             });
     }
@@ -374,11 +375,11 @@ namespace oo
             return;
         if (!isPlaying)
             return;
-        scriptDatabase.ForAll([&functionName, &params, &paramCount](MonoObject* object)
+        scriptDatabase.ForAllMethod(functionName, paramCount, [&params](MonoObject* object, ScriptDatabase::Method& method)
             {
                 try
                 {
-                    ScriptEngine::InvokeFunction(object, functionName, params, paramCount);
+                    ScriptDatabase::Invoke(object, method, params);
                 }
                 catch (std::exception const& e)
                 {
@@ -420,11 +421,11 @@ namespace oo
         if (!isPlaying)
             return;
 
-        scriptDatabase.ForAllEnabled([&functionName, &params, &paramCount](MonoObject* object)
+        scriptDatabase.ForAllEnabledMethod(functionName, paramCount, [&params](MonoObject* object, ScriptDatabase::Method& method)
             {
                 try
                 {
-                    ScriptEngine::InvokeFunction(object, functionName, params, paramCount);
+                    ScriptDatabase::Invoke(object, method, params);
                 }
                 catch (std::exception const& e)
                 {
@@ -432,7 +433,7 @@ namespace oo
                 }
             }, [this](ScriptDatabase::UUID uuid)
             {
-                std::shared_ptr<GameObject> object = scene.FindWithInstanceID(uuid);
+                GameObject* object = scene.FindRawWithInstanceID(uuid);
                 return object->ActiveInHierarchy();
             });
     }
@@ -616,9 +617,9 @@ namespace oo
         UUID uuid = e->go->GetInstanceID();
         if (scene.FindWithInstanceID(uuid) == nullptr)
             return;
-        scriptDatabase.ForEachEnabled(uuid, [](MonoObject* object)
+        scriptDatabase.ForEachEnabledMethod(uuid, "OnDestroy", 0, [](MonoObject* object, ScriptDatabase::Method& method)
             {
-                ScriptEngine::InvokeFunction(object, "OnDestroy");
+                ScriptDatabase::Invoke(object, method);
             });
         scriptDatabase.Delete(uuid);
         componentDatabase.Delete(uuid);
@@ -646,46 +647,41 @@ namespace oo
             return;
         }
 
-        void* objParams[1];
-        objParams[0] = other;
-        void* otherParams[1];
-        otherParams[0] = obj;
-
         switch (e->State)
         {
         case PhysicsEventState::ENTER:
         {
-            scriptDatabase.ForEachEnabled(e->TriggerID, [&objParams](MonoObject* script)
+            scriptDatabase.ForEachEnabledMethod(e->TriggerID, "OnTriggerEnter", 1, [other](MonoObject* script, ScriptDatabase::Method& method)
                 {
-                    ScriptEngine::InvokeFunction(script, "OnTriggerEnter", objParams, 1);
+                    ScriptDatabase::Invoke(script, method, other);
                 });
-            scriptDatabase.ForEachEnabled(e->OtherID, [&otherParams](MonoObject* script)
+            scriptDatabase.ForEachEnabledMethod(e->OtherID, "OnTriggerEnter", 1, [obj](MonoObject* script, ScriptDatabase::Method& method)
                 {
-                    ScriptEngine::InvokeFunction(script, "OnTriggerEnter", otherParams, 1);
+                    ScriptDatabase::Invoke(script, method, obj);
                 });
         }
         break;
         case PhysicsEventState::STAY:
         {
-            scriptDatabase.ForEachEnabled(e->TriggerID, [&objParams](MonoObject* script)
+            scriptDatabase.ForEachEnabledMethod(e->TriggerID, "OnTriggerStay", 1, [other](MonoObject* script, ScriptDatabase::Method& method)
                 {
-                    ScriptEngine::InvokeFunction(script, "OnTriggerStay", objParams, 1);
+                    ScriptDatabase::Invoke(script, method, other);
                 });
-            scriptDatabase.ForEachEnabled(e->OtherID, [&otherParams](MonoObject* script)
+            scriptDatabase.ForEachEnabledMethod(e->OtherID, "OnTriggerStay", 1, [obj](MonoObject* script, ScriptDatabase::Method& method)
                 {
-                    ScriptEngine::InvokeFunction(script, "OnTriggerStay", otherParams, 1);
+                    ScriptDatabase::Invoke(script, method, obj);
                 });
         }
         break;
         case PhysicsEventState::EXIT:
         {
-            scriptDatabase.ForEachEnabled(e->TriggerID, [&objParams](MonoObject* script)
+            scriptDatabase.ForEachEnabledMethod(e->TriggerID, "OnTriggerExit", 1, [other](MonoObject* script, ScriptDatabase::Method& method)
                 {
-                    ScriptEngine::InvokeFunction(script, "OnTriggerExit", objParams, 1);
+                    ScriptDatabase::Invoke(script, method, other);
                 });
-            scriptDatabase.ForEachEnabled(e->OtherID, [&otherParams](MonoObject* script)
+            scriptDatabase.ForEachEnabledMethod(e->OtherID, "OnTriggerExit", 1, [obj](MonoObject* script, ScriptDatabase::Method& method)
                 {
-                    ScriptEngine::InvokeFunction(script, "OnTriggerExit", otherParams, 1);
+                    ScriptDatabase::Invoke(script, method, obj);
                 });
         }
         break;
@@ -718,6 +714,7 @@ namespace oo
 
         MonoClass* contactPointClass = ScriptEngine::GetClass("ScriptCore", "Ouroboros", "ContactPoint");
         MonoArray* arr = ScriptEngine::CreateArray(contactPointClass, e->ContactCount);
+        int32_t contactCount = static_cast<int32_t>(e->ContactCount);
         TempContactPoint temp;
         for (size_t i = 0; i < e->ContactCount; ++i)
         {
@@ -740,6 +737,8 @@ namespace oo
 
         field = mono_class_get_field_from_name(dataClass, "m_contacts");
         mono_field_set_value(collisionData1, field, arr);
+        field = mono_class_get_field_from_name(dataClass, "m_contactCount");
+        mono_field_set_value(collisionData1, field, &contactCount);
 
         // Collision Data for Collider2
 
@@ -754,59 +753,192 @@ namespace oo
 
         field = mono_class_get_field_from_name(dataClass, "m_contacts");
         mono_field_set_value(collisionData2, field, arr);
-
-        void* params1[1];
-        params1[0] = collisionData1;
-
-        void* params2[1];
-        params2[0] = collisionData2;
+        field = mono_class_get_field_from_name(dataClass, "m_contactCount");
+        mono_field_set_value(collisionData2, field, &contactCount);
 
         switch (e->State)
         {
         case PhysicsEventState::ENTER:
         {
-            scriptDatabase.ForEachEnabled(e->Collider1, [&params2](MonoObject* script)
+            scriptDatabase.ForEachEnabledMethod(e->Collider1, "OnCollisionEnter", 1, [collisionData2](MonoObject* script, ScriptDatabase::Method& method)
                 {
-                    ScriptEngine::InvokeFunction(script, "OnCollisionEnter", params2, 1);
+                    ScriptDatabase::Invoke(script, method, collisionData2);
                 });
-            scriptDatabase.ForEachEnabled(e->Collider2, [&params1](MonoObject* script)
+            scriptDatabase.ForEachEnabledMethod(e->Collider2, "OnCollisionEnter", 1, [collisionData1](MonoObject* script, ScriptDatabase::Method& method)
                 {
-                    ScriptEngine::InvokeFunction(script, "OnCollisionEnter", params1, 1);
+                    ScriptDatabase::Invoke(script, method, collisionData1);
                 });
         }
         break;
         case PhysicsEventState::STAY:
         {
-            scriptDatabase.ForEachEnabled(e->Collider1, [&params2](MonoObject* script)
+            scriptDatabase.ForEachEnabledMethod(e->Collider1, "OnCollisionStay", 1, [collisionData2](MonoObject* script, ScriptDatabase::Method& method)
                 {
-                    ScriptEngine::InvokeFunction(script, "OnCollisionStay", params2, 1);
+                    ScriptDatabase::Invoke(script, method, collisionData2);
                 });
-            scriptDatabase.ForEachEnabled(e->Collider2, [&params1](MonoObject* script)
+            scriptDatabase.ForEachEnabledMethod(e->Collider2, "OnCollisionStay", 1, [collisionData1](MonoObject* script, ScriptDatabase::Method& method)
                 {
-                    ScriptEngine::InvokeFunction(script, "OnCollisionStay", params1, 1);
+                    ScriptDatabase::Invoke(script, method, collisionData1);
                 });
         }
         break;
         case PhysicsEventState::EXIT:
         {
-            scriptDatabase.ForEachEnabled(e->Collider1, [&params2](MonoObject* script)
+            scriptDatabase.ForEachEnabledMethod(e->Collider1, "OnCollisionExit", 1, [collisionData2](MonoObject* script, ScriptDatabase::Method& method)
                 {
-                    ScriptEngine::InvokeFunction(script, "OnCollisionExit", params2, 1);
+                    ScriptDatabase::Invoke(script, method, collisionData2);
                 });
-            scriptDatabase.ForEachEnabled(e->Collider2, [&params1](MonoObject* script)
+            scriptDatabase.ForEachEnabledMethod(e->Collider2, "OnCollisionExit", 1, [collisionData1](MonoObject* script, ScriptDatabase::Method& method)
                 {
-                    ScriptEngine::InvokeFunction(script, "OnCollisionExit", params1, 1);
+                    ScriptDatabase::Invoke(script, method, collisionData1);
                 });
         }
         break;
         }
     }
 
+    namespace
+    {
+        // the objects the callbacks handed to ScriptCore's PhysicsCallbacks refer to by index, each one once
+        struct CallbackObjects
+        {
+            std::vector<MonoObject*> objects;
+            std::unordered_map<MonoObject*, int32_t> indices;
+
+            int32_t IndexOf(MonoObject* object)
+            {
+                if (object == nullptr)
+                    return -1;
+                auto [search, inserted] = indices.try_emplace(object, static_cast<int32_t>(objects.size()));
+                if (inserted)
+                    objects.emplace_back(object);
+                return search->second;
+            }
+
+            MonoArray* CreateArray() const
+            {
+                MonoArray* arr = ScriptEngine::CreateArray(mono_get_object_class(), objects.size());
+                for (size_t i = 0; i < objects.size(); ++i)
+                    mono_array_setref(arr, i, objects[i]);
+                return arr;
+            }
+        };
+
+        // the callbacks of one script class, they are gathered class by class
+        struct ClassRange
+        {
+            int32_t start;
+            int32_t count;
+        };
+
+        template<typename T>
+        MonoArray* CreateStructArray(const char* name_space, const char* name, std::vector<T> const& values)
+        {
+            MonoArray* arr = ScriptEngine::CreateArray(ScriptEngine::GetClass("ScriptCore", name_space, name), values.size());
+            if (values.empty() == false)
+                std::memcpy(mono_array_addr(arr, T, 0), values.data(), values.size() * sizeof(T));
+            return arr;
+        }
+    }
+
     void ScriptSystem::OnTriggerAllEvent(PhysicsTriggersEvent* e)
     {
+        struct CallbackData
+        {
+            MonoObject* other;
+            PhysicsEventState state;
+        };
+        // matches Ouroboros.Engine.TriggerCallback
+        struct TriggerCallback
+        {
+            int32_t script;
+            int32_t other;
+            int32_t state;
+        };
+
+        if (!isPlaying)
+            return;
+        if (e->TriggerEvents.empty())
+            return;
+
+        // the same colliders tend to show up in many events of a tick, only look them up once
+        std::unordered_map<UUID, MonoObject*> colliderMap;
+        colliderMap.reserve(e->TriggerEvents.size() * 2);
+        auto getCollider = [&](UUID uuid)
+        {
+            auto [search, inserted] = colliderMap.try_emplace(uuid, nullptr);
+            if (inserted)
+                search->second = componentDatabase.TryRetrieveDerivedObject(uuid, "Ouroboros", "Collider");
+            return search->second;
+        };
+
+        std::unordered_map<UUID, std::vector<CallbackData>> scriptDataMap;
+        scriptDataMap.reserve(e->TriggerEvents.size() * 2);
         for (PhysicsTriggerEvent& ev : e->TriggerEvents)
         {
-            OnTriggerEvent(&ev);
+            if (ev.State == PhysicsEventState::NONE)
+                continue;
+
+            MonoObject* obj = getCollider(ev.TriggerID);
+            MonoObject* other = getCollider(ev.OtherID);
+            if (obj == nullptr || other == nullptr)
+            {
+                LOG_CORE_ERROR("ScriptSystem Error: TriggerEvent Broadcasted, but Collider involved not supported in C#");
+                continue;
+            }
+            scriptDataMap[ev.TriggerID].emplace_back(CallbackData{ other, ev.State });
+            scriptDataMap[ev.OtherID].emplace_back(CallbackData{ obj, ev.State });
+        }
+        if (scriptDataMap.empty())
+            return;
+
+        // laid out as plain structs and handed over a class at a time, managed code fans them out to the scripts
+        CallbackObjects objects;
+        std::vector<TriggerCallback> callbacks;
+        std::vector<ClassRange> ranges;
+        MonoClass* rangeClass = nullptr;
+
+        // methods line up with PhysicsEventState, minus NONE
+        scriptDatabase.ForAllEnabledWithMethods({ "OnTriggerEnter", "OnTriggerStay", "OnTriggerExit" }, 1,
+            [&](UUID uuid, MonoObject* script, std::vector<ScriptDatabase::Method*>& methods)
+            {
+                auto dataSearch = scriptDataMap.find(uuid);
+                if (dataSearch == scriptDataMap.end())
+                    return;
+
+                for (CallbackData& data : dataSearch->second)
+                {
+                    size_t const state = static_cast<size_t>(data.state) - 1;
+                    if (methods[state] == nullptr)
+                        continue;
+
+                    MonoClass* klass = mono_object_get_class(script);
+                    if (klass != rangeClass)
+                    {
+                        ranges.emplace_back(ClassRange{ static_cast<int32_t>(callbacks.size()), 0 });
+                        rangeClass = klass;
+                    }
+                    callbacks.emplace_back(TriggerCallback{ objects.IndexOf(script), objects.IndexOf(data.other), static_cast<int32_t>(state) });
+                    ++ranges.back().count;
+                }
+            });
+        if (callbacks.empty())
+            return;
+
+        MonoArray* objectArray = objects.CreateArray();
+        MonoArray* callbackArray = CreateStructArray("Ouroboros.Engine", "TriggerCallback", callbacks);
+        MonoMethod* dispatch = ScriptEngine::GetFunction(ScriptEngine::GetClass("ScriptCore", "Ouroboros.Engine", "PhysicsCallbacks"), "DispatchTriggers", 4);
+        for (ClassRange& range : ranges)
+        {
+            void* params[4] = { objectArray, callbackArray, &range.start, &range.count };
+            try
+            {
+                ScriptEngine::InvokeFunction(nullptr, dispatch, params);
+            }
+            catch (std::exception const& ex)
+            {
+                LOG_ERROR(ex.what());
+            }
         }
     }
 
@@ -824,119 +956,141 @@ namespace oo
             ScriptValue::vec3_type point;
             ScriptValue::vec3_type impulse;
         };
+        struct ColliderObjects
+        {
+            MonoObject* gameObject;
+            MonoObject* rigidbody;
+            MonoObject* collider;
+        };
         struct CallbackData
         {
-            MonoObject* data;
+            ColliderObjects const* other;
+            int32_t contactStart;
+            int32_t contactCount;
             PhysicsEventState state;
         };
+        // matches Ouroboros.Engine.CollisionCallback
+        struct CollisionCallback
+        {
+            int32_t script;
+            int32_t gameObject;
+            int32_t rigidbody;
+            int32_t collider;
+            int32_t state;
+            int32_t contactStart;
+            int32_t contactCount;
+        };
 
         if (!isPlaying)
             return;
+        if (e->CollisionEvents.empty())
+            return;
 
-        MonoClass* contactPointClass = ScriptEngine::GetClass("ScriptCore", "Ouroboros", "ContactPoint");
-        MonoClass* dataClass = ScriptEngine::GetClass("ScriptCore", "Ouroboros", "Collision");
-        MonoClassField* dataClassGameObjectField = mono_class_get_field_from_name(dataClass, "m_gameObject");
-        MonoClassField* dataClassRigidbodyField = mono_class_get_field_from_name(dataClass, "m_rigidbody");
-        MonoClassField* dataClassColliderField = mono_class_get_field_from_name(dataClass, "m_collider");
-        MonoClassField* dataClassContactsField = mono_class_get_field_from_name(dataClass, "m_contacts");
+        // the same colliders tend to show up in many events of a tick, only look them up once.
+        // node based, so the pointers kept in CallbackData stay put
+        std::unordered_map<UUID, ColliderObjects> colliderMap;
+        colliderMap.reserve(e->CollisionEvents.size() * 2);
+        auto getColliderObjects = [&](UUID uuid) -> ColliderObjects const&
+        {
+            auto [search, inserted] = colliderMap.try_emplace(uuid, ColliderObjects{});
+            if (inserted)
+            {
+                search->second.collider = componentDatabase.TryRetrieveDerivedObject(uuid, "Ouroboros", "Collider");
+                if (search->second.collider != nullptr)
+                {
+                    search->second.gameObject = componentDatabase.TryRetrieveGameObjectObject(uuid);
+                    search->second.rigidbody = componentDatabase.TryRetrieveDerivedObject(uuid, "Ouroboros", "Rigidbody");
+                }
+            }
+            return search->second;
+        };
 
+        // every contact of the tick in one array, both sides of an event share its range
+        std::vector<TempContactPoint> contacts;
         std::unordered_map<UUID, std::vector<CallbackData>> scriptDataMap;
-        scriptDataMap.reserve(e->CollisionEvents.size());
+        scriptDataMap.reserve(e->CollisionEvents.size() * 2);
 
         for (PhysicsCollisionEvent& ev : e->CollisionEvents)
         {
-            MonoObject* col1 = componentDatabase.TryRetrieveDerivedObject(ev.Collider1, "Ouroboros", "Collider");
-            MonoObject* col2 = componentDatabase.TryRetrieveDerivedObject(ev.Collider2, "Ouroboros", "Collider");
+            if (ev.State == PhysicsEventState::NONE)
+                continue;
 
-            if (col1 == nullptr || col2 == nullptr)
+            ColliderObjects const& objects1 = getColliderObjects(ev.Collider1);
+            ColliderObjects const& objects2 = getColliderObjects(ev.Collider2);
+            if (objects1.collider == nullptr || objects2.collider == nullptr)
             {
                 LOG_CORE_ERROR("ScriptSystem Error: CollisionEvent Broadcasted, but Collider involved not supported in C#");
-                return;
+                continue;
             }
 
-            MonoArray* arr = ScriptEngine::CreateArray(contactPointClass, ev.ContactCount);
-            TempContactPoint temp;
+            int32_t const contactStart = static_cast<int32_t>(contacts.size());
             for (size_t i = 0; i < ev.ContactCount; ++i)
             {
-                temp.normal = ScriptValue::vec3_type{ ev.ContactPoints[i].Normal.x, ev.ContactPoints[i].Normal.y, ev.ContactPoints[i].Normal.z };
-                temp.point = ScriptValue::vec3_type{ ev.ContactPoints[i].Point.x, ev.ContactPoints[i].Point.y, ev.ContactPoints[i].Point.z };
-                temp.impulse = ScriptValue::vec3_type{ ev.ContactPoints[i].Impulse.x, ev.ContactPoints[i].Impulse.y, ev.ContactPoints[i].Impulse.z };
-                mono_array_set(arr, TempContactPoint, i, temp);
+                contacts.emplace_back(TempContactPoint{
+                    ScriptValue::vec3_type{ ev.ContactPoints[i].Normal.x, ev.ContactPoints[i].Normal.y, ev.ContactPoints[i].Normal.z },
+                    ScriptValue::vec3_type{ ev.ContactPoints[i].Point.x, ev.ContactPoints[i].Point.y, ev.ContactPoints[i].Point.z },
+                    ScriptValue::vec3_type{ ev.ContactPoints[i].Impulse.x, ev.ContactPoints[i].Impulse.y, ev.ContactPoints[i].Impulse.z } });
             }
+            int32_t const contactCount = static_cast<int32_t>(ev.ContactCount);
 
-            // Collision Data for Collider1
-
-            MonoObject* collisionData1 = ScriptEngine::CreateObject(dataClass);
-            mono_field_set_value(collisionData1, dataClassGameObjectField, componentDatabase.TryRetrieveGameObjectObject(ev.Collider1));
-            mono_field_set_value(collisionData1, dataClassRigidbodyField, componentDatabase.TryRetrieveDerivedObject(ev.Collider1, "Ouroboros", "Rigidbody"));
-            mono_field_set_value(collisionData1, dataClassColliderField, col1);
-            mono_field_set_value(collisionData1, dataClassContactsField, arr);
-
-            // Collision Data for Collider2
-
-            MonoObject* collisionData2 = ScriptEngine::CreateObject(dataClass);
-            mono_field_set_value(collisionData2, dataClassGameObjectField, componentDatabase.TryRetrieveGameObjectObject(ev.Collider2));
-            mono_field_set_value(collisionData2, dataClassRigidbodyField, componentDatabase.TryRetrieveDerivedObject(ev.Collider2, "Ouroboros", "Rigidbody"));
-            mono_field_set_value(collisionData2, dataClassColliderField, col2);
-            mono_field_set_value(collisionData2, dataClassContactsField, arr);
-
-            // set to map
-            auto search1 = scriptDataMap.find(ev.Collider1);
-            if (search1 == scriptDataMap.end())
-                scriptDataMap.emplace(std::pair{ ev.Collider1, std::vector<CallbackData>{ { collisionData2, ev.State } } });
-            else
-                search1->second.emplace_back(CallbackData{ collisionData2, ev.State });
-
-            auto search2 = scriptDataMap.find(ev.Collider2);
-            if (search2 == scriptDataMap.end())
-                scriptDataMap.emplace(std::pair{ ev.Collider2, std::vector<CallbackData>{ { collisionData1, ev.State } } });
-            else
-                search2->second.emplace_back(CallbackData{ collisionData1, ev.State });
+            // each side gets told about the other collider
+            scriptDataMap[ev.Collider1].emplace_back(CallbackData{ &objects2, contactStart, contactCount, ev.State });
+            scriptDataMap[ev.Collider2].emplace_back(CallbackData{ &objects1, contactStart, contactCount, ev.State });
         }
+        if (scriptDataMap.empty())
+            return;
 
-        MonoMethod* onEnterMethod = nullptr;
-        MonoMethod* onStayMethod = nullptr;
-        MonoMethod* onExitMethod = nullptr;
-
-        typedef void(__stdcall* CollisionFunction)(MonoObject*, MonoObject*, MonoException**);
-        CollisionFunction onEnterThunk = nullptr;
-        CollisionFunction onStayThunk = nullptr;
-        CollisionFunction onExitThunk = nullptr;
+        // laid out as plain structs and handed over a class at a time, managed code fans them out to the scripts
+        CallbackObjects objects;
+        std::vector<CollisionCallback> callbacks;
+        std::vector<ClassRange> ranges;
+        MonoClass* rangeClass = nullptr;
 
-        scriptDatabase.ForAllEnabledByClass([&](UUID uuid, MonoObject* script)
+        // methods line up with PhysicsEventState, minus NONE
+        scriptDatabase.ForAllEnabledWithMethods({ "OnCollisionEnter", "OnCollisionStay", "OnCollisionExit" }, 1,
+            [&](UUID uuid, MonoObject* script, std::vector<ScriptDatabase::Method*>& methods)
             {
                 auto dataSearch = scriptDataMap.find(uuid);
                 if (dataSearch == scriptDataMap.end())
                     return;
-                std::vector<CallbackData>& callbackData = dataSearch->second;
 
-                for (CallbackData& data : callbackData)
+                for (CallbackData& data : dataSearch->second)
                 {
-                    switch (data.state)
+                    size_t const state = static_cast<size_t>(data.state) - 1;
+                    if (methods[state] == nullptr)
+                        continue;
+
+                    MonoClass* klass = mono_object_get_class(script);
+                    if (klass != rangeClass)
                     {
-                    case PhysicsEventState::ENTER:
-                        ScriptEngine::InvokeFunctionThunk(script, onEnterThunk, data.data);
-                        break;
-                    case PhysicsEventState::STAY:
-                        ScriptEngine::InvokeFunctionThunk(script, onStayThunk, data.data);
-                        break;
-                    case PhysicsEventState::EXIT:
-                        ScriptEngine::InvokeFunctionThunk(script, onExitThunk, data.data);
-                        break;
+                        ranges.emplace_back(ClassRange{ static_cast<int32_t>(callbacks.size()), 0 });
+                        rangeClass = klass;
                     }
+                    callbacks.emplace_back(CollisionCallback{ objects.IndexOf(script),
+                        objects.IndexOf(data.other->gameObject), objects.IndexOf(data.other->rigidbody), objects.IndexOf(data.other->collider),
+                        static_cast<int32_t>(state), data.contactStart, data.contactCount });
+                    ++ranges.back().count;
                 }
-            }, [&](MonoClass* klass)
-            {
-                onEnterMethod = ScriptEngine::GetFunction(klass, "OnCollisionEnter", 1);
-                onEnterThunk = (onEnterMethod == nullptr) ? nullptr : static_cast<CollisionFunction>(mono_method_get_unmanaged_thunk(onEnterMethod));
-
-                onStayMethod = ScriptEngine::GetFunction(klass, "OnCollisionStay", 1);
-                onStayThunk = (onStayMethod == nullptr) ? nullptr : static_cast<CollisionFunction>(mono_method_get_unmanaged_thunk(onStayMethod));
-
-                onExitMethod = ScriptEngine::GetFunction(klass, "OnCollisionExit", 1);
-                onExitThunk = (onExitMethod == nullptr) ? nullptr : static_cast<CollisionFunction>(mono_method_get_unmanaged_thunk(onExitMethod));
-                return onEnterMethod != nullptr || onStayMethod != nullptr || onExitMethod != nullptr;
             });
+        if (callbacks.empty())
+            return;
+
+        MonoArray* objectArray = objects.CreateArray();
+        MonoArray* callbackArray = CreateStructArray("Ouroboros.Engine", "CollisionCallback", callbacks);
+        MonoArray* contactArray = CreateStructArray("Ouroboros", "ContactPoint", contacts);
+        MonoMethod* dispatch = ScriptEngine::GetFunction(ScriptEngine::GetClass("ScriptCore", "Ouroboros.Engine", "PhysicsCallbacks"), "DispatchCollisions", 5);
+        for (ClassRange& range : ranges)
+        {
+            void* params[5] = { objectArray, callbackArray, contactArray, &range.start, &range.count };
+            try
+            {
+                ScriptEngine::InvokeFunction(nullptr, dispatch, params);
+            }
+            catch (std::exception const& ex)
+            {
+                LOG_ERROR(ex.what());
+            }
+        }
     }
 
     void ScriptSystem::OnUIButtonEvent(UIButtonEvent* e)
@@ -950,33 +1104,33 @@ namespace oo
         switch (e->Type)
         {
         case UIButtonEventType::ON_POINTER_ENTER:
-            scriptDatabase.ForEachEnabled(e->buttonID, [](MonoObject* script)
+            scriptDatabase.ForEachEnabledMethod(e->buttonID, "OnPointerEnter", 0, [](MonoObject* script, ScriptDatabase::Method& method)
                 {
-                    ScriptEngine::InvokeFunction(script, "OnPointerEnter");
+                    ScriptDatabase::Invoke(script, method);
                 });
             break;
         case UIButtonEventType::ON_POINTER_EXIT:
-            scriptDatabase.ForEachEnabled(e->buttonID, [](MonoObject* script)
+            scriptDatabase.ForEachEnabledMethod(e->buttonID, "OnPointerExit", 0, [](MonoObject* script, ScriptDatabase::Method& method)
                 {
-                    ScriptEngine::InvokeFunction(script, "OnPointerExit");
+                    ScriptDatabase::Invoke(script, method);
                 });
             break;
         case UIButtonEventType::ON_PRESS:
-            scriptDatabase.ForEachEnabled(e->buttonID, [](MonoObject* script)
+            scriptDatabase.ForEachEnabledMethod(e->buttonID, "OnPointerDown", 0, [](MonoObject* script, ScriptDatabase::Method& method)
                 {
-                    ScriptEngine::InvokeFunction(script, "OnPointerDown");
+                    ScriptDatabase::Invoke(script, method);
                 });
             break;
         case UIButtonEventType::ON_RELEASE:
-            scriptDatabase.ForEachEnabled(e->buttonID, [](MonoObject* script)
+            scriptDatabase.ForEachEnabledMethod(e->buttonID, "OnPointerUp", 0, [](MonoObject* script, ScriptDatabase::Method& method)
                 {
-                    ScriptEngine::InvokeFunction(script, "OnPointerUp");
+                    ScriptDatabase::Invoke(script, method);
                 });
             break;
         case UIButtonEventType::ON_CLICK:
-            scriptDatabase.ForEachEnabled(e->buttonID, [](MonoObject* script)
+            scriptDatabase.ForEachEnabledMethod(e->buttonID, "OnPointerClick", 0, [](MonoObject* script, ScriptDatabase::Method& method)
                 {
-                    ScriptEngine::InvokeFunction(script, "OnPointerClick");
+                    ScriptDatabase::Invoke(script, method);
                 });
             break;
         }
@@ -16,6 +16,23 @@ Technology is prohibited.
 #include "TransformComponent.h"
 #include "App/Editor/Properties/UI_metadata.h"
 #include <rttr/registration>
+
+#include <atomic>
+
+namespace
+{
+    // set from any thread when a transform is modified, folded into the epoch by ModificationEpoch
+    std::atomic<bool> s_modified = false;
+    std::uint64_t s_modificationEpoch = 1;
+
+    void NoteModified()
+    {
+        // only written when it changes so setters in parallel loops don't fight over the cache line
+        if (s_modified.load(std::memory_order_relaxed) == false)
+            s_modified.store(true, std::memory_order_relaxed);
+    }
+}
+
 namespace oo
 {
     /********************************************************************************//*!
@@ -73,13 +90,13 @@ namespace oo
 
     TransformComponent::vec3& TransformComponent::Position()                  
     {
-        LocalMatrixDirty = true; 
+        MarkLocalDirty();
         return LocalTransform.Position;
     }
 
     TransformComponent::vec3& TransformComponent::Scale()                     
     {
-        LocalMatrixDirty = true; 
+        MarkLocalDirty();
         return LocalTransform.Scale; 
     }
     // note : scale must be set using setEulerAngle (internally uses quaternions)
@@ -87,32 +104,33 @@ namespace oo
     // Local Setters
     void TransformComponent::SetPosition(vec3 pos)                          
     {
-        LocalMatrixDirty = true; 
+        MarkLocalDirty();
         LocalTransform.Position = pos;
     }
     
     void TransformComponent::SetRotation(vec3 euler_angles_degrees)         
     { 
-        LocalMatrixDirty = true; 
+        MarkLocalDirty();
         LocalEulerAngles = euler_angles_degrees;
         LocalTransform.SetRotation(quaternion::from_euler(glm::radians(LocalEulerAngles)));
     }
 
     void oo::TransformComponent::SetOrientation(quat quaternion)
     {
-        LocalMatrixDirty = true;
+        MarkLocalDirty();
         LocalTransform.SetRotation(quaternion);
         LocalEulerAngles = LocalTransform.GetEulerAnglesDeg();
     }
 
     void TransformComponent::SetScale(vec3 scale)                           
     { 
-        LocalMatrixDirty = true; 
+        MarkLocalDirty();
         LocalTransform.Scale = scale;
     }
 
     void TransformComponent::SetLocalTransform(mat4 target_local_matrix)
     {
+        NoteModified();
         LocalMatrixDirty = false;
         HasChangedThisFrame = true;
         LocalTransform.SetTransform(target_local_matrix);
@@ -121,27 +139,27 @@ namespace oo
     // Global Setters
     void TransformComponent::SetGlobalPosition(vec3 position)               
     {
-        GlobalMatrixDirty = true;
+        MarkGlobalDirty();
         GlobalTransform.Position = position;
     }
 
     void TransformComponent::SetGlobalScale(vec3 scale)                     
     {
-        GlobalMatrixDirty = true;
+        MarkGlobalDirty();
         GlobalTransform.Scale = scale;
     }
 
     void TransformComponent::SetGlobalRotation(vec3 euler_angles_degrees)   
     { 
         //LocalMatrixDirty = true; 
-        GlobalMatrixDirty = true;
+        MarkGlobalDirty();
         GlobalTransform.SetRotation(quaternion::from_euler(glm::radians(euler_angles_degrees))); 
     }
 
     void TransformComponent::SetGlobalOrientation(quat quaternion)
     {
         //LocalMatrixDirty = true;
-        GlobalMatrixDirty = true;
+        MarkGlobalDirty();
         GlobalTransform.SetRotation(quaternion);
     }
 
@@ -161,22 +179,41 @@ namespace oo
 
     void TransformComponent::SetGlobalTransform(mat4 target_global_matrix)
     {
-        GlobalMatrixDirty = true;
+        MarkGlobalDirty();
         GlobalTransform.SetTransform(target_global_matrix);
     }
 
     /*void oo::TransformComponent::LookAt(vec3 target)
     {
-        LocalMatrixDirty = true;
+        MarkLocalDirty();
         LocalTransform.LookAt(target);
     }*/
 
     void oo::TransformComponent::LookAt(vec3 normalized_direction)
     {
-        GlobalMatrixDirty = true;
+        MarkGlobalDirty();
         GlobalTransform.LookAt(normalized_direction);
     }
 
+    void TransformComponent::MarkLocalDirty()
+    {
+        LocalMatrixDirty = true;
+        NoteModified();
+    }
+
+    void TransformComponent::MarkGlobalDirty()
+    {
+        GlobalMatrixDirty = true;
+        NoteModified();
+    }
+
+    std::uint64_t TransformComponent::ModificationEpoch()
+    {
+        if (s_modified.exchange(false, std::memory_order_relaxed))
+            ++s_modificationEpoch;
+        return s_modificationEpoch;
+    }
+
     void TransformComponent::CalculateLocalTransform()
     {
         LocalMatrixDirty = false;
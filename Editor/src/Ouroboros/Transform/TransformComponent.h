@@ -83,6 +83,12 @@ namespace oo
         void CalculateLocalTransform();
         void CalculateGlobalTransform();
 
+        // flag the transform as modified, use these over setting the flags so cached global values know to recheck
+        void MarkLocalDirty();
+        void MarkGlobalDirty();
+        // changes whenever any transform was modified since the last call. main thread only.
+        static std::uint64_t ModificationEpoch();
+
         /*vec3 GetLocalTranslationDelta() const { return LocalTranslationDelta; }
         vec3 GetLocalRotationDelta() const { return quaternion::to_euler(LocalOrientationDelta); }
 
@@ -99,6 +105,11 @@ namespace oo
         bool GlobalMatrixDirty = false;
         bool HasChangedThisFrame = false;
 
+        // the global values were known to be current at this modification epoch, see TransformSystem::ResolveGlobalTransform
+        std::uint64_t ResolvedEpoch = 0;
+        // non zero when ResolveGlobalTransform recalculated this since the last propagation, larger is later
+        std::uint64_t ResolvedStamp = 0;
+
         /*glm::vec3 PrevLocalPosition;
         glm::quat PrevLocalOrientation;
         glm::vec3 PrevGlobalPosition;
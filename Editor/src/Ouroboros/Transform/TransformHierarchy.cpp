@@ -0,0 +1,350 @@
+/************************************************************************************//*!
+\file           TransformHierarchy.cpp
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Defines the flattened copy of the scenegraph the transform system
+                propagates global matrices through.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#include "pch.h"
+#include "TransformHierarchy.h"
+
+#include <atomic>
+
+#include "Ouroboros/Scene/Scene.h"
+#include "Ouroboros/ECS/GameObject.h"
+#include "Ouroboros/Transform/TransformComponent.h"
+#include <Ouroboros/TracyProfiling/OO_TracyProfiler.h>
+
+namespace oo
+{
+    bool TransformHierarchy::IsStale(Scene const& scene) const
+    {
+        return m_version != scene.GetHierarchyVersion();
+    }
+
+    void TransformHierarchy::Rebuild(Scene const& scene)
+    {
+        TRACY_PROFILE_SCOPE_NC(transform_hierarchy_rebuild, tracy::Color::Gold3);
+
+        Clear();
+        Collect(scene, scene.GetGraph().get_root()->get_handle(), m_subtree);
+
+        // the root's subtree is everything, positions are the same as in the subtree
+        std::swap(Ids, m_subtree.Ids);
+        std::swap(Parents, m_subtree.Parents);
+        std::swap(SubtreeEnd, m_subtree.SubtreeEnd);
+        std::swap(Entities, m_subtree.Entities);
+        std::swap(GlobalMatrices, m_subtree.GlobalMatrices);
+        std::swap(Components, m_subtree.Components);
+        // a root without a gameobject has no entity to look it up by
+        for (std::uint32_t i = Components.empty() || Components[0] ? 0 : 1; i < Ids.size(); ++i)
+            SetEntityIndex(Entities[i], i);
+        ResizeFlags();
+
+        m_version = scene.GetHierarchyVersion();
+
+        TRACY_PROFILE_SCOPE_END();
+    }
+
+    bool TransformHierarchy::Patch(Scene const& scene)
+    {
+        auto const& changes = scene.GetHierarchyChanges();
+        std::size_t const begin = scene.GetHierarchyChangesBegin();
+        // the changes since our version weren't all recorded
+        if (Ids.empty() || m_version < begin || m_version > begin + changes.size())
+            return false;
+        // every change can shift most of the layout, past a point one rebuild is cheaper
+        std::size_t const pending = begin + changes.size() - m_version;
+        if (pending > 32 && pending * 32 > Ids.size())
+            return false;
+
+        TRACY_PROFILE_SCOPE_NC(transform_hierarchy_patch, tracy::Color::Gold3);
+
+        // destroyed gameobjects go first, later ones could already be using their entities' slots
+        for (std::size_t i = m_version - begin; i < changes.size(); ++i)
+        {
+            std::uint32_t const index = IndexOf(changes[i].Entity);
+            if (scene.FindRawWithInstanceID(changes[i].Id) == nullptr && index != 0 && Contains(index, changes[i].Id))
+                Remove(index);
+        }
+        for (std::size_t i = m_version - begin; i < changes.size(); ++i)
+        {
+            if (Sync(scene, changes[i].Id, changes[i].Entity) == false)
+            {
+                TRACY_PROFILE_SCOPE_END();
+                return false;
+            }
+        }
+        m_version = scene.GetHierarchyVersion();
+
+        TRACY_PROFILE_SCOPE_END();
+        return true;
+    }
+
+    void TransformHierarchy::MarkDirty(std::uint32_t index, bool globalDirty)
+    {
+        Dirty[index] = 1;
+        GlobalDirty[index] = globalDirty;
+
+        // stop at the first ancestor someone else already marked, everything above it is marked too
+        for (std::uint32_t curr = index; curr != InvalidIndex; curr = Parents[curr])
+        {
+            if (std::atomic_ref<std::uint8_t>{ SubtreeDirty[curr] }.exchange(1, std::memory_order_relaxed) != 0)
+                break;
+        }
+    }
+
+    void TransformHierarchy::Clear()
+    {
+        Ids.clear();
+        Parents.clear();
+        SubtreeEnd.clear();
+        Entities.clear();
+        GlobalMatrices.clear();
+        Components.clear();
+        std::fill(m_entityIndices.begin(), m_entityIndices.end(), InvalidIndex);
+    }
+
+    std::uint32_t TransformHierarchy::Append(UUID uuid, std::uint32_t parent, Ecs::EntityID entity, TransformComponent* tf)
+    {
+        std::uint32_t const index = static_cast<std::uint32_t>(Ids.size());
+
+        Ids.emplace_back(uuid);
+        Parents.emplace_back(parent);
+        SubtreeEnd.emplace_back(index + 1);
+        Entities.emplace_back(entity);
+        GlobalMatrices.emplace_back(tf ? tf->GlobalTransform.Matrix : glm::mat4{ 1.f });
+        Components.emplace_back(tf);
+        SetEntityIndex(entity, index);
+
+        return index;
+    }
+
+    void TransformHierarchy::EndAppend()
+    {
+        // children come after their parents, so walking backwards finishes every subtree before its parent's
+        for (std::uint32_t i = static_cast<std::uint32_t>(Ids.size()); i-- > 1;)
+            SubtreeEnd[Parents[i]] = std::max(SubtreeEnd[Parents[i]], SubtreeEnd[i]);
+        ResizeFlags();
+    }
+
+    bool TransformHierarchy::Move(std::uint32_t index, std::uint32_t parent)
+    {
+        // the root stays put, and nothing can be moved below itself
+        if (index == 0 || (parent >= index && parent < SubtreeEnd[index]))
+            return false;
+
+        std::uint32_t const end = SubtreeEnd[index];
+        Extract(index, m_subtree);
+        // everything after the subtree slid back to fill its place
+        if (parent >= end)
+            parent -= end - index;
+        Splice(m_subtree, parent);
+        return true;
+    }
+
+    void TransformHierarchy::Remove(std::uint32_t index)
+    {
+        if (index == 0)
+            return;
+        Extract(index, m_subtree);
+    }
+
+    void TransformHierarchy::Subtree::Clear()
+    {
+        Ids.clear();
+        Parents.clear();
+        SubtreeEnd.clear();
+        Entities.clear();
+        GlobalMatrices.clear();
+        Components.clear();
+    }
+
+    std::uint32_t TransformHierarchy::Subtree::Append(UUID uuid, std::uint32_t parent, Ecs::EntityID entity, TransformComponent* tf)
+    {
+        std::uint32_t const index = static_cast<std::uint32_t>(Ids.size());
+
+        Ids.emplace_back(uuid);
+        Parents.emplace_back(parent);
+        SubtreeEnd.emplace_back(index + 1);
+        Entities.emplace_back(entity);
+        GlobalMatrices.emplace_back(tf ? tf->GlobalTransform.Matrix : glm::mat4{ 1.f });
+        Components.emplace_back(tf);
+
+        return index;
+    }
+
+    void TransformHierarchy::Subtree::EndAppend()
+    {
+        for (std::uint32_t i = static_cast<std::uint32_t>(Ids.size()); i-- > 1;)
+            SubtreeEnd[Parents[i]] = std::max(SubtreeEnd[Parents[i]], SubtreeEnd[i]);
+    }
+
+    void TransformHierarchy::Collect(Scene const& scene, UUID root, Subtree& out) const
+    {
+        out.Clear();
+
+        GameObject* const root_go = scene.FindRawWithInstanceID(root);
+        scenenode::shared_pointer const root_node = root_go ? root_go->GetSceneNode().lock() : scene.GetGraph().get_root();
+        if (root_node == nullptr)
+            return;
+        // nodes are appended as they are popped, so a subtree is finished before anything pushed ahead of it
+        std::vector<std::pair<scenenode::raw_pointer, std::uint32_t>> stack{ { root_node.get(), InvalidIndex } };
+        while (stack.empty() == false)
+        {
+            auto [node, parent_index] = stack.back();
+            stack.pop_back();
+
+            GameObject* const go = scene.FindRawWithInstanceID(node->get_handle());
+            std::uint32_t const index = out.Append(node->get_handle(), parent_index, go ? go->GetEntity() : Ecs::EntityID{}, go ? &go->Transform() : nullptr);
+
+            // siblings end up in reverse, their order doesn't matter to propagation
+            for (auto iter = node->begin(); iter != node->end(); ++iter)
+            {
+                scenenode::shared_pointer const& child = *iter;
+                GameObject* const child_go = scene.FindRawWithInstanceID(child->get_handle());
+                // nodes are attached right after their gameobject is created, skip anything in between
+                if (child_go == nullptr)
+                    continue;
+                // already laid out somewhere else, the change that moved it here is still to be applied
+                if (Contains(IndexOf(child_go->GetEntity()), child->get_handle()))
+                    continue;
+
+                stack.emplace_back(child.get(), index);
+            }
+        }
+        out.EndAppend();
+    }
+
+    void TransformHierarchy::Extract(std::uint32_t index, Subtree& out)
+    {
+        std::uint32_t const begin = index;
+        std::uint32_t const end = SubtreeEnd[index];
+        std::uint32_t const count = end - begin;
+
+        out.Clear();
+        out.Ids.assign(Ids.begin() + begin, Ids.begin() + end);
+        out.Entities.assign(Entities.begin() + begin, Entities.begin() + end);
+        out.GlobalMatrices.assign(GlobalMatrices.begin() + begin, GlobalMatrices.begin() + end);
+        out.Components.assign(Components.begin() + begin, Components.begin() + end);
+        out.Parents.reserve(count);
+        out.SubtreeEnd.reserve(count);
+        for (std::uint32_t i = begin; i < end; ++i)
+        {
+            out.Parents.emplace_back(i == begin ? InvalidIndex : Parents[i] - begin);
+            out.SubtreeEnd.emplace_back(SubtreeEnd[i] - begin);
+            if (m_entityIndices[Entities[i].index] == i)
+                m_entityIndices[Entities[i].index] = InvalidIndex;
+        }
+
+        for (std::uint32_t ancestor = Parents[begin]; ancestor != InvalidIndex; ancestor = Parents[ancestor])
+            SubtreeEnd[ancestor] -= count;
+
+        Ids.erase(Ids.begin() + begin, Ids.begin() + end);
+        Parents.erase(Parents.begin() + begin, Parents.begin() + end);
+        SubtreeEnd.erase(SubtreeEnd.begin() + begin, SubtreeEnd.begin() + end);
+        Entities.erase(Entities.begin() + begin, Entities.begin() + end);
+        GlobalMatrices.erase(GlobalMatrices.begin() + begin, GlobalMatrices.begin() + end);
+        Components.erase(Components.begin() + begin, Components.begin() + end);
+
+        // only the nodes after the subtree moved, their parents are either before it or moved with them
+        for (std::uint32_t i = begin; i < Ids.size(); ++i)
+        {
+            if (Parents[i] >= end)
+                Parents[i] -= count;
+            SubtreeEnd[i] -= count;
+            if (m_entityIndices[Entities[i].index] == i + count)
+                m_entityIndices[Entities[i].index] = i;
+        }
+        ResizeFlags();
+    }
+
+    void TransformHierarchy::Splice(Subtree const& subtree, std::uint32_t parent)
+    {
+        std::uint32_t const at = SubtreeEnd[parent];
+        std::uint32_t const count = static_cast<std::uint32_t>(subtree.Ids.size());
+
+        // make room, everything from at onwards moves up by count
+        for (std::uint32_t i = at; i < Ids.size(); ++i)
+        {
+            if (Parents[i] >= at)
+                Parents[i] += count;
+            SubtreeEnd[i] += count;
+            if (m_entityIndices[Entities[i].index] == i)
+                m_entityIndices[Entities[i].index] = i + count;
+        }
+        for (std::uint32_t ancestor = parent; ancestor != InvalidIndex; ancestor = Parents[ancestor])
+            SubtreeEnd[ancestor] += count;
+
+        Ids.insert(Ids.begin() + at, subtree.Ids.begin(), subtree.Ids.end());
+        Parents.insert(Parents.begin() + at, subtree.Parents.begin(), subtree.Parents.end());
+        SubtreeEnd.insert(SubtreeEnd.begin() + at, subtree.SubtreeEnd.begin(), subtree.SubtreeEnd.end());
+        Entities.insert(Entities.begin() + at, subtree.Entities.begin(), subtree.Entities.end());
+        GlobalMatrices.insert(GlobalMatrices.begin() + at, subtree.GlobalMatrices.begin(), subtree.GlobalMatrices.end());
+        Components.insert(Components.begin() + at, subtree.Components.begin(), subtree.Components.end());
+
+        for (std::uint32_t i = at; i < at + count; ++i)
+        {
+            Parents[i] = i == at ? parent : Parents[i] + at;
+            SubtreeEnd[i] += at;
+            SetEntityIndex(Entities[i], i);
+        }
+        ResizeFlags();
+    }
+
+    bool TransformHierarchy::Sync(Scene const& scene, UUID uuid, Ecs::EntityID entity)
+    {
+        std::uint32_t index = IndexOf(entity);
+        if (Contains(index, uuid) == false)
+            index = InvalidIndex;
+
+        GameObject* const go = scene.FindRawWithInstanceID(uuid);
+        scenenode::shared_pointer const node = go ? go->GetSceneNode().lock() : nullptr;
+        // destroyed, its children were destroyed with it
+        if (node == nullptr)
+        {
+            if (index != InvalidIndex)
+                Remove(index);
+            return true;
+        }
+
+        GameObject* const parent_go = scene.FindRawWithInstanceID(node->get_parent_handle());
+        std::uint32_t const parent = parent_go ? IndexOf(parent_go->GetEntity()) : InvalidIndex;
+        // the parent should have been laid out by an earlier change
+        if (Contains(parent, node->get_parent_handle()) == false)
+            return false;
+
+        if (index == InvalidIndex)
+        {
+            Collect(scene, uuid, m_subtree);
+            Splice(m_subtree, parent);
+            return true;
+        }
+        // only the order among siblings changed, which propagation doesn't care about
+        if (Parents[index] == parent)
+            return true;
+        return Move(index, parent);
+    }
+
+    void TransformHierarchy::SetEntityIndex(Ecs::EntityID entity, std::uint32_t index)
+    {
+        if (entity.index >= m_entityIndices.size())
+            m_entityIndices.resize(entity.index + 1, InvalidIndex);
+        m_entityIndices[entity.index] = index;
+    }
+
+    void TransformHierarchy::ResizeFlags()
+    {
+        LocalMatrices.resize(Ids.size());
+        Dirty.resize(Ids.size(), 0);
+        GlobalDirty.resize(Ids.size(), 0);
+        SubtreeDirty.resize(Ids.size(), 0);
+    }
+}
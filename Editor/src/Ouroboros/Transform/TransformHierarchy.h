@@ -0,0 +1,124 @@
+/************************************************************************************//*!
+\file           TransformHierarchy.h
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Declares the flattened copy of the scenegraph the transform system
+                propagates global matrices through. Nodes are laid out depth first,
+                so every parent sits before its children and every subtree is one
+                contiguous range that can be swept linearly, or moved as a block
+                when the scenegraph changes.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Utility/UUID.h"
+#include "Ouroboros/ECS/ArchtypeECS/EcsUtils.h"
+
+namespace oo
+{
+    //forward declare
+    class Scene;
+    class TransformComponent;
+
+    class TransformHierarchy final
+    {
+    public:
+        static constexpr std::uint32_t InvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+        // true if the scene's hierarchy changed since the last rebuild or patch.
+        bool IsStale(Scene const& scene) const;
+        // re-walks the scenegraph and assigns every transform its index.
+        void Rebuild(Scene const& scene);
+        // moves, inserts and removes only the subtrees of the gameobjects the scene reported changed since
+        // the last rebuild or patch. returns false if that isn't possible, the caller rebuilds instead.
+        bool Patch(Scene const& scene);
+        // forces a rebuild the next time IsStale is checked.
+        void Invalidate() { m_version = std::numeric_limits<std::size_t>::max(); }
+
+        bool Contains(std::uint32_t index, UUID uuid) const { return index < Ids.size() && Ids[index] == uuid; }
+        std::size_t Size() const { return Ids.size(); }
+        // index of the node holding the entity, check it with Contains as entity slots get reused.
+        std::uint32_t IndexOf(Ecs::EntityID entity) const { return entity.index < m_entityIndices.size() ? m_entityIndices[entity.index] : InvalidIndex; }
+
+        // flags the transform as modified and every ancestor as having something modified below it.
+        // safe to call from multiple threads at once.
+        void MarkDirty(std::uint32_t index, bool globalDirty);
+
+        // Structural edits, the subtree always moves along with its node. These only shift the nodes
+        // after the affected ranges and must not run while any flag is set, ie. during propagation.
+
+        // empties the hierarchy so nodes can be appended
+        void Clear();
+        // adds a node as the last one, its parent has to be InvalidIndex for the first node and otherwise
+        // the last node or one of its ancestors, so the layout stays depth first. call EndAppend when done.
+        std::uint32_t Append(UUID uuid, std::uint32_t parent, Ecs::EntityID entity, TransformComponent* tf);
+        void EndAppend();
+        // makes the node the last child of parent. returns false if parent is in the node's own subtree.
+        bool Move(std::uint32_t index, std::uint32_t parent);
+        void Remove(std::uint32_t index);
+
+    public:
+        // one entry per node, indexed by hierarchy index
+        std::vector<UUID> Ids;
+        std::vector<std::uint32_t> Parents;
+        // the subtree of node i is [i, SubtreeEnd[i])
+        std::vector<std::uint32_t> SubtreeEnd;
+        std::vector<Ecs::EntityID> Entities;
+        // locals are staged here for the nodes being recalculated, globals persist across frames
+        std::vector<glm::mat4> LocalMatrices;
+        std::vector<glm::mat4> GlobalMatrices;
+        // all flags are cleared again by the propagation that consumes them
+        std::vector<std::uint8_t> Dirty;
+        std::vector<std::uint8_t> GlobalDirty;
+        std::vector<std::uint8_t> SubtreeDirty;
+        // refreshed every frame, components move around when their entity's archetype changes
+        std::vector<TransformComponent*> Components;
+
+    private:
+        // a detached subtree in depth first order, parents and ends relative to its first node
+        struct Subtree
+        {
+            std::vector<UUID> Ids;
+            std::vector<std::uint32_t> Parents;
+            std::vector<std::uint32_t> SubtreeEnd;
+            std::vector<Ecs::EntityID> Entities;
+            std::vector<glm::mat4> GlobalMatrices;
+            std::vector<TransformComponent*> Components;
+
+            void Clear();
+            std::uint32_t Append(UUID uuid, std::uint32_t parent, Ecs::EntityID entity, TransformComponent* tf);
+            // works out SubtreeEnd from Parents
+            void EndAppend();
+        };
+
+        // copies the scenegraph below the node into out, skipping anything the hierarchy already holds
+        void Collect(Scene const& scene, UUID root, Subtree& out) const;
+        // takes the node's subtree out of the hierarchy
+        void Extract(std::uint32_t index, Subtree& out);
+        // puts the subtree back in as the last child of parent
+        void Splice(Subtree const& subtree, std::uint32_t parent);
+        // applies one change the scene recorded
+        bool Sync(Scene const& scene, UUID uuid, Ecs::EntityID entity);
+        void SetEntityIndex(Ecs::EntityID entity, std::uint32_t index);
+        // keeps the flags and staged locals as long as the nodes, they are all clear between propagations
+        void ResizeFlags();
+
+        std::size_t m_version = std::numeric_limits<std::size_t>::max();
+        // hierarchy index by entity slot
+        std::vector<std::uint32_t> m_entityIndices;
+        // reused by Patch
+        Subtree m_subtree;
+    };
+}
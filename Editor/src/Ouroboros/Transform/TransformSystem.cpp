@@ -25,6 +25,7 @@ Technology is prohibited.
 #include <JobSystem/src/final/jobs.h>
 
 #include "Ouroboros/EventSystem/EventManager.h"
+#include "Ouroboros/Core/WorkerPool.h"
 
 namespace oo
 {
@@ -74,12 +75,10 @@ namespace oo
         else
         {
             // Reset all has changed to false regardless of their previous state.
+            // Done while gathering, which goes through every transform anyway.
             // Note: this should only occure once per frame. Otherwise wonky behaviour.
-            static Ecs::Query query = Ecs::make_query<TransformComponent>();
-            world->for_each(query, [&](TransformComponent& tf)
-            { 
-                tf.HasChangedThisFrame = false; 
-            });
+            m_resetChangedFlags = true;
+            m_changedThisFrame.clear();
         }
 
         UpdateEntireTree();
@@ -103,11 +102,70 @@ namespace oo
     {
         TRACY_PROFILE_SCOPE_NC(transform_update_entire_tree, tracy::Color::Gold3);
 
-        GenerateLaunchGroups();
+        // only the subtrees that changed are moved around, unless too much changed to tell
+        if (m_hierarchy.IsStale(*m_scene) && m_hierarchy.Patch(*m_scene) == false)
+            m_hierarchy.Rebuild(*m_scene);
 
-        UpdateLocalTransforms();
+        // a transform the hierarchy doesn't know about means a change went unreported, rebuild and gather again
+        if (GatherTransforms() == false)
+        {
+            m_hierarchy.Rebuild(*m_scene);
+            GatherTransforms();
+        }
+        m_resetChangedFlags = false;
 
-        UpdateLaunchGroups();
+        PropagateTransforms();
+
+        TRACY_PROFILE_SCOPE_END();
+    }
+
+    void TransformSystem::ResolveGlobalTransform(GameObject const& go)
+    {
+        TRACY_PROFILE_SCOPE_NC(transform_resolve_global, tracy::Color::Gold4);
+
+        // nothing anywhere was modified since this was last brought up to date
+        std::uint64_t const epoch = TransformComponent::ModificationEpoch();
+        if (go.Transform().ResolvedEpoch == epoch)
+        {
+            TRACY_PROFILE_SCOPE_END();
+            return;
+        }
+
+        // walk up until an ancestor known to be up to date since the last modification, everything above it is too
+        m_resolveChain.clear();
+        std::uint64_t parent_stamp = 0;
+        for (GameObject* curr = m_scene->FindRawWithInstanceID(go.GetInstanceID());
+            curr != nullptr && curr->GetInstanceID() != GameObject::ROOTID;
+            curr = m_scene->FindRawWithInstanceID(curr->GetParentUUID()))
+        {
+            TransformComponent const& tf = curr->Transform();
+            if (tf.ResolvedEpoch == epoch)
+            {
+                parent_stamp = tf.ResolvedStamp;
+                break;
+            }
+            m_resolveChain.emplace_back(curr);
+        }
+
+        // parents first. stale if modified, below something stale, or older than the last recalculation of its parent
+        std::uint64_t const stamp = ++m_resolveStamp;
+        bool stale = false;
+        for (std::size_t i = m_resolveChain.size(); i-- > 0;)
+        {
+            GameObject const& curr = *m_resolveChain[i];
+            TransformComponent& tf = curr.Transform();
+
+            stale = stale || tf.LocalMatrixDirty || tf.GlobalMatrixDirty || tf.ResolvedStamp < parent_stamp;
+            if (stale)
+            {
+                UpdateLocalTransform(tf);
+                UpdateTransform(curr);
+                // only this chain was recalculated, the next propagation still has to reach the rest of the subtree
+                tf.ResolvedStamp = stamp;
+            }
+            tf.ResolvedEpoch = epoch;
+            parent_stamp = tf.ResolvedStamp;
+        }
 
         TRACY_PROFILE_SCOPE_END();
     }
@@ -125,54 +183,183 @@ namespace oo
         TRACY_PROFILE_SCOPE_END();
     }
 
-    void TransformSystem::UpdateLocalTransforms()
+    bool TransformSystem::GatherTransforms()
     {
-        TRACY_PROFILE_SCOPE_NC(transform_local_transforms_update, tracy::Color::Gold4);
-        
-        // Update their local transform
-        static Ecs::Query query = Ecs::make_raw_query</*GameObjectComponent, */TransformComponent>();
-        m_world->parallel_for_each(query, [&](/*GameObjectComponent& goc,*/ TransformComponent& tf)
+        TRACY_PROFILE_SCOPE_NC(transform_gather, tracy::Color::Gold3);
+
+        std::atomic<bool> complete = true;
+
+        // components are refreshed for everything since their entities could have moved chunks since last frame
+        static Ecs::Query query = Ecs::make_raw_query<GameObjectComponent, TransformComponent>();
+        m_world->parallel_for_each(query, [&](Ecs::EntityID entity, GameObjectComponent& goc, TransformComponent& tf)
             {
-                // TODO: this part of the code doesn't need to be serial.
-                // Update local and global transform immediately
-                if (tf.LocalMatrixDirty)
+                std::uint32_t const index = m_hierarchy.IndexOf(entity);
+                if (m_hierarchy.Contains(index, goc.Id) == false)
+                {
+                    complete.store(false, std::memory_order_relaxed);
+                    return;
+                }
+
+                m_hierarchy.Components[index] = &tf;
+
+                if (m_resetChangedFlags)
+                    tf.HasChangedThisFrame = false;
+
+                if (tf.LocalMatrixDirty || tf.GlobalMatrixDirty || tf.ResolvedStamp != 0)
                 {
-                    //std::string debugName = goc.Name;
-                    tf.CalculateLocalTransform();
+                    m_hierarchy.MarkDirty(index, tf.GlobalMatrixDirty);
+                    tf.ResolvedStamp = 0;
                 }
             });
 
         TRACY_PROFILE_SCOPE_END();
+
+        return complete;
     }
 
-    void TransformSystem::UpdateLaunchGroups()
+    void TransformSystem::PropagateTransforms()
     {
-        // Transform System updates via the scenegraph because the order matters
+        // Transform System sweeps the depth first layout once, parents always come before their children.
+        // Only subtrees with something modified in them are descended into, the rest are skipped whole.
 
-        TRACY_PROFILE_SCOPE_NC(transform_update_launch_groups, tracy::Color::Gold3);
+        TRACY_PROFILE_SCOPE_NC(transform_propagate, tracy::Color::Gold3);
 
-        // Step 2. processing.
-        for (auto& group : launch_groups)
+        auto& dirty = m_hierarchy.Dirty;
+        auto& subtreeDirty = m_hierarchy.SubtreeDirty;
+        auto const& subtreeEnd = m_hierarchy.SubtreeEnd;
+        std::uint32_t const size = static_cast<std::uint32_t>(m_hierarchy.Size());
+
+        // nothing moved this time round
+        if (size == 0 || subtreeDirty[0] == 0)
         {
-            if (group.size() <= 0)
-                continue;
+            TRACY_PROFILE_SCOPE_END();
+            return;
+        }
 
-            TRACY_PROFILE_SCOPE_NC(per_batch_processing, tracy::Color::Goldenrod);
+        // Step 1. find the modified subtrees, everything under a modified node is recalculated too.
+        // small subtrees become ranges for the workers, the roots of bigger ones are done first on this thread.
+        m_heads.clear();
+        m_ranges.clear();
+        auto add_subtree = [&](std::uint32_t root)
+        {
+            std::uint32_t const end = subtreeEnd[root];
+            std::fill(dirty.begin() + root, dirty.begin() + end, std::uint8_t{ 1 });
 
-            std::for_each(std::execution::par_unseq, std::begin(group), std::end(group), [&](auto const& elem)
+            for (std::uint32_t i = root; i < end;)
+            {
+                std::uint32_t const next = subtreeEnd[i];
+                if (next - i > MinBatchSize)
                 {
-                    // Find current gameobject
-                    auto const go = m_scene->FindWithInstanceID(elem->get_handle());
-                    UpdateTransform(go);
-                });
+                    m_heads.emplace_back(i);
+                    ++i;
+                    continue;
+                }
 
+                // neighbouring subtrees share a range as long as it stays small
+                if (m_ranges.empty() == false && m_ranges.back().second == i && next - m_ranges.back().first <= MinBatchSize)
+                    m_ranges.back().second = next;
+                else
+                    m_ranges.emplace_back(i, next);
+                i = next;
+            }
+        };
+
+        // the root is never recalculated, only descended into
+        ClearHierarchyFlags(0, 1);
+        for (std::uint32_t i = 1; i < size;)
+        {
+            if (dirty[i])
+            {
+                add_subtree(i);
+                i = subtreeEnd[i];
+            }
+            else if (subtreeDirty[i])
+            {
+                subtreeDirty[i] = 0;
+                ++i;
+            }
+            else
+            {
+                i = subtreeEnd[i];
+            }
+        }
+
+        // Step 2. processing. a range only depends on heads and on nodes earlier in itself
+        for (std::uint32_t head : m_heads)
+            UpdateHierarchyRange(head, head + 1);
+
+        {
+            TRACY_PROFILE_SCOPE_NC(per_range_processing, tracy::Color::Goldenrod);
+
+            worker_pool::parallel_for(m_ranges.size(), 1, [&](std::size_t first, std::size_t last)
+                {
+                    for (std::size_t r = first; r < last; ++r)
+                        UpdateHierarchyRange(m_ranges[r].first, m_ranges[r].second);
+                });
 
             TRACY_PROFILE_SCOPE_END();
         }
 
+        // Step 3. report and reset what was processed
+        for (std::uint32_t head : m_heads)
+        {
+            m_changedThisFrame.emplace_back(m_hierarchy.Entities[head]);
+            ClearHierarchyFlags(head, head + 1);
+        }
+        for (auto [begin, end] : m_ranges)
+        {
+            m_changedThisFrame.insert(m_changedThisFrame.end(), m_hierarchy.Entities.begin() + begin, m_hierarchy.Entities.begin() + end);
+            ClearHierarchyFlags(begin, end);
+        }
+
         TRACY_PROFILE_SCOPE_END();
     }
 
+    void TransformSystem::UpdateHierarchyRange(std::uint32_t begin, std::uint32_t end)
+    {
+        auto const& globalDirty = m_hierarchy.GlobalDirty;
+        auto const& parents = m_hierarchy.Parents;
+        auto const& components = m_hierarchy.Components;
+        auto& locals = m_hierarchy.LocalMatrices;
+        auto& globals = m_hierarchy.GlobalMatrices;
+
+        // node by node, a parent in the range has to be done before its children read its global matrix
+        for (std::uint32_t i = begin; i < end; ++i)
+        {
+            TransformComponent& tf = *components[i];
+
+            // transforms whose global values were set work their locals out from the parent
+            if (globalDirty[i])
+            {
+                tf.CalculateGlobalTransform();
+                glm::mat4 parent_inverse = glm::affineInverse(globals[parents[i]]) * tf.GlobalTransform.Matrix;
+                tf.SetLocalTransform(parent_inverse);   // decompose to this values.
+                tf.LocalEulerAngles = glm::degrees(quaternion::to_euler(tf.LocalTransform.Orientation));// update fake values outside!
+            }
+            else if (tf.LocalMatrixDirty)
+            {
+                tf.CalculateLocalTransform();
+            }
+
+            locals[i] = tf.LocalTransform.Matrix;
+            globals[i] = globals[parents[i]] * locals[i];
+
+            if (globalDirty[i])
+                continue;
+
+            // write back to the component
+            tf.HasChangedThisFrame = true;
+            tf.GlobalTransform.Matrix = globals[i];
+            Transform3D::DecomposeValues(tf.GlobalTransform.Matrix, tf.GlobalTransform.Position, tf.GlobalTransform.Orientation.value, tf.GlobalTransform.Scale);
+        }
+    }
+
+    void TransformSystem::ClearHierarchyFlags(std::uint32_t begin, std::uint32_t end)
+    {
+        std::fill(m_hierarchy.Dirty.begin() + begin, m_hierarchy.Dirty.begin() + end, std::uint8_t{ 0 });
+        std::fill(m_hierarchy.GlobalDirty.begin() + begin, m_hierarchy.GlobalDirty.begin() + end, std::uint8_t{ 0 });
+        std::fill(m_hierarchy.SubtreeDirty.begin() + begin, m_hierarchy.SubtreeDirty.begin() + end, std::uint8_t{ 0 });
+    }
 
     void TransformSystem::UpdateTree(scenenode::shared_pointer node, bool updateRoot)
     {
@@ -191,8 +378,8 @@ namespace oo
         if (updateRoot)
         {
             // Find root gameobject
-            auto const go = m_scene->FindWithInstanceID(node->get_handle());
-            UpdateTransform(go);
+            auto const go = m_scene->FindRawWithInstanceID(node->get_handle());
+            UpdateTransform(*go);
         }
 
         /* Multithread Method of updating */
@@ -236,33 +423,53 @@ namespace oo
 
             TRACY_PROFILE_SCOPE_NC(per_batch_processing, tracy::Color::Goldenrod);
 
-            std::for_each(std::execution::par_unseq, std::begin(group), std::end(group), [&](auto const& elem)
+            worker_pool::parallel_for(group.size(), MinBatchSize, [&](std::size_t first, std::size_t last)
                 {
-                    // Find current gameobject
-                    auto const go = m_scene->FindWithInstanceID(elem->get_handle());
-                    UpdateTransform(go);
+                    for (std::size_t i = first; i < last; ++i)
+                    {
+                        // Find current gameobject
+                        auto const go = m_scene->FindRawWithInstanceID(group[i]->get_handle());
+                        UpdateTransform(*go);
+                    }
                 });
             
 
             TRACY_PROFILE_SCOPE_END();
         }
 
+        // Step 3. record what changed for the systems reading the changed list later this frame
+        auto record_changed = [&](scenenode::handle_type handle)
+        {
+            auto const go = m_scene->FindRawWithInstanceID(handle);
+            if (go->Transform().HasChangedThisFrame)
+                m_changedThisFrame.emplace_back(go->GetEntity());
+        };
+
+        if (updateRoot)
+            record_changed(node->get_handle());
+
+        for (auto& group : launch_groups)
+        {
+            for (auto const& elem : group)
+                record_changed(elem->get_handle());
+        }
+
         TRACY_PROFILE_SCOPE_END();
     }
 
-    void TransformSystem::UpdateTransform(std::shared_ptr<GameObject> const& go)
+    void TransformSystem::UpdateTransform(GameObject const& go)
     {
         TRACY_PROFILE_SCOPE_NC(per_transform_update, tracy::Color::Gold4);
 
         // Check for valid parent
         {
             TRACY_PROFILE_SCOPE_NC(transform_assert_check_duration, tracy::Color::Gold4);
-            ASSERT_MSG(m_scene->IsValid(go->GetParentUUID()) == false, "Assumes we always have proper parent");
+            ASSERT_MSG(m_scene->IsValid(go.GetParentUUID()) == false, "Assumes we always have proper parent");
             TRACY_PROFILE_SCOPE_END();
         }
 
-        auto& tf = go->Transform();
-        auto& parentTf = m_scene->FindWithInstanceID(go->GetParentUUID())->Transform();
+        auto& tf = go.Transform();
+        auto& parentTf = m_scene->FindRawWithInstanceID(go.GetParentUUID())->Transform();
 
         /// all parents need to be sure to be updated first.
         if (tf.GlobalMatrixDirty)
@@ -288,6 +495,11 @@ namespace oo
                 
             TRACY_PROFILE_SCOPE_END();
         }
+
+        // keep the flattened hierarchy in sync, the next propagation reads parents from it
+        std::uint32_t const index = m_hierarchy.IndexOf(go.GetEntity());
+        if (m_hierarchy.Contains(index, go.GetInstanceID()))
+            m_hierarchy.GlobalMatrices[index] = tf.GlobalTransform.Matrix;
         
         TRACY_PROFILE_SCOPE_END();
     }
@@ -297,74 +509,11 @@ namespace oo
         // check for lights
         auto go = m_scene->FindWithInstanceID(e->Id);
         // assumption: Everything should have transform!
-        go->Transform().LocalMatrixDirty = true;
+        go->Transform().MarkLocalDirty();
         //auto& tf = go->Transform().LocalMatrixDirty = true;
         //tf.SetPosition(tf.GetPosition());
     }
 
-    void TransformSystem::GenerateLaunchGroups()
-    {
-        TRACY_PROFILE_SCOPE_NC(transform_determine_dirty, tracy::Color::Gold3);
-        // gather a set of unique ids that are currently dirty rn.
-        std::set<scenenode::handle_type> dirtyIDs{};
-        static Ecs::Query query = Ecs::make_raw_query<GameObjectComponent, TransformComponent>();
-        m_world->for_each(query, [&](GameObjectComponent& goc, TransformComponent& tf)
-        {
-            auto node = goc.Node.lock();
-            if (tf.LocalMatrixDirty || tf.GlobalMatrixDirty)
-            {
-                dirtyIDs.emplace(node->get_handle());
-            }
-        });
-        TRACY_PROFILE_SCOPE_END();
-
-        TRACY_PROFILE_SCOPE_NC(transform_assemble_launch_groups, tracy::Color::Gold3);
-        
-        // reset groups
-        for (auto& group : launch_groups)
-            group.clear();
-
-        // go through scene graph and determine what needs to be launched and updated
-        auto const& graph = m_scene->GetGraph();
-        scenegraph::shared_pointer root_node = graph.get_root();
-        scenenode::shared_pointer curr = root_node;
-
-        std::stack<std::pair<scenegraph::shared_pointer, int>> stk{};
-        auto firstLevelChilds = curr->get_direct_child();
-        std::for_each(firstLevelChilds.begin(), firstLevelChilds.end(), [&](auto&& child)
-        {
-            stk.push({ child, 0 });
-        });
-
-        while (!stk.empty())
-        {
-            auto& [node, hierarchyLevel] = stk.top();
-            stk.pop();
-            
-            bool isDirty = dirtyIDs.contains(node->get_handle());
-            if (hierarchyLevel == 0 && isDirty)
-            {
-                launch_groups[hierarchyLevel].emplace_back(node);
-            }
-
-            auto childs = node->get_direct_child();
-            auto childLevel = hierarchyLevel;
-
-            if (hierarchyLevel > 0 || isDirty)
-            {
-                childLevel += 1;
-                launch_groups[childLevel].insert(launch_groups[childLevel].end(), childs.begin(), childs.end());
-            }
-            
-            std::for_each(childs.begin(), childs.end(), [&](auto&& child)
-            {
-                stk.push({ child, childLevel });
-            });
-
-        }
-        TRACY_PROFILE_SCOPE_END();
-    }
-
     //void TransformSystem::StartOfFramePreprocessing()
     //{
     //    TRACY_PROFILE_SCOPE_NC(start_of_frame_preprocessing, tracy::Color::Gold4);
@@ -16,6 +16,7 @@ Technology is prohibited.
 
 #include <Ouroboros/ECS/GameObject.h>
 #include <Ouroboros/Transform/TransformComponent.h>
+#include <Ouroboros/Transform/TransformHierarchy.h>
 
 namespace oo
 {
@@ -34,18 +35,31 @@ namespace oo
         void UpdateSubTree(GameObject go, bool includeItself = true);
         void UpdateEntireTree();
 
+        // Brings this transform's global values, and its local values if a global one was set, up to date
+        // right away. Only the chain from its topmost modified ancestor down is recalculated, and nothing is walked
+        // at all if no transform was modified since it was last brought up to date. The recalculated transforms are
+        // stamped so the next UpdateEntireTree still carries the change to the rest of their subtrees.
+        void ResolveGlobalTransform(GameObject const& go);
+
+        // Entities whose global transform changed since the start of this frame, in no particular order.
+        // Systems that only care about moved transforms go through this instead of checking every HasChangedThisFrame.
+        // Entities may show up more than once and may have been destroyed since.
+        std::vector<Ecs::EntityID> const& GetChangedThisFrame() const { return m_changedThisFrame; }
+
         //void UpdateTransformHierarchy();
 
     private:
 
-        void GenerateLaunchGroups();
-        void UpdateLocalTransforms();
-        void UpdateLaunchGroups(); 
-        
+        // returns false if a transform turned up that the hierarchy doesn't know about
+        bool GatherTransforms();
+        void PropagateTransforms();
+        void UpdateHierarchyRange(std::uint32_t begin, std::uint32_t end);
+        void ClearHierarchyFlags(std::uint32_t begin, std::uint32_t end);
+
         void UpdateTree(scenenode::shared_pointer node, bool updateRoot);
 
         void UpdateLocalTransform(TransformComponent& tf);
-        void UpdateTransform(std::shared_ptr<GameObject> const& go);
+        void UpdateTransform(GameObject const& go);
         void OnEnableGameObject(GameObjectComponent::OnEnableEvent* e);
 
     private:
@@ -55,10 +69,23 @@ namespace oo
 
         // im not expecting anything that's nested beyond 32 depth. its possible but freaking unlikely
         static constexpr std::size_t MaxDepth = 32;
-        std::array<std::vector<scenegraph::shared_pointer>, MaxDepth> launch_groups;
-        
-        // extra info stored for preprocessing
-        std::stack<scenenode::shared_pointer> stk;
+
+        // subtrees up to this size are handed to a worker whole, bigger ones are split below their root
+        static constexpr std::size_t MinBatchSize = 256;
+        TransformHierarchy m_hierarchy;
+
+        using IndexRange = std::pair<std::uint32_t, std::uint32_t>;
+        // modified subtrees found by the sweep, kept around to reuse their memory
+        std::vector<IndexRange> m_ranges;
+        std::vector<std::uint32_t> m_heads;
+
+        std::vector<Ecs::EntityID> m_changedThisFrame;
+        bool m_resetChangedFlags = false;
+
+        // reused by ResolveGlobalTransform
+        std::vector<GameObject*> m_resolveChain;
+        // orders the chains ResolveGlobalTransform recalculated, see TransformComponent::ResolvedStamp
+        std::uint64_t m_resolveStamp = 0;
 
     };
 }
@@ -22,6 +22,7 @@ Technology is prohibited.
 
 #include "Ouroboros/Core/Application.h"
 #include "Ouroboros/ECS/ECS.h"
+#include "Ouroboros/Transform/TransformSystem.h"
 #include "RectTransformComponent.h"
 #include "UIRaycastComponent.h"
 #include "UIImageComponent.h"
@@ -184,11 +185,6 @@ namespace oo
             {
                 auto& ui = m_graphicsWorld->GetUIInstance(uiComp.UI_ID);
 
-                if (transformComp.HasChangedThisFrame)
-                {
-                    ui.localToWorld = transformComp.GetGlobalMatrix();
-                }
-
                 if (rectTfComp.HasChanged)
                 {
                     glm::vec3 Center = rectTfComp.BoundingVolume.Center;
@@ -224,6 +220,17 @@ namespace oo
                 ui.colour = uiImageComp.Tint;
                 ui.bindlessGlobalTextureIndex_Albedo = uiImageComp.AlbedoID;
             });
+
+        // only transforms that moved this frame need to be pushed over
+        for (Ecs::EntityID entity : m_world->Get_System<TransformSystem>()->GetChangedThisFrame())
+        {
+            if (m_world->matches_query(entity, ui_query) == false)
+                continue;
+
+            auto& uiComp = m_world->get_component<UIComponent>(entity);
+            auto& transformComp = m_world->get_component<TransformComponent>(entity);
+            m_graphicsWorld->GetUIInstance(uiComp.UI_ID).localToWorld = transformComp.GetGlobalMatrix();
+        }
     }
 
 
@@ -321,7 +328,7 @@ namespace oo
 
                 
                 // retrieve canvas gameobject
-                auto go = m_scene->FindWithInstanceID(goc.Id);
+                auto go = m_scene->FindRawWithInstanceID(goc.Id);
                 bool CanvasIsWorldSpace = canvas.RenderingMode == UICanvasComponent::RenderMode::WorldSpace;
                 //bool CanvasIsCanvasSpace = canvas.RenderingMode == UICanvasComponent::RenderMode::CanvasSpace;
                 for (auto& child : go->GetChildren(true))
@@ -525,7 +532,7 @@ namespace oo
         m_world->for_each(canvas_with_raycaster_query, [&](GameObjectComponent& goc, TransformComponent& tf, UICanvasComponent& canvas, GraphicsRaycasterComponent& raycaster)
             {
                 // retrieve canvas gameobject
-                auto go = m_scene->FindWithInstanceID(goc.Id);
+                auto go = m_scene->FindRawWithInstanceID(goc.Id);
 
                 // Iterate through and update all childs in REVERSE
                 auto childs = go->GetChildren(true);
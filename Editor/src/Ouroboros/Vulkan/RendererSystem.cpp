@@ -33,6 +33,7 @@ Technology is prohibited.
 #include "Ouroboros/EventSystem/EventTypes.h"
 #include "Ouroboros/ECS/GameObjectComponent.h"
 #include "Ouroboros/Vulkan/GlobalRendererSettings.h"
+#include "Ouroboros/Transform/TransformSystem.h"
 
 #include "Ouroboros/ECS/GameObject.h"
 namespace oo
@@ -76,9 +77,6 @@ namespace oo
                 actualObject.bindlessGlobalTextureIndex_Emissive = m_comp.EmissiveID;
                 actualObject.emissiveColour = m_comp.EmissiveColor;
 
-                if (transformComp.HasChangedThisFrame)
-                    actualObject.localToWorld = transformComp.GlobalTransform;
-
                 actualObject.SetShadowCaster(m_comp.CastShadows);
                 actualObject.SetShadowEnabled(m_comp.CastShadows);
                 actualObject.SetShadowReciever(m_comp.ReceiveShadows);
@@ -90,9 +88,6 @@ namespace oo
             {
                 auto& graphics_light = m_graphicsWorld->GetLightInstance(lightComp.Light_ID);
 
-                if (transformComp.HasChangedThisFrame)
-                    graphics_light.position = glm::vec4{ transformComp.GetGlobalPosition(), 0.f };
-
                 graphics_light.color = glm::vec4{ lightComp.Color.r, lightComp.Color.g, lightComp.Color.b, lightComp.Intensity };
                 graphics_light.radius = vec4{ lightComp.Radius, 0, 0, 0 };
 
@@ -100,6 +95,24 @@ namespace oo
                 SetLightEnabled(graphics_light, true);
                 SetCastsShadows(graphics_light, lightComp.ProduceShadows);
             });
+
+        // only transforms that moved this frame need to be pushed over
+        for (Ecs::EntityID entity : m_world->Get_System<TransformSystem>()->GetChangedThisFrame())
+        {
+            if (m_world->matches_query(entity, mesh_query))
+            {
+                auto& m_comp = m_world->get_component<MeshRendererComponent>(entity);
+                auto& transformComp = m_world->get_component<TransformComponent>(entity);
+                m_graphicsWorld->GetObjectInstance(m_comp.GraphicsWorldID).localToWorld = transformComp.GlobalTransform;
+            }
+
+            if (m_world->matches_query(entity, light_query))
+            {
+                auto& lightComp = m_world->get_component<LightComponent>(entity);
+                auto& transformComp = m_world->get_component<TransformComponent>(entity);
+                m_graphicsWorld->GetLightInstance(lightComp.Light_ID).position = glm::vec4{ transformComp.GetGlobalPosition(), 0.f };
+            }
+        }
     }
 
     void RendererSystem::OnScreenResize(WindowResizeEvent* e)
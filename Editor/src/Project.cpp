@@ -23,6 +23,8 @@
 
 #include "Ouroboros/Physics/RigidbodyComponent.h"
 #include <Ouroboros/Physics/PhysicsSystem.h>
+#include "Ouroboros/Physics/PhysicsDispatcher.h"
+#include "Ouroboros/Core/WorkerPool.h"
 void Project::LoadProject(std::filesystem::path& config)
 {
 	static bool run_once = []() {	oo::EventManager::Subscribe<CloseProjectEvent>([](CloseProjectEvent*) {SaveProject(); }); return true; }();
@@ -49,6 +51,12 @@ void Project::LoadProject(std::filesystem::path& config)
 	s_scriptmodulePath = (*prj_setting).value.FindMember("ScriptModulePath")->value.GetString();
 	s_scriptbuildPath = (*prj_setting).value.FindMember("ScriptBuildPath")->value.GetString();
 
+	//threading settings go first, asset and scene loading below already use the worker pool
+	if (doc.HasMember("Threading Settings"))
+	{
+		LoadThreadingSettings(doc.FindMember("Threading Settings")->value);
+	}
+
 	//load assets here
 	std::filesystem::path hard_assetfolderpath = GetAssetFolder();
 	s_AssetManager = std::make_shared<oo::AssetManager>(hard_assetfolderpath);
@@ -499,6 +507,22 @@ void Project::LoadRenderer(rapidjson::Value& val)
 	}
 }
 
+void Project::LoadThreadingSettings(rapidjson::Value& val)
+{
+	std::size_t worker_threads = 0; // 0 lets the pool size itself to the machine
+	std::uint64_t affinity_mask = 0;
+	if (val.HasMember("WorkerThreads"))
+		worker_threads = val["WorkerThreads"].GetUint();
+	if (val.HasMember("WorkerAffinityMask"))
+		affinity_mask = val["WorkerAffinityMask"].GetUint64();
+	if (val.HasMember("PhysicsWorkers"))
+		oo::PhysicsDispatcher::Instance().SetMaxWorkers(val["PhysicsWorkers"].GetUint());
+
+	//tasks still queued (such as asset decodes) run before the old threads go, so the pool can be restarted with the new configuration
+	oo::worker_pool::terminate();
+	oo::worker_pool::init(worker_threads, affinity_mask);
+}
+
 void Project::SaveRendererSetting(rapidjson::Value& val,rttr::property _prop, rttr::variant v, rapidjson::Document& doc)
 {
 	static SerializerSaveProperties saveProperties;
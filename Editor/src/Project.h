@@ -41,6 +41,7 @@ private:
 	
 	static void LoadRendererSetting(rapidjson::Value& val, rttr::variant& v);
 	static void LoadRenderer(rapidjson::Value& val);
+	static void LoadThreadingSettings(rapidjson::Value& val);
 
 	static void SaveRendererSetting(rapidjson::Value& val, rttr::property prop ,rttr::variant v, rapidjson::Document& doc);
 	static void SaveRenderer(rapidjson::Value& val, rapidjson::Document& doc);
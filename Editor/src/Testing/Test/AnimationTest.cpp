@@ -0,0 +1,90 @@
+/************************************************************************************//*!
+\file           AnimationTest.cpp
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Tests the kernels skeletons blend whole poses with against plain glm
+                blends of the same bones.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#include <pch.h>
+
+#include <random>
+
+#include <Ouroboros/Animation/AnimationPoseBlend.h>
+
+#include "EngineTests.h"
+
+namespace
+{
+    float distance(glm::quat const& a, glm::quat const& b)
+    {
+        return glm::length(glm::vec4{ a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w });
+    }
+}
+
+// Blends random poses through the whole pose kernels and compares every bone to blending it on its own
+// with glm. Bone counts that are not a multiple of the vector width cover the scalar tail, and the
+// output is also written over the first input, which is how BlendPoses blends into a pose it reads.
+bool AnimationPoseBlendTest()
+{
+    using namespace oo::Anim::internal;
+
+    constexpr char const* test = "Animation Pose Blend";
+    constexpr float epsilon = 1e-5f;
+
+    std::mt19937 rng{ 12345 };
+    std::uniform_real_distribution<float> dist{ -1.f, 1.f };
+
+    bool passed = true;
+    for (std::size_t bone_count : { 1, 3, 4, 37, 60 })
+    {
+        std::vector<glm::quat> rotations_a(bone_count), rotations_b(bone_count), rotations_out(bone_count);
+        std::vector<glm::vec3> positions_a(bone_count), positions_b(bone_count), positions_out(bone_count);
+        for (std::size_t i = 0; i < bone_count; ++i)
+        {
+            rotations_a[i] = glm::normalize(glm::quat{ dist(rng), dist(rng), dist(rng), dist(rng) });
+            rotations_b[i] = glm::normalize(glm::quat{ dist(rng), dist(rng), dist(rng), dist(rng) });
+            positions_a[i] = glm::vec3{ dist(rng), dist(rng), dist(rng) } * 10.f;
+            positions_b[i] = glm::vec3{ dist(rng), dist(rng), dist(rng) } * 10.f;
+        }
+
+        for (float weight : { 0.f, 0.3f, 0.5f, 1.f })
+        {
+            NlerpQuats(rotations_out.data(), rotations_a.data(), rotations_b.data(), bone_count, weight);
+            BlendVec3s(positions_out.data(), positions_a.data(), positions_b.data(), bone_count, weight);
+
+            float rotation_error = 0.f, length_error = 0.f, position_error = 0.f;
+            for (std::size_t i = 0; i < bone_count; ++i)
+            {
+                // b on a's hemisphere, the same rotation either way but the short way round
+                glm::quat const b = glm::dot(rotations_a[i], rotations_b[i]) < 0.f ? -rotations_b[i] : rotations_b[i];
+                glm::quat const expected = glm::normalize(rotations_a[i] * (1.f - weight) + b * weight);
+                rotation_error = std::max(rotation_error, distance(expected, rotations_out[i]));
+                length_error = std::max(length_error, std::abs(glm::length(rotations_out[i]) - 1.f));
+                position_error = std::max(position_error, glm::length(glm::mix(positions_a[i], positions_b[i], weight) - positions_out[i]));
+            }
+            passed &= TestCheck(rotation_error < epsilon, test, "blended rotations differ from a normalized lerp of the bones");
+            passed &= TestCheck(length_error < epsilon, test, "blended rotations are not unit length");
+            passed &= TestCheck(position_error < epsilon * 10.f, test, "blended positions differ from a lerp of the bones");
+        }
+
+        // blending into the first input
+        std::vector<glm::quat> rotations_in_place = rotations_a;
+        std::vector<glm::vec3> positions_in_place = positions_a;
+        NlerpQuats(rotations_out.data(), rotations_a.data(), rotations_b.data(), bone_count, 0.3f);
+        BlendVec3s(positions_out.data(), positions_a.data(), positions_b.data(), bone_count, 0.3f);
+        NlerpQuats(rotations_in_place.data(), rotations_in_place.data(), rotations_b.data(), bone_count, 0.3f);
+        BlendVec3s(positions_in_place.data(), positions_in_place.data(), positions_b.data(), bone_count, 0.3f);
+        passed &= TestCheck(rotations_in_place == rotations_out && positions_in_place == positions_out, test, "blending into an input gives a different result");
+    }
+
+    if (passed)
+        LOG_INFO("[{0}] passed", test);
+    return passed;
+}
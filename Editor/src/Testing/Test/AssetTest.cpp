@@ -0,0 +1,204 @@
+/************************************************************************************//*!
+\file           AssetTest.cpp
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Tests that the persisted asset index refuses damaged files, and that
+                the asset loader finishes cancelled requests and loads models before
+                the animations that depend on them.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#include <pch.h>
+
+#include <Ouroboros/Asset/AssetIndex.h>
+#include <Ouroboros/Asset/AssetLoader.h>
+
+#include "EngineTests.h"
+
+namespace
+{
+    void write_file(const std::filesystem::path& fp, std::string_view content)
+    {
+        std::ofstream ofs{ fp, std::ios::binary | std::ios::trunc };
+        ofs.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+
+    // completes loads on this thread until every request is done, false if that took too long
+    bool pump(oo::AssetLoader& loader, const std::vector<oo::AssetLoader::ProgressPtr>& requests,
+              std::chrono::seconds timeout, const std::function<void()>& afterUpload = {})
+    {
+        const auto START = std::chrono::steady_clock::now();
+        while (std::any_of(requests.begin(), requests.end(), [](const auto& request) { return !request->done(); }))
+        {
+            if (std::chrono::steady_clock::now() - START > timeout)
+                return false;
+            // a budget of nothing completes exactly one load per call
+            loader.Upload(std::chrono::microseconds{ 0 });
+            if (afterUpload)
+                afterUpload();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+}
+
+// Scans a few files, saves the index and loads it back, which has to find the same IDs and no changes.
+// Then every prefix of the saved file is loaded in turn, each has to be refused and leave the record empty.
+bool AssetIndexTest(const std::filesystem::path& scratch)
+{
+    constexpr char const* test = "Asset Index";
+
+    const std::filesystem::path root = scratch / "index";
+    const std::filesystem::path indexFile = scratch / "index.bin";
+    std::filesystem::create_directories(root / "folder");
+    write_file(root / "a.txt", "a");
+    write_file(root / "folder" / "b.txt", "bb");
+    write_file(root / "folder" / "c.txt", "ccc");
+    const std::vector<std::filesystem::path> files{ "a.txt", "folder", "folder/b.txt", "folder/c.txt" };
+
+    bool passed = true;
+
+    oo::AssetIndex scanned{ root };
+    const auto ADDED = scanned.Scan();
+    passed &= TestCheck(ADDED.size() == files.size() && std::all_of(ADDED.begin(), ADDED.end(),
+        [](const auto& change) { return change.kind == oo::AssetIndex::Change::Kind::Added; }), test, "first scan did not add every file once");
+    passed &= TestCheck(scanned.Save(indexFile), test, "index could not be saved");
+
+    std::vector<oo::AssetID> ids;
+    for (const auto& file : files)
+        ids.emplace_back(scanned.Find(file).value_or(oo::Asset::ID_NULL));
+    passed &= TestCheck(std::find(ids.begin(), ids.end(), oo::Asset::ID_NULL) == ids.end(), test, "scanned files were not recorded");
+
+    oo::AssetIndex loaded{ root };
+    passed &= TestCheck(loaded.Load(indexFile), test, "saved index could not be loaded");
+    bool sameIDs = true;
+    for (size_t i = 0; i < files.size(); ++i)
+        sameIDs &= loaded.Find(files[i]).value_or(oo::Asset::ID_NULL) == ids[i];
+    passed &= TestCheck(sameIDs, test, "loaded index records different IDs");
+    passed &= TestCheck(loaded.Scan().empty(), test, "scan after loading the index reported changes to untouched files");
+
+    std::string saved;
+    {
+        std::ifstream ifs{ indexFile, std::ios::binary };
+        saved.assign(std::istreambuf_iterator<char>{ ifs }, std::istreambuf_iterator<char>{});
+    }
+    size_t accepted = 0, leftovers = 0;
+    for (size_t length = 0; length < saved.size(); ++length)
+    {
+        write_file(indexFile, std::string_view{ saved }.substr(0, length));
+        oo::AssetIndex truncated{ root };
+        // something already recorded has to be dropped as well
+        truncated.Scan();
+        accepted += truncated.Load(indexFile);
+        leftovers += truncated.Find(files.front()).has_value();
+    }
+    passed &= TestCheck(accepted == 0, test, "a truncated index file was loaded");
+    passed &= TestCheck(leftovers == 0, test, "a refused index file left entries in the record");
+
+    if (passed)
+        LOG_INFO("[{0}] passed, {1} truncations refused", test, saved.size());
+    return passed;
+}
+
+// Loads a batch of files, with a second request wanting one of them, and cancels the batch straight away.
+// Both requests have to finish, and the asset the second request wants has to be loaded regardless.
+bool AssetLoaderCancelTest(const std::filesystem::path& scratch)
+{
+    constexpr char const* test = "Asset Loader Cancel";
+    constexpr size_t fileCount = 50;
+
+    const std::filesystem::path dir = scratch / "loader";
+    std::filesystem::create_directories(dir);
+    std::vector<oo::AssetLoader::AssetInfoPtr> infos;
+    for (size_t i = 0; i < fileCount; ++i)
+    {
+        auto info = std::make_shared<oo::AssetInfo>();
+        info->id = i + 1;
+        info->contentPath = dir / ("file" + std::to_string(i) + ".txt");
+        write_file(info->contentPath, std::to_string(i));
+        infos.emplace_back(std::move(info));
+    }
+
+    bool passed = true;
+    {
+        oo::AssetLoader loader{ []() {} };
+        auto batch = loader.Load(infos);
+        auto wanted = loader.Load({ infos.back() }, oo::AssetLoader::PRIORITY_LOW);
+        batch->cancel();
+
+        passed &= TestCheck(pump(loader, { batch, wanted }, std::chrono::seconds{ 10 }), test, "a cancelled request never finished");
+        passed &= TestCheck(batch->loadedCount == fileCount && wanted->loadedCount == 1, test, "requests counted the wrong number of assets");
+        passed &= TestCheck(infos.back()->isDataLoaded, test, "an asset another request still wanted was skipped");
+
+        // already loaded, so done without going through the loader
+        auto again = loader.Load({ infos.back(), nullptr });
+        passed &= TestCheck(again->done(), test, "loaded and null assets were not counted as done");
+    }
+
+    if (passed)
+    {
+        const auto SKIPPED = std::count_if(infos.begin(), infos.end(), [](const auto& info) { return !info->isDataLoaded; });
+        LOG_INFO("[{0}] passed, {1} of {2} skipped", test, SKIPPED, fileCount);
+    }
+    return passed;
+}
+
+// Loads a few models and animations from under assets through a loader of its own, animations requested
+// first. Loads are completed one at a time, and no animation may complete while a model has yet to.
+bool AssetLoaderOrderTest(const std::filesystem::path& assets)
+{
+    constexpr char const* test = "Asset Loader Order";
+    constexpr size_t perType = 4;
+
+    std::vector<oo::AssetLoader::AssetInfoPtr> models, animations;
+    std::error_code ec;
+    for (auto it = std::filesystem::recursive_directory_iterator(assets, ec); !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec))
+    {
+        if (!it->is_regular_file())
+            continue;
+        auto info = std::make_shared<oo::AssetInfo>();
+        info->contentPath = it->path();
+        const auto TYPE = info->GetType();
+        auto& list = TYPE == oo::AssetInfo::Type::Model ? models : animations;
+        if ((TYPE != oo::AssetInfo::Type::Model && TYPE != oo::AssetInfo::Type::Animation) || list.size() >= perType)
+            continue;
+        // IDs of their own, so nothing the project loaded is replaced or released
+        info->id = oo::AssetInfo::GenerateSnowflake();
+        list.emplace_back(std::move(info));
+    }
+    if (models.empty() || animations.empty())
+    {
+        LOG_INFO("[{0}] skipped, {1} needs both models and animations", test, assets.string());
+        return true;
+    }
+
+    std::vector<oo::AssetLoader::AssetInfoPtr> requested = animations;
+    requested.insert(requested.end(), models.begin(), models.end());
+
+    bool passed = true;
+    bool ordered = true;
+    {
+        oo::AssetLoader loader{ []() {} };
+        auto progress = loader.Load(requested);
+        passed &= TestCheck(pump(loader, { progress }, std::chrono::seconds{ 60 }, [&]()
+        {
+            const bool ANY_ANIMATION = std::any_of(animations.begin(), animations.end(), [](const auto& info) { return info->isDataLoaded; });
+            const bool ALL_MODELS = std::all_of(models.begin(), models.end(), [](const auto& info) { return info->isDataLoaded; });
+            ordered &= !ANY_ANIMATION || ALL_MODELS;
+        }), test, "loads never finished");
+    }
+    passed &= TestCheck(ordered, test, "an animation finished loading before every model had");
+    passed &= TestCheck(std::all_of(requested.begin(), requested.end(), [](const auto& info) { return info->isDataLoaded; }), test, "not every asset was loaded");
+
+    for (auto& info : requested)
+        info->Unload();
+
+    if (passed)
+        LOG_INFO("[{0}] passed, {1} models and {2} animations", test, models.size(), animations.size());
+    return passed;
+}
@@ -0,0 +1,183 @@
+/************************************************************************************//*!
+\file           ECSTest.cpp
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Tests that commands recorded into the ECS command buffers play back in
+                their documented order, and that batched spawns and destroys leave the
+                surviving entities intact.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#include <pch.h>
+
+#include <Ouroboros/ECS/ArchtypeECS/A_Ecs.h>
+
+#include "EngineTests.h"
+
+namespace
+{
+    struct TestValue { int value = 0; };
+    struct TestTag {};
+    struct TestSpawned { int from = 0; };
+}
+
+// Records two commands per entity from parallel_for_each, keyed in the reverse of the entities' layout,
+// along with adds, destroys and creates for some of them. Playback has to follow the keys and keep the
+// two commands of an entity in the order they were recorded, and the structural changes must all land.
+bool ECSCommandBufferTest()
+{
+    constexpr char const* test = "ECS Command Buffer";
+    constexpr int entity_count = 5000;
+
+    Ecs::IECSWorld world;
+    std::vector<Ecs::EntityID> entities;
+    world.new_entities<TestValue>(entity_count, entities);
+    for (int i = 0; i < entity_count; ++i)
+        world.get_component<TestValue>(entities[i]).value = i;
+
+    std::vector<int> played;
+    Ecs::Query query;
+    query.with<TestValue>().build();
+    world.parallel_for_each(query, 64, [&](TestValue& v)
+    {
+        int const i = v.value;
+        auto& commands = world.get_command_buffer();
+        std::uint64_t const key = static_cast<std::uint64_t>(entity_count - i);
+        commands.enqueue(key, [&played, i](Ecs::IECSWorld&) { played.emplace_back(2 * i); });
+        commands.enqueue(key, [&played, i](Ecs::IECSWorld&) { played.emplace_back(2 * i + 1); });
+
+        // added before it is destroyed, same key and thread so the destroy plays back last
+        if (i % 3 == 0)
+            commands.add_component<TestTag>(key, entities[i]);
+        if (i % 5 == 0)
+            commands.destroy(key, entities[i]);
+        if (i % 7 == 0)
+            commands.create<TestSpawned>(key, [i](Ecs::IECSWorld& w, Ecs::EntityID id) { w.get_component<TestSpawned>(id).from = i; });
+    });
+
+    // recorded during playback, so it has to wait for the next one
+    bool deferred_ran = false;
+    world.get_command_buffer().enqueue(0, [&deferred_ran](Ecs::IECSWorld& w)
+    {
+        w.get_command_buffer().enqueue(0, [&deferred_ran](Ecs::IECSWorld&) { deferred_ran = true; });
+    });
+    world.playback_commands();
+
+    bool passed = true;
+
+    std::vector<int> expected;
+    expected.reserve(entity_count * 2);
+    for (int i = entity_count - 1; i >= 0; --i)
+    {
+        expected.emplace_back(2 * i);
+        expected.emplace_back(2 * i + 1);
+    }
+    passed &= TestCheck(played == expected, test, "commands did not play back by sort key then recording order");
+    passed &= TestCheck(deferred_ran == false, test, "a command recorded during playback ran in the same playback");
+
+    int live = 0, tagged = 0, spawned = 0;
+    std::int64_t spawned_from = 0;
+    int expected_live = 0, expected_tagged = 0, expected_spawned = 0;
+    std::int64_t expected_from = 0;
+    bool destroys_applied = true;
+    for (int i = 0; i < entity_count; ++i)
+    {
+        expected_live += i % 5 != 0;
+        expected_tagged += i % 3 == 0 && i % 5 != 0;
+        if (i % 7 == 0)
+        {
+            ++expected_spawned;
+            expected_from += i;
+        }
+        destroys_applied &= (i % 5 == 0) != world.matches_query(entities[i], query);
+    }
+    world.for_each(query, [&](TestValue&) { ++live; });
+    Ecs::Query tag_query;
+    tag_query.with<TestTag>().build();
+    world.for_each(tag_query, [&](TestTag&) { ++tagged; });
+    Ecs::Query spawned_query;
+    spawned_query.with<TestSpawned>().build();
+    world.for_each(spawned_query, [&](TestSpawned& s) { ++spawned; spawned_from += s.from; });
+
+    passed &= TestCheck(destroys_applied, test, "a recorded destroy was not applied to the right entity");
+    passed &= TestCheck(live == expected_live, test, "wrong number of entities left after recorded destroys");
+    passed &= TestCheck(tagged == expected_tagged, test, "wrong number of entities carry a recorded component");
+    passed &= TestCheck(spawned == expected_spawned && spawned_from == expected_from, test, "recorded creates did not run their callbacks once each");
+
+    world.playback_commands();
+    passed &= TestCheck(deferred_ran, test, "a command recorded during playback never ran");
+    passed &= TestCheck(world.get_command_buffer().empty(), test, "command buffer not empty after playback");
+
+    if (passed)
+        LOG_INFO("[{0}] passed, {1} entities", test, entity_count);
+    return passed;
+}
+
+// Spawns entities in one batch, destroys every other one in another, then spawns again. The survivors
+// must keep their components and the destroyed IDs must stay invalid once their slots are reused.
+bool ECSBatchSpawnDestroyTest()
+{
+    constexpr char const* test = "ECS Batch Spawn Destroy";
+    constexpr int entity_count = 10000;
+
+    Ecs::IECSWorld world;
+    std::vector<Ecs::EntityID> entities;
+    world.new_entities<TestValue, TestTag>(entity_count, entities);
+    for (int i = 0; i < entity_count; ++i)
+        world.get_component<TestValue>(entities[i]).value = i;
+
+    Ecs::Query value_query;
+    value_query.with<TestValue>().build();
+
+    std::vector<Ecs::EntityID> destroyed;
+    for (int i = 0; i < entity_count; i += 2)
+        destroyed.emplace_back(entities[i]);
+    world.destroy(destroyed);
+
+    std::vector<Ecs::EntityID> respawned;
+    world.new_entities<TestValue>(entity_count / 2, respawned);
+
+    bool passed = true;
+    passed &= TestCheck(entities.size() == entity_count && respawned.size() == entity_count / 2, test, "new_entities returned the wrong number of IDs");
+
+    for (int i = 1; i < entity_count; i += 2)
+    {
+        if (world.matches_query(entities[i], value_query) == false || world.get_component<TestValue>(entities[i]).value != i)
+        {
+            passed &= TestCheck(false, test, "a surviving entity lost its components");
+            break;
+        }
+    }
+    for (auto id : destroyed)
+    {
+        if (world.matches_query(id, value_query))
+        {
+            passed &= TestCheck(false, test, "a destroyed ID is still valid after its slot was reused");
+            break;
+        }
+    }
+    for (auto id : respawned)
+    {
+        if (world.get_component<TestValue>(id).value != 0 || world.has_component<TestTag>(id))
+        {
+            passed &= TestCheck(false, test, "a respawned entity picked up the components of the one before it");
+            break;
+        }
+    }
+
+    int values = 0, tags = 0;
+    world.for_each(value_query, [&](TestValue&) { ++values; });
+    Ecs::Query tag_query;
+    tag_query.with<TestTag>().build();
+    world.for_each(tag_query, [&](TestTag&) { ++tags; });
+    passed &= TestCheck(values == entity_count && tags == entity_count / 2, test, "wrong number of entities left in the archetypes");
+
+    if (passed)
+        LOG_INFO("[{0}] passed, {1} entities", test, entity_count);
+    return passed;
+}
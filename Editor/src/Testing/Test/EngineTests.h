@@ -0,0 +1,51 @@
+/************************************************************************************//*!
+\file           EngineTests.h
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Declares the engine behaviour tests run by the EngineTestLayer. Each
+                test logs what it found wrong and returns whether it passed.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#pragma once
+
+#include <filesystem>
+
+// logs a failed check of a test, returns passed so checks can be chained into the test's result
+inline bool TestCheck(bool passed, const char* test, const char* what)
+{
+    if (!passed)
+        LOG_ERROR("[{0}] {1}", test, what);
+    return passed;
+}
+
+// ECSTest.cpp
+bool ECSCommandBufferTest();
+bool ECSBatchSpawnDestroyTest();
+
+// TransformTest.cpp
+bool TransformHierarchyTest();
+
+// AnimationTest.cpp
+bool AnimationPoseBlendTest();
+
+// EventQueueTest.cpp
+bool EventQueueTest();
+
+// PhysicsTest.cpp
+bool PhysicsRaycastBatchTest();
+bool PhysicsConvexCacheTest();
+
+// AssetTest.cpp, scratch is an empty directory the test may write into
+bool AssetIndexTest(const std::filesystem::path& scratch);
+bool AssetLoaderCancelTest(const std::filesystem::path& scratch);
+// loads a few models and animations found under assets with their own IDs, so the project's copies are untouched
+bool AssetLoaderOrderTest(const std::filesystem::path& assets);
+
+// SceneBinaryTest.cpp, scratch is an empty directory the test may write into
+bool SceneBinaryTest(const std::filesystem::path& scratch);
@@ -0,0 +1,115 @@
+/************************************************************************************//*!
+\file           EventQueueTest.cpp
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Tests that events queued from the worker pool are all delivered once,
+                in the order they were queued, by the next dispatch.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#include <pch.h>
+
+#include <Ouroboros/EventSystem/EventSystem.h>
+#include <Ouroboros/EventSystem/EventQueue.h>
+#include <Ouroboros/Core/WorkerPool.h>
+
+#include "EngineTests.h"
+
+namespace
+{
+    struct QueuedTestEvent : public oo::Event
+    {
+        std::size_t Value = 0;
+        std::size_t Batch = 0;
+        bool Requeue = false;
+    };
+
+    struct QueuedTestListener
+    {
+        oo::EventQueue* Queue = nullptr;
+        std::vector<std::pair<std::size_t, std::size_t>> Received;   // batch, value
+        void OnEvent(QueuedTestEvent* e)
+        {
+            Received.emplace_back(e->Batch, e->Value);
+            if (e->Requeue)
+            {
+                QueuedTestEvent requeued;
+                requeued.Value = e->Value;
+                Queue->Enqueue(requeued);
+            }
+        }
+    };
+}
+
+// Queues events from parallel_for batches, far more per thread than a ring holds so the overflow is
+// used too, then dispatches. Every event has to arrive exactly once and each batch's events in the
+// order the batch queued them. An event queued by a callback has to wait for the following dispatch.
+bool EventQueueTest()
+{
+    constexpr char const* test = "Event Queue";
+    constexpr std::size_t event_count = oo::EventQueue::RingCapacity * 200;
+    constexpr std::size_t batch_size = 1024;
+
+    oo::EventSystem system;
+    oo::EventQueue queue;
+    QueuedTestListener listener;
+    listener.Queue = &queue;
+    system.Subscribe<QueuedTestListener, QueuedTestEvent>(&listener, &QueuedTestListener::OnEvent);
+
+    bool passed = true;
+    for (int repeat = 0; repeat < 3; ++repeat)
+    {
+        listener.Received.clear();
+        oo::worker_pool::parallel_for(event_count, batch_size, [&](std::size_t begin, std::size_t end)
+        {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                QueuedTestEvent e;
+                e.Value = i;
+                e.Batch = begin;
+                queue.Enqueue(e);
+            }
+        });
+        queue.Dispatch(system);
+
+        // a batch queues its values in increasing order starting from its first, so each one has to
+        // arrive right after the one before it in the same batch
+        std::vector<bool> seen(event_count, false);
+        std::unordered_map<std::size_t, std::size_t> next_in_batch;
+        bool once = listener.Received.size() == event_count;
+        bool ordered = true;
+        for (auto const& [batch, value] : listener.Received)
+        {
+            if (value >= event_count || seen[value])
+            {
+                once = false;
+                break;
+            }
+            seen[value] = true;
+            auto next = next_in_batch.try_emplace(batch, batch).first;
+            ordered &= next->second == value;
+            next->second = value + 1;
+        }
+        passed &= TestCheck(once, test, "events were lost or delivered more than once");
+        passed &= TestCheck(ordered, test, "events queued by one thread arrived out of order");
+    }
+
+    listener.Received.clear();
+    QueuedTestEvent requeue;
+    requeue.Value = 1;
+    requeue.Requeue = true;
+    queue.Enqueue(requeue);
+    queue.Dispatch(system);
+    passed &= TestCheck(listener.Received.size() == 1, test, "an event queued by a callback was delivered in the same dispatch");
+    queue.Dispatch(system);
+    passed &= TestCheck(listener.Received.size() == 2 && listener.Received.back().second == 1, test, "an event queued by a callback was never delivered");
+
+    if (passed)
+        LOG_INFO("[{0}] passed, {1} events on {2} workers", test, event_count, oo::worker_pool::thread_count());
+    return passed;
+}
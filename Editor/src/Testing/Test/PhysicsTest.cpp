@@ -0,0 +1,155 @@
+/************************************************************************************//*!
+\file           PhysicsTest.cpp
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Tests that batched raycasts split across the worker pool hit what the
+                same rays cast one by one hit, and that cooked convex hulls are shared
+                by key until released.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#include <pch.h>
+
+#include <Physics/Source/phy.h>
+#include <Ouroboros/Core/WorkerPool.h>
+
+#include "EngineTests.h"
+
+// Casts rays down onto a field of static boxes with gaps between them, once one by one through
+// PhysxWorld::raycast and once as a batch split across the worker pool. Both have to report the
+// same hits, and some rays have to miss so misses are compared too.
+bool PhysicsRaycastBatchTest()
+{
+    constexpr char const* test = "Physics Raycast Batch";
+    constexpr std::size_t body_count = 400;
+    constexpr std::size_t ray_count = 5000;
+
+    myPhysx::PhysxWorld world{ PxVec3{ 0.f, -9.81f, 0.f } };
+    std::vector<myPhysx::PhysicsObject> objects;
+    objects.reserve(body_count);
+
+    // unit boxes two apart, so about three quarters of the rays land between them
+    std::size_t const side = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(body_count))));
+    for (std::size_t i = 0; i < body_count; ++i)
+    {
+        myPhysx::PhysicsObject body = world.createInstance();
+        body.rigid_type = myPhysx::rigid::rstatic;
+        body.shape_type = myPhysx::shape::box;
+        body.box = PxBoxGeometry{ 0.5f, 0.5f, 0.5f };
+        body.position = PxVec3{ (i % side) * 2.f, 0.f, (i / side) * 2.f };
+        objects.emplace_back(body);
+    }
+    world.submitUpdatedObjects(objects);
+    // publishes the new shapes to the scene query structures
+    world.updateScene(1.f / 60.f);
+
+    std::vector<myPhysx::RaycastQuery> queries(ray_count);
+    for (std::size_t i = 0; i < ray_count; ++i)
+    {
+        float const x = static_cast<float>(i % 97) / 97.f * side * 2.f - 1.f;
+        float const z = static_cast<float>(i % 89) / 89.f * side * 2.f - 1.f;
+        queries[i] = myPhysx::RaycastQuery{ PxVec3{ x, 10.f, z }, PxVec3{ 0.f, -1.f, 0.f }, 100.f };
+    }
+
+    std::vector<myPhysx::RaycastHit> single(ray_count);
+    for (std::size_t i = 0; i < ray_count; ++i)
+        single[i] = world.raycast(queries[i].origin, queries[i].direction, queries[i].distance, queries[i].filter);
+
+    std::vector<myPhysx::RaycastHit> batched(ray_count);
+    oo::worker_pool::parallel_for(ray_count, 32, [&](std::size_t first, std::size_t last)
+    {
+        world.raycastBatch(queries.data() + first, batched.data() + first, static_cast<PxU32>(last - first));
+    });
+
+    std::size_t hits = 0, mismatches = 0;
+    for (std::size_t i = 0; i < ray_count; ++i)
+    {
+        hits += single[i].intersect;
+        bool const same = single[i].intersect == batched[i].intersect && (single[i].intersect == false ||
+            (single[i].object_ID == batched[i].object_ID && std::abs(single[i].distance - batched[i].distance) < 1e-4f
+                && (single[i].position - batched[i].position).magnitude() < 1e-4f && (single[i].normal - batched[i].normal).magnitude() < 1e-4f));
+        mismatches += same == false;
+    }
+
+    bool passed = true;
+    passed &= TestCheck(hits > 0 && hits < ray_count, test, "rays have to both hit and miss for the comparison to mean anything");
+    passed &= TestCheck(mismatches == 0, test, "batched raycasts differ from the same rays cast one by one");
+
+    if (passed)
+        LOG_INFO("[{0}] passed, {1} rays, {2} hits", test, ray_count, hits);
+    return passed;
+}
+
+// Requests a hull twice under one key and checks both get the same mesh. Convex objects are made
+// from the key, then the key is released: the objects have to keep their hull and the next request
+// for the key has to cook again.
+bool PhysicsConvexCacheTest()
+{
+    constexpr char const* test = "Physics Convex Cache";
+    constexpr std::size_t vertex_count = 200;
+    // any key no asset uses, released afterwards so the cache is left as it was
+    constexpr std::uint64_t test_key = std::numeric_limits<std::uint64_t>::max() - 2;
+
+    std::vector<PxVec3> vertices(vertex_count);
+    for (std::size_t i = 0; i < vertex_count; ++i)
+    {
+        // points on a squashed sphere
+        float const theta = static_cast<float>(i) * 2.39996f;
+        float const y = 1.f - 2.f * (static_cast<float>(i) + 0.5f) / vertex_count;
+        float const r = std::sqrt(1.f - y * y);
+        vertices[i] = PxVec3{ r * std::cos(theta), y * 0.5f, r * std::sin(theta) };
+    }
+
+    bool passed = true;
+    myPhysx::physx_system::releaseConvexMesh(test_key);
+
+    PxConvexMesh* const first = myPhysx::physx_system::getConvexMesh(test_key, vertices);
+    // a request that hits the cache never looks at the vertices
+    PxConvexMesh* const second = myPhysx::physx_system::getConvexMesh(test_key, {});
+    passed &= TestCheck(first != nullptr && first == second, test, "the same key gave back a different hull");
+    passed &= TestCheck(myPhysx::physx_system::hasConvexMesh(test_key), test, "a cooked hull was not cached");
+
+    // only the cache and the shapes below hold the hull from here on
+    if (first)
+        first->release();
+    if (second)
+        second->release();
+
+    {
+        myPhysx::PhysxWorld world{ PxVec3{ 0.f, -9.81f, 0.f } };
+        for (int i = 0; i < 3; ++i)
+        {
+            myPhysx::PhysicsObject body = world.createInstance();
+            body.rigid_type = myPhysx::rigid::rstatic;
+            body.shape_type = myPhysx::shape::convex;
+            body.position = PxVec3{ static_cast<float>(i) * 3.f, 0.f, 0.f };
+            body.meshKey = test_key;
+            body.uploadVertices = vertices;
+            world.submitUpdatedObject(body);
+        }
+
+        myPhysx::physx_system::releaseConvexMesh(test_key);
+        passed &= TestCheck(myPhysx::physx_system::hasConvexMesh(test_key) == false, test, "a released key is still cached");
+
+        // the shapes keep their hull after the cache lets go of it
+        world.updateScene(1.f / 60.f);
+        myPhysx::RaycastHit const hit = world.raycast(PxVec3{ 3.f, 10.f, 0.f }, PxVec3{ 0.f, -1.f, 0.f }, 100.f);
+        passed &= TestCheck(hit.intersect && std::abs(hit.distance - 9.5f) < 1e-2f, test, "a shape lost its hull when the key was released");
+    }
+
+    // nothing cached under the key now, so the vertices are cooked again
+    PxConvexMesh* const recooked = myPhysx::physx_system::getConvexMesh(test_key, vertices);
+    passed &= TestCheck(recooked != nullptr && myPhysx::physx_system::hasConvexMesh(test_key), test, "a released key was not cooked again");
+    if (recooked)
+        recooked->release();
+    myPhysx::physx_system::releaseConvexMesh(test_key);
+
+    if (passed)
+        LOG_INFO("[{0}] passed", test);
+    return passed;
+}
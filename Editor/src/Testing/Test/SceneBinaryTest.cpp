@@ -0,0 +1,114 @@
+/************************************************************************************//*!
+\file           SceneBinaryTest.cpp
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Tests that the binary form of a scene reads back exactly what parsing
+                its json gives, and that stale or damaged binaries are refused.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#include <pch.h>
+
+#include <App/Editor/SceneBinary.h>
+
+#include <rapidjson/document.h>
+
+#include "EngineTests.h"
+
+namespace
+{
+    // every kind of value a component may save, objects sharing components so archetypes are shared too
+    constexpr char const* scene_json = R"({
+        "11": { "Order": 1,
+                "GameObjectComponent": { "Name": "root", "Active": true },
+                "TransformComponent": { "Position": { "x": 1.5, "y": -2.25, "z": 0.0001 }, "Layer": 18446744073709551615, "Offset": -5, "Far": -9000000000 } },
+        "12": { "Order": 2,
+                "GameObjectComponent": { "Name": "child", "Active": false },
+                "TransformComponent": { "Position": { "x": 1, "y": 2, "z": 3 }, "Layer": 1, "Offset": 0, "Far": 0 } },
+        "13": { "Order": 1,
+                "GameObjectComponent": { "Name": "", "Active": true },
+                "ScriptComponent": { "Scripts": { "values": [ 1, 2.5, "text", null, [], {} ] } } }
+    })";
+
+    void write_file(const std::filesystem::path& fp, std::string_view content)
+    {
+        std::ofstream ofs{ fp, std::ios::binary | std::ios::trunc };
+        ofs.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+}
+
+// Converts a scene and reads every object back from the binary, which has to give the same IDs,
+// depths, component names and values as the parsed json. Editing the json has to make the binary
+// stale, and with the json gone (a stripped build) no prefix of the binary may be opened.
+bool SceneBinaryTest(const std::filesystem::path& scratch)
+{
+    constexpr char const* test = "Scene Binary";
+
+    const std::filesystem::path scene = scratch / "test.scene";
+    write_file(scene, scene_json);
+
+    rapidjson::Document expected;
+    expected.Parse(scene_json);
+
+    bool passed = true;
+    passed &= TestCheck(SceneBinary::Convert(scene), test, "scene could not be converted");
+    passed &= TestCheck(SceneBinary::IsCurrent(scene), test, "a freshly converted scene is not current");
+
+    SceneBinary binary;
+    passed &= TestCheck(binary.Open(scene), test, "converted scene could not be opened");
+    passed &= TestCheck(binary.GetObjects().size() == expected.MemberCount() && binary.GetArchetypeCount() == 2, test, "wrong number of objects or archetypes");
+    if (!passed)
+        return false;
+
+    rapidjson::Document::AllocatorType allocator;
+    std::vector<rapidjson::Value> components;
+    bool sameObjects = true, sameComponents = true;
+    size_t index = 0;
+    for (auto object = expected.MemberBegin(); object != expected.MemberEnd(); ++object, ++index)
+    {
+        const SceneBinary::Object& read = binary.GetObjects()[index];
+        sameObjects &= std::to_string(read.id) == object->name.GetString() && read.order == object->value["Order"].GetInt();
+
+        binary.ReadComponents(read, components, allocator);
+        const SceneBinary::Archetype& archetype = binary.GetArchetype(read.archetype);
+        // the first member is the order, every one after it a component
+        sameComponents &= archetype.size() == object->value.MemberCount() - 1 && components.size() == archetype.size();
+        size_t component = 0;
+        for (auto member = object->value.MemberBegin() + 1; sameComponents && member != object->value.MemberEnd(); ++member, ++component)
+            sameComponents &= std::string_view{ archetype[component] } == member->name.GetString() && components[component] == member->value;
+        allocator.Clear();
+    }
+    passed &= TestCheck(sameObjects, test, "objects read back with different IDs or order");
+    passed &= TestCheck(sameComponents, test, "components read back differ from the json");
+
+    // an edit the binary was not converted from
+    {
+        std::ofstream ofs{ scene, std::ios::binary | std::ios::app };
+        ofs << ' ';
+    }
+    passed &= TestCheck(!SceneBinary::IsCurrent(scene) && !binary.Open(scene), test, "a binary older than its edited scene was used");
+
+    passed &= TestCheck(SceneBinary::Convert(scene), test, "edited scene could not be converted");
+    std::string saved;
+    {
+        std::ifstream ifs{ SceneBinary::GetPath(scene), std::ios::binary };
+        saved.assign(std::istreambuf_iterator<char>{ ifs }, std::istreambuf_iterator<char>{});
+    }
+    std::filesystem::remove(scene);
+    size_t accepted = 0;
+    for (size_t length = 0; length < saved.size(); ++length)
+    {
+        write_file(SceneBinary::GetPath(scene), std::string_view{ saved }.substr(0, length));
+        accepted += binary.Open(scene);
+    }
+    passed &= TestCheck(accepted == 0, test, "a truncated binary was opened");
+
+    if (passed)
+        LOG_INFO("[{0}] passed, {1} objects in {2} bytes", test, expected.MemberCount(), saved.size());
+    return passed;
+}
@@ -0,0 +1,153 @@
+/************************************************************************************//*!
+\file           TransformTest.cpp
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Tests that moving and removing subtrees in the transform system's
+                flattened hierarchy keeps it depth first and matching a plain parent map.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#include <pch.h>
+
+#include <map>
+#include <random>
+
+#include <Ouroboros/Transform/TransformHierarchy.h>
+
+#include "EngineTests.h"
+
+namespace
+{
+    // lays out a random tree depth first, each node goes under the last node or one of its ancestors.
+    // the reference records each node's parent by uuid, node 0 is the root.
+    void build_hierarchy(oo::TransformHierarchy& hierarchy, std::map<std::uint64_t, std::uint64_t>& reference, std::size_t count, std::mt19937& rng)
+    {
+        hierarchy.Clear();
+        reference.clear();
+
+        std::vector<std::uint32_t> chain;
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            Ecs::EntityID entity{};
+            entity.index = i;
+            entity.generation = 1;
+
+            std::uint32_t parent = oo::TransformHierarchy::InvalidIndex;
+            if (chain.empty() == false)
+            {
+                chain.resize(1 + rng() % std::min<std::size_t>(chain.size(), 8));
+                parent = chain.back();
+                reference.emplace(i + 1ull, hierarchy.Ids[parent]);
+            }
+            chain.emplace_back(hierarchy.Append(oo::UUID{ i + 1ull }, parent, entity, nullptr));
+        }
+        hierarchy.EndAppend();
+    }
+
+    bool in_subtree(std::map<std::uint64_t, std::uint64_t> const& reference, std::uint64_t node, std::uint64_t descendant)
+    {
+        for (auto it = reference.find(descendant); descendant != node; it = reference.find(descendant))
+        {
+            if (it == reference.end())
+                return false;
+            descendant = it->second;
+        }
+        return true;
+    }
+
+    // the layout has to be depth first with every node under the parent the reference has for it
+    bool matches(oo::TransformHierarchy const& hierarchy, std::map<std::uint64_t, std::uint64_t> const& reference)
+    {
+        if (hierarchy.Size() != reference.size() + 1 || hierarchy.Parents[0] != oo::TransformHierarchy::InvalidIndex)
+            return false;
+
+        for (std::uint32_t i = 0; i < hierarchy.Size(); ++i)
+        {
+            if (hierarchy.SubtreeEnd[i] <= i || hierarchy.SubtreeEnd[i] > hierarchy.Size())
+                return false;
+            if (hierarchy.IndexOf(hierarchy.Entities[i]) != i)
+                return false;
+            if (i == 0)
+                continue;
+
+            std::uint32_t const parent = hierarchy.Parents[i];
+            auto const it = reference.find(hierarchy.Ids[i]);
+            if (parent >= i || hierarchy.SubtreeEnd[i] > hierarchy.SubtreeEnd[parent])
+                return false;
+            if (it == reference.end() || it->second != static_cast<std::uint64_t>(hierarchy.Ids[parent]))
+                return false;
+        }
+        return true;
+    }
+}
+
+// Builds a random hierarchy, then moves and removes random subtrees, checking the layout against a
+// parent map after every edit. Moves under the node's own subtree have to be refused untouched.
+bool TransformHierarchyTest()
+{
+    constexpr char const* test = "Transform Hierarchy";
+    constexpr std::size_t node_count = 2000;
+    constexpr int edit_count = 1000;
+
+    oo::TransformHierarchy hierarchy;
+    std::map<std::uint64_t, std::uint64_t> reference;
+    std::mt19937 rng{ 12345 };
+    build_hierarchy(hierarchy, reference, node_count, rng);
+
+    bool passed = TestCheck(matches(hierarchy, reference), test, "appended layout does not match the nodes appended");
+
+    int refused = 0;
+    for (int edit = 0; edit < edit_count && passed && hierarchy.Size() > 1; ++edit)
+    {
+        std::uint32_t const index = 1 + static_cast<std::uint32_t>(rng() % (hierarchy.Size() - 1));
+        std::uint64_t const node = hierarchy.Ids[index];
+        Ecs::EntityID const entity = hierarchy.Entities[index];
+
+        if (edit % 10 == 9)
+        {
+            hierarchy.Remove(index);
+            std::vector<std::uint64_t> removed;
+            for (auto const& [id, parent_id] : reference)
+            {
+                if (in_subtree(reference, node, id))
+                    removed.emplace_back(id);
+            }
+            for (std::uint64_t id : removed)
+                reference.erase(id);
+            passed &= TestCheck(matches(hierarchy, reference), test, "layout does not match after removing a subtree");
+            continue;
+        }
+
+        // random parents rarely land in the node's own subtree, so every few edits aim for it on purpose
+        std::uint32_t const parent = edit % 10 == 4
+            ? index + static_cast<std::uint32_t>(rng() % (hierarchy.SubtreeEnd[index] - index))
+            : static_cast<std::uint32_t>(rng() % hierarchy.Size());
+        std::uint64_t const parent_id = hierarchy.Ids[parent];
+        bool const into_itself = in_subtree(reference, node, parent_id);
+
+        bool const moved = hierarchy.Move(index, parent);
+        passed &= TestCheck(moved != into_itself, test, into_itself ? "a move into the node's own subtree was not refused" : "a valid move was refused");
+        if (moved)
+        {
+            reference[node] = parent_id;
+            // the node goes in as the parent's last child, so their subtrees end together
+            std::uint32_t const moved_index = hierarchy.IndexOf(entity);
+            passed &= TestCheck(hierarchy.Contains(moved_index, oo::UUID{ node }) && hierarchy.SubtreeEnd[moved_index] == hierarchy.SubtreeEnd[hierarchy.Parents[moved_index]],
+                test, "a moved node is not its new parent's last child");
+        }
+        else
+        {
+            ++refused;
+        }
+        passed &= TestCheck(matches(hierarchy, reference), test, "layout does not match after moving a subtree");
+    }
+
+    if (passed)
+        LOG_INFO("[{0}] passed, {1} edits, {2} moves refused, {3} nodes left", test, edit_count, refused, hierarchy.Size());
+    return passed;
+}
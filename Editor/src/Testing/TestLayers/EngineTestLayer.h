@@ -0,0 +1,93 @@
+/************************************************************************************//*!
+\file           EngineTestLayer.h
+\project        Ouroboros
+\author        
+\par            email:
+\date           Oct 17, 2026
+\brief          Debugging Layer that runs the engine behaviour tests once a project
+                has loaded, started with --run-tests.
+
+Copyright (C) 2026 DigiPen Institute of Technology.
+Reproduction or disclosure of this file or its contents
+without the prior written consent of DigiPen Institute of
+Technology is prohibited.
+*//*************************************************************************************/
+#pragma once
+
+#include <Ouroboros/Core/Base.h>
+#include <Ouroboros/Core/Layer.h>
+
+#include "Project.h"
+#include "Testing/Test/EngineTests.h"
+
+/****************************************************************************//*!
+ @brief     Runs every engine test once, after a project has loaded so the worker
+            pool is up and its assets can be used, then logs how many failed.
+*//*****************************************************************************/
+class EngineTestLayer final : public oo::Layer
+{
+private:
+    bool m_ran = false;
+
+public:
+    EngineTestLayer()
+        : Layer{ "EngineTest Layer" }
+    {
+    }
+
+    void OnAttach() override final
+    {
+    }
+
+    void OnDetach() override final
+    {
+    }
+
+    void OnUpdate() override final
+    {
+        if (m_ran || Project::GetAssetManager() == nullptr)
+            return;
+        m_ran = true;
+
+        // tests that write files each get an empty directory of their own
+        const std::filesystem::path scratchRoot = std::filesystem::temp_directory_path() / "OuroborosTests";
+        std::error_code ec;
+        std::filesystem::remove_all(scratchRoot, ec);
+        auto scratch = [&](const char* name)
+        {
+            std::filesystem::path dir = scratchRoot / name;
+            std::filesystem::create_directories(dir, ec);
+            return dir;
+        };
+
+        const std::pair<const char*, bool> results[] =
+        {
+            { "ECSCommandBufferTest", ECSCommandBufferTest() },
+            { "ECSBatchSpawnDestroyTest", ECSBatchSpawnDestroyTest() },
+            { "TransformHierarchyTest", TransformHierarchyTest() },
+            { "AnimationPoseBlendTest", AnimationPoseBlendTest() },
+            { "EventQueueTest", EventQueueTest() },
+            { "PhysicsRaycastBatchTest", PhysicsRaycastBatchTest() },
+            { "PhysicsConvexCacheTest", PhysicsConvexCacheTest() },
+            { "AssetIndexTest", AssetIndexTest(scratch("AssetIndex")) },
+            { "AssetLoaderCancelTest", AssetLoaderCancelTest(scratch("AssetLoaderCancel")) },
+            { "AssetLoaderOrderTest", AssetLoaderOrderTest(Project::GetAssetFolder()) },
+            { "SceneBinaryTest", SceneBinaryTest(scratch("SceneBinary")) },
+        };
+        std::filesystem::remove_all(scratchRoot, ec);
+
+        size_t failed = 0;
+        for (const auto& [name, passed] : results)
+        {
+            if (!passed)
+            {
+                LOG_ERROR("{0} failed", name);
+                ++failed;
+            }
+        }
+        if (failed == 0)
+            LOG_INFO("All {0} engine tests passed", std::size(results));
+        else
+            LOG_ERROR("{0} of {1} engine tests failed", failed, std::size(results));
+    }
+};